@@ -0,0 +1,469 @@
+#include "PlateArranger.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace core {
+namespace buildplate {
+
+namespace {
+
+constexpr size_t HULL_CHUNK = 65536;
+constexpr uint64_t NO_POSITION = ~uint64_t(0);
+
+using polygon::IntPoint;
+using polygon::Polygon;
+using polygon::cross;
+
+/**
+ * @brief Andrew monotone chain; CCW, doğrusal noktalar atılır
+ */
+Polygon convexHull(std::vector<IntPoint> points)
+{
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    if (points.size() < 3)
+    {
+        return points;
+    }
+
+    Polygon hull(2 * points.size());
+    size_t k = 0;
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        while (k >= 2 && cross(hull[k - 2], hull[k - 1], points[i]) <= 0)
+        {
+            --k;
+        }
+        hull[k++] = points[i];
+    }
+    for (size_t i = points.size() - 1, lower = k + 1; i > 0; --i)
+    {
+        while (k >= lower && cross(hull[k - 2], hull[k - 1], points[i - 1]) <= 0)
+        {
+            --k;
+        }
+        hull[k++] = points[i - 1];
+    }
+    hull.resize(k - 1);
+    return hull;
+}
+
+struct Point
+{
+    double x, y;
+};
+
+/**
+ * @brief Noktanın dışbükey CCW çokgene uzaklığı (içerideyse 0)
+ */
+double distanceToHull(const std::vector<Point>& hull, const Point& p)
+{
+    if (hull.size() == 1)
+    {
+        return std::hypot(p.x - hull[0].x, p.y - hull[0].y);
+    }
+
+    bool inside = hull.size() >= 3;
+    double best = INFINITY;
+    for (size_t i = 0; i < hull.size(); ++i)
+    {
+        const Point& a = hull[i];
+        const Point& b = hull[(i + 1) % hull.size()];
+        const double ex = b.x - a.x;
+        const double ey = b.y - a.y;
+        const double px = p.x - a.x;
+        const double py = p.y - a.y;
+
+        if (ex * py - ey * px < 0.0)
+        {
+            inside = false;
+        }
+
+        const double lengthSq = ex * ex + ey * ey;
+        const double t = lengthSq > 0.0 ? std::clamp((px * ex + py * ey) / lengthSq, 0.0, 1.0) : 0.0;
+        best = std::min(best, std::hypot(px - t * ex, py - t * ey));
+    }
+    return inside ? 0.0 : best;
+}
+
+/**
+ * @brief Bit ızgara: satır başına words kelime, bit x = sütun x
+ */
+struct Raster
+{
+    int width = 0;
+    int height = 0;
+    int words = 0;
+    std::vector<uint64_t> bits;
+    double minX = 0.0;          // mm, hücre (0, 0)'ın sol alt köşesi (parça uzayında)
+    double minY = 0.0;
+    size_t cells = 0;           // Dolu hücre sayısı
+    double rotation = 0.0;      // derece
+
+    bool test(int x, int y) const { return (bits[static_cast<size_t>(y) * words + (x >> 6)] >> (x & 63)) & 1u; }
+    void set(int x, int y) { bits[static_cast<size_t>(y) * words + (x >> 6)] |= uint64_t(1) << (x & 63); }
+};
+
+/**
+ * @brief Zarfı margin kadar şişirerek rasterize et (hücreye değen her şey dolu)
+ */
+Raster rasterize(const Polygon& hull, double rotation, double margin, double cell)
+{
+    const double radians = rotation * 3.14159265358979323846 / 180.0;
+    const double c = std::cos(radians);
+    const double s = std::sin(radians);
+
+    std::vector<Point> points;
+    points.reserve(hull.size());
+    double minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+    for (const IntPoint& p : hull)
+    {
+        const double x = polygon::toMillimeters(p.x);
+        const double y = polygon::toMillimeters(p.y);
+        const Point rotated{c * x - s * y, s * x + c * y};
+        points.push_back(rotated);
+        minX = std::min(minX, rotated.x);
+        minY = std::min(minY, rotated.y);
+        maxX = std::max(maxX, rotated.x);
+        maxY = std::max(maxY, rotated.y);
+    }
+
+    Raster raster;
+    raster.rotation = rotation;
+    raster.minX = minX - margin;
+    raster.minY = minY - margin;
+    raster.width = std::max(1, static_cast<int>(std::ceil((maxX - minX + 2.0 * margin) / cell)));
+    raster.height = std::max(1, static_cast<int>(std::ceil((maxY - minY + 2.0 * margin) / cell)));
+    raster.words = (raster.width + 63) / 64;
+    raster.bits.assign(static_cast<size_t>(raster.words) * raster.height, 0);
+
+    // Hücre merkezi zarfa (margin + yarım köşegen) kadar yakınsa hücreye değer
+    const double reach = margin + 0.5 * std::sqrt(2.0) * cell;
+    for (int y = 0; y < raster.height; ++y)
+    {
+        for (int x = 0; x < raster.width; ++x)
+        {
+            const Point center{raster.minX + (x + 0.5) * cell, raster.minY + (y + 0.5) * cell};
+            if (distanceToHull(points, center) <= reach)
+            {
+                raster.set(x, y);
+                raster.cells++;
+            }
+        }
+    }
+    return raster;
+}
+
+/**
+ * @brief Tabla doluluk ızgarası (kullanılamayan hücreler baştan dolu)
+ */
+class Occupancy
+{
+public:
+    Occupancy(const BuildPlate& plate, double cell)
+        : cell_(cell)
+    {
+        const geometry::AABB bounds = plate.bounds();
+        originX_ = bounds.min.x;
+        originY_ = bounds.min.y;
+        width_ = static_cast<int>(std::floor((bounds.max.x - bounds.min.x) / cell));
+        height_ = static_cast<int>(std::floor((bounds.max.y - bounds.min.y) / cell));
+        words_ = width_ / 64 + 2;       // Kaydırmalı okuma için bir kelime fazla
+        bits_.assign(static_cast<size_t>(words_) * std::max(height_, 0), ~uint64_t(0));
+
+        for (int y = 0; y < height_; ++y)
+        {
+            for (int x = 0; x < width_; ++x)
+            {
+                if (usable(plate, x, y))
+                {
+                    bits_[static_cast<size_t>(y) * words_ + (x >> 6)] &= ~(uint64_t(1) << (x & 63));
+                    usableCells_++;
+                }
+            }
+        }
+    }
+
+    int width() const { return width_; }
+    int height() const { return height_; }
+    size_t usableCells() const { return usableCells_; }
+    double originX() const { return originX_; }
+    double originY() const { return originY_; }
+
+    bool rowFull(int y) const
+    {
+        const uint64_t* row = &bits_[static_cast<size_t>(y) * words_];
+        for (int w = 0; w < words_; ++w)
+        {
+            if (row[w] != ~uint64_t(0))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool fits(const Raster& raster, int x, int y) const
+    {
+        for (int fy = 0; fy < raster.height; ++fy)
+        {
+            const uint64_t* row = &bits_[static_cast<size_t>(y + fy) * words_];
+            const uint64_t* footprint = &raster.bits[static_cast<size_t>(fy) * raster.words];
+            for (int k = 0; k < raster.words; ++k)
+            {
+                if (footprint[k] != 0 && (shifted(row, x + 64 * k) & footprint[k]) != 0)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void mark(const Raster& raster, int x, int y)
+    {
+        for (int fy = 0; fy < raster.height; ++fy)
+        {
+            uint64_t* row = &bits_[static_cast<size_t>(y + fy) * words_];
+            const uint64_t* footprint = &raster.bits[static_cast<size_t>(fy) * raster.words];
+            for (int k = 0; k < raster.words; ++k)
+            {
+                const int bit = x + 64 * k;
+                const int shift = bit & 63;
+                row[bit >> 6] |= footprint[k] << shift;
+                if (shift != 0)
+                {
+                    row[(bit >> 6) + 1] |= footprint[k] >> (64 - shift);
+                }
+            }
+        }
+    }
+
+private:
+    double cell_;
+    double originX_ = 0.0;
+    double originY_ = 0.0;
+    int width_ = 0;
+    int height_ = 0;
+    int words_ = 0;
+    size_t usableCells_ = 0;
+    std::vector<uint64_t> bits_;
+
+    static uint64_t shifted(const uint64_t* row, int bit)
+    {
+        const int word = bit >> 6;
+        const int shift = bit & 63;
+        return shift == 0 ? row[word] : (row[word] >> shift) | (row[word + 1] << (64 - shift));
+    }
+
+    bool usable(const BuildPlate& plate, int x, int y) const
+    {
+        if (plate.type() != PlateType::Circular)
+        {
+            return true;
+        }
+
+        // Hücrenin dört köşesi de daire içinde olmalı
+        const double radius = 0.5 * plate.width();
+        for (int corner = 0; corner < 4; ++corner)
+        {
+            const double px = originX_ + (x + (corner & 1)) * cell_;
+            const double py = originY_ + (y + (corner >> 1)) * cell_;
+            if (px * px + py * py > radius * radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+uint64_t positionKey(int x, int y)
+{
+    return (static_cast<uint64_t>(y) << 32) | static_cast<uint32_t>(x);
+}
+
+} // namespace
+
+PlateArranger::PlateArranger(const ArrangeSettings& settings, parallel::ThreadPool& pool)
+    : settings_(settings)
+    , pool_(pool)
+{
+}
+
+polygon::Polygon PlateArranger::footprint(const mesh::Mesh& mesh) const
+{
+    const size_t count = mesh.triangles.size();
+    const size_t chunks = (count + HULL_CHUNK - 1) / HULL_CHUNK;
+
+    // Parça başına zarf, sonra zarfların zarfı
+    std::vector<Polygon> partial(chunks);
+    pool_.parallelFor(0, chunks, 1, [&](size_t begin, size_t end) {
+        std::vector<IntPoint> points;
+        for (size_t c = begin; c < end; ++c)
+        {
+            points.clear();
+            const size_t last = std::min(count, (c + 1) * HULL_CHUNK);
+            for (size_t i = c * HULL_CHUNK; i < last; ++i)
+            {
+                const geometry::Triangle& tri = mesh.triangles[i];
+                points.emplace_back(polygon::toFixed(tri.vertex1.x), polygon::toFixed(tri.vertex1.y));
+                points.emplace_back(polygon::toFixed(tri.vertex2.x), polygon::toFixed(tri.vertex2.y));
+                points.emplace_back(polygon::toFixed(tri.vertex3.x), polygon::toFixed(tri.vertex3.y));
+            }
+            partial[c] = convexHull(points);
+        }
+    });
+
+    std::vector<IntPoint> points;
+    for (const Polygon& hull : partial)
+    {
+        points.insert(points.end(), hull.begin(), hull.end());
+    }
+    return convexHull(std::move(points));
+}
+
+ArrangeResult PlateArranger::arrange(const std::vector<polygon::Polygon>& footprints,
+                                     const BuildPlate& plate) const
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    ArrangeResult result;
+    result.placements.resize(footprints.size());
+
+    if (settings_.cellSize <= 0.0f || settings_.spacing < 0.0f)
+    {
+        result.errorMessage = "Invalid arrange settings (cell size must be positive)";
+        return result;
+    }
+
+    const double cell = settings_.cellSize;
+    const double margin = 0.5 * settings_.spacing;
+
+    Occupancy occupancy(plate, cell);
+    if (occupancy.width() <= 0 || occupancy.height() <= 0)
+    {
+        result.errorMessage = "Build plate is smaller than one grid cell";
+        return result;
+    }
+
+    // Büyük parçalar önce (boşlukları küçükler doldurur)
+    std::vector<size_t> order(footprints.size());
+    std::vector<double> areas(footprints.size());
+    for (size_t i = 0; i < footprints.size(); ++i)
+    {
+        order[i] = i;
+        areas[i] = static_cast<double>(polygon::signedArea2(footprints[i]));
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return areas[a] > areas[b]; });
+
+    // Rasterler parçadan bağımsız: paralel hazırla
+    const int orientations = settings_.allowRotation ? 2 : 1;
+    std::vector<Raster> rasters(footprints.size() * orientations);
+    pool_.parallelFor(0, rasters.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r)
+        {
+            const size_t part = r / orientations;
+            if (!footprints[part].empty())
+            {
+                rasters[r] = rasterize(footprints[part], 90.0 * (r % orientations), margin, cell);
+            }
+        }
+    });
+
+    size_t usedCells = 0;
+
+    for (size_t part : order)
+    {
+        if (footprints[part].empty())
+        {
+            continue;
+        }
+
+        uint64_t bestKey = NO_POSITION;
+        int bestOrientation = -1;
+
+        for (int o = 0; o < orientations; ++o)
+        {
+            const Raster& raster = rasters[part * orientations + o];
+            const int rows = occupancy.height() - raster.height + 1;
+            const int columns = occupancy.width() - raster.width + 1;
+            if (rows <= 0 || columns <= 0)
+            {
+                continue;
+            }
+
+            // Aday satırlar paralel; her parça kendi aralığında ilk uygun konumda durur
+            std::atomic<uint64_t> found{NO_POSITION};
+            pool_.parallelFor(0, static_cast<size_t>(rows), 4, [&](size_t begin, size_t end) {
+                for (size_t y = begin; y < end; ++y)
+                {
+                    if (positionKey(0, static_cast<int>(y)) > found.load(std::memory_order_relaxed) ||
+                        positionKey(0, static_cast<int>(y)) > bestKey)
+                    {
+                        return;
+                    }
+                    if (occupancy.rowFull(static_cast<int>(y)))
+                    {
+                        continue;
+                    }
+                    for (int x = 0; x < columns; ++x)
+                    {
+                        if (occupancy.fits(raster, x, static_cast<int>(y)))
+                        {
+                            const uint64_t key = positionKey(x, static_cast<int>(y));
+                            uint64_t current = found.load(std::memory_order_relaxed);
+                            while (key < current &&
+                                   !found.compare_exchange_weak(current, key, std::memory_order_relaxed))
+                            {
+                            }
+                            return;
+                        }
+                    }
+                }
+            });
+
+            // Eşitlikte döndürülmemiş hal tercih edilir
+            if (found.load() < bestKey)
+            {
+                bestKey = found.load();
+                bestOrientation = o;
+            }
+        }
+
+        if (bestOrientation < 0)
+        {
+            continue;   // Sığmadı
+        }
+
+        const Raster& raster = rasters[part * orientations + bestOrientation];
+        const int x = static_cast<int>(bestKey & 0xFFFFFFFFu);
+        const int y = static_cast<int>(bestKey >> 32);
+        occupancy.mark(raster, x, y);
+        usedCells += raster.cells;
+
+        PartPlacement& placement = result.placements[part];
+        placement.placed = true;
+        placement.transform.rotation = geometry::Vec3(0.0f, 0.0f, static_cast<float>(raster.rotation));
+        placement.transform.translation = geometry::Vec3(
+            static_cast<float>(occupancy.originX() + x * cell - raster.minX),
+            static_cast<float>(occupancy.originY() + y * cell - raster.minY),
+            0.0f);
+        result.placedCount++;
+    }
+
+    result.utilization = occupancy.usableCells() > 0
+        ? static_cast<double>(usedCells) / occupancy.usableCells()
+        : 0.0;
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+} // namespace buildplate
+} // namespace core
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "BuildPlate.h"
+#include "core/mesh/mesh.h"
+#include "core/mesh/MeshTransform.h"
+#include "core/polygon/IntPoint.h"
+#include "core/parallel/ThreadPool.h"
+#include <string>
+#include <vector>
+
+namespace core {
+namespace buildplate {
+
+struct ArrangeSettings
+{
+    float spacing = 3.0f;           // mm, parçalar (ve tabla kenarı) arası boşluk
+    float cellSize = 1.0f;          // mm, doluluk ızgarası çözünürlüğü
+    bool allowRotation = true;      // 90° döndürülmüş hali de denenir
+};
+
+/**
+ * @brief Bir parçanın yerleşimi: önce Z etrafında döndür, sonra taşı
+ */
+struct PartPlacement
+{
+    bool placed = false;
+    mesh::ModelTransform transform; // rotation.z ∈ {0, 90}; translation.z = 0
+};
+
+struct ArrangeResult
+{
+    std::vector<PartPlacement> placements;  // Girdi sırasıyla
+    size_t placedCount = 0;
+    double utilization = 0.0;               // Dolu hücre / kullanılabilir hücre
+    double elapsedMs = 0.0;
+
+    std::string errorMessage;
+
+    bool success() const { return errorMessage.empty(); }
+    bool allPlaced() const { return placedCount == placements.size(); }
+};
+
+/**
+ * @brief Çok parçalı otomatik yerleşim (nesting)
+ *
+ * Her parçanın tabla izdüşümü 2B dışbükey zarfa indirgenir, spacing/2
+ * kadar şişirilip doluluk ızgarasına rasterize edilir (muhafazakâr: zarfa
+ * değen her hücre dolu). Parçalar alan sırasıyla (büyük önce) bottom-left-
+ * fill ile yerleştirilir: en alttaki, sonra en soldaki boş konum.
+ *
+ * Izgara satırları 64 bitlik kelimelerdir; bir aday konum satır başına
+ * kaydırılmış kelime AND'leriyle test edilir. Aday satırlar thread pool'da
+ * paralel taranır, en alttaki uygun konum kazanır (sonuç deterministik).
+ *
+ * Dairesel tablada sadece tamamen daire içindeki hücreler kullanılır.
+ */
+class PlateArranger
+{
+public:
+    explicit PlateArranger(const ArrangeSettings& settings = ArrangeSettings(),
+                           parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    /**
+     * @brief Mesh'in XY izdüşümünün dışbükey zarfı (CCW, mikron)
+     */
+    polygon::Polygon footprint(const mesh::Mesh& mesh) const;
+
+    ArrangeResult arrange(const std::vector<polygon::Polygon>& footprints, const BuildPlate& plate) const;
+
+private:
+    ArrangeSettings settings_;
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace buildplate
+} // namespace core
@@ -0,0 +1,688 @@
+#include "PlateContainment.h"
+#include "core/geometry/kernels.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PLATE_CONTAINMENT_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define PLATE_CONTAINMENT_TARGET_AVX2
+#else
+#define PLATE_CONTAINMENT_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#else
+#define PLATE_CONTAINMENT_X86 0
+#endif
+
+namespace core {
+namespace buildplate {
+
+using geometry::Triangle;
+using geometry::Vec3;
+using geometry::kernels::AffineTransform;
+using geometry::kernels::IsaLevel;
+
+// SIMD yükleme Triangle'ı 12, Vec3'ü 3 ardışık float olarak okur
+static_assert(sizeof(Triangle) == 12 * sizeof(float), "Triangle must be 12 packed floats");
+static_assert(std::is_standard_layout<Vec3>::value && sizeof(Vec3) == 3 * sizeof(float),
+              "Vec3 must be 3 packed floats");
+
+namespace {
+
+constexpr size_t TRIANGLE_CHUNK = 32768;
+constexpr size_t POINT_CHUNK = 98304;
+constexpr float TOLERANCE = PlateContainment::CONTAINMENT_TOLERANCE;
+
+/**
+ * @brief Parça başına birikim (sınırlar, ihlaller)
+ */
+struct Extents
+{
+    float minX = FLT_MAX, minY = FLT_MAX, minZ = FLT_MAX;
+    float maxX = -FLT_MAX, maxY = -FLT_MAX, maxZ = -FLT_MAX;
+    float maxRadiusSq = 0.0f;
+
+    size_t violations = 0;
+    size_t first = ContainmentResult::NO_VIOLATION;
+    Vec3 firstPoint;
+
+    void addViolation(size_t index, float x, float y, float z)
+    {
+        violations++;
+        if (index < first)
+        {
+            first = index;
+            firstPoint = Vec3(x, y, z);
+        }
+    }
+
+    void merge(const Extents& other)
+    {
+        minX = std::min(minX, other.minX);
+        minY = std::min(minY, other.minY);
+        minZ = std::min(minZ, other.minZ);
+        maxX = std::max(maxX, other.maxX);
+        maxY = std::max(maxY, other.maxY);
+        maxZ = std::max(maxZ, other.maxZ);
+        maxRadiusSq = std::max(maxRadiusSq, other.maxRadiusSq);
+
+        violations += other.violations;
+        if (other.first < first)
+        {
+            first = other.first;
+            firstPoint = other.firstPoint;
+        }
+    }
+};
+
+// ============================================================
+// Hacim tipleri (tolerans dahil; NaN daima dışarıda)
+// ============================================================
+
+struct BoxVolume
+{
+    static constexpr bool RADIAL = false;
+
+    float minX, maxX, minY, maxY, minZ, maxZ;
+
+    bool inside(float x, float y, float z, float) const noexcept
+    {
+        return x >= minX && x <= maxX && y >= minY && y <= maxY && z >= minZ && z <= maxZ;
+    }
+
+#if PLATE_CONTAINMENT_X86
+    __m128 inside(__m128 x, __m128 y, __m128 z, __m128) const noexcept
+    {
+        const __m128 inX = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(minX)), _mm_cmple_ps(x, _mm_set1_ps(maxX)));
+        const __m128 inY = _mm_and_ps(_mm_cmpge_ps(y, _mm_set1_ps(minY)), _mm_cmple_ps(y, _mm_set1_ps(maxY)));
+        const __m128 inZ = _mm_and_ps(_mm_cmpge_ps(z, _mm_set1_ps(minZ)), _mm_cmple_ps(z, _mm_set1_ps(maxZ)));
+        return _mm_and_ps(inX, _mm_and_ps(inY, inZ));
+    }
+
+    PLATE_CONTAINMENT_TARGET_AVX2
+    __m256 inside(__m256 x, __m256 y, __m256 z, __m256) const noexcept
+    {
+        const __m256 inX = _mm256_and_ps(_mm256_cmp_ps(x, _mm256_set1_ps(minX), _CMP_GE_OQ),
+                                         _mm256_cmp_ps(x, _mm256_set1_ps(maxX), _CMP_LE_OQ));
+        const __m256 inY = _mm256_and_ps(_mm256_cmp_ps(y, _mm256_set1_ps(minY), _CMP_GE_OQ),
+                                         _mm256_cmp_ps(y, _mm256_set1_ps(maxY), _CMP_LE_OQ));
+        const __m256 inZ = _mm256_and_ps(_mm256_cmp_ps(z, _mm256_set1_ps(minZ), _CMP_GE_OQ),
+                                         _mm256_cmp_ps(z, _mm256_set1_ps(maxZ), _CMP_LE_OQ));
+        return _mm256_and_ps(inX, _mm256_and_ps(inY, inZ));
+    }
+#endif
+};
+
+struct CylinderVolume
+{
+    static constexpr bool RADIAL = true;
+
+    float radiusSq, minZ, maxZ;
+
+    bool inside(float, float, float z, float r2) const noexcept
+    {
+        return r2 <= radiusSq && z >= minZ && z <= maxZ;
+    }
+
+#if PLATE_CONTAINMENT_X86
+    __m128 inside(__m128, __m128, __m128 z, __m128 r2) const noexcept
+    {
+        const __m128 inR = _mm_cmple_ps(r2, _mm_set1_ps(radiusSq));
+        const __m128 inZ = _mm_and_ps(_mm_cmpge_ps(z, _mm_set1_ps(minZ)), _mm_cmple_ps(z, _mm_set1_ps(maxZ)));
+        return _mm_and_ps(inR, inZ);
+    }
+
+    PLATE_CONTAINMENT_TARGET_AVX2
+    __m256 inside(__m256, __m256, __m256 z, __m256 r2) const noexcept
+    {
+        const __m256 inR = _mm256_cmp_ps(r2, _mm256_set1_ps(radiusSq), _CMP_LE_OQ);
+        const __m256 inZ = _mm256_and_ps(_mm256_cmp_ps(z, _mm256_set1_ps(minZ), _CMP_GE_OQ),
+                                         _mm256_cmp_ps(z, _mm256_set1_ps(maxZ), _CMP_LE_OQ));
+        return _mm256_and_ps(inR, inZ);
+    }
+#endif
+};
+
+// ============================================================
+// Scalar kernel (referans + tail işleme)
+// ============================================================
+
+template <typename Volume>
+inline void visitScalar(const Volume& volume, const AffineTransform& t, const Vec3& p,
+                        size_t index, Extents& e) noexcept
+{
+    const auto& m = t.m;
+    const float x = m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3];
+    const float y = m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3];
+    const float z = m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3];
+
+    e.minX = std::min(e.minX, x);
+    e.minY = std::min(e.minY, y);
+    e.minZ = std::min(e.minZ, z);
+    e.maxX = std::max(e.maxX, x);
+    e.maxY = std::max(e.maxY, y);
+    e.maxZ = std::max(e.maxZ, z);
+
+    float r2 = 0.0f;
+    if (Volume::RADIAL)
+    {
+        r2 = x * x + y * y;
+        e.maxRadiusSq = std::max(e.maxRadiusSq, r2);
+    }
+
+    if (!volume.inside(x, y, z, r2))
+    {
+        e.addViolation(index, x, y, z);
+    }
+}
+
+template <typename Volume>
+void trianglesScalar(const Volume& volume, const AffineTransform& t, const Triangle* tris,
+                     size_t first, size_t count, Extents& e) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const size_t index = 3 * (first + i);
+        visitScalar(volume, t, tris[i].vertex1, index, e);
+        visitScalar(volume, t, tris[i].vertex2, index + 1, e);
+        visitScalar(volume, t, tris[i].vertex3, index + 2, e);
+    }
+}
+
+template <typename Volume>
+void pointsScalar(const Volume& volume, const AffineTransform& t, const Vec3* points,
+                  size_t first, size_t count, Extents& e) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        visitScalar(volume, t, points[i], first + i, e);
+    }
+}
+
+#if PLATE_CONTAINMENT_X86
+
+// ============================================================
+// SSE2 kernels (4 nokta SoA)
+// ============================================================
+
+struct SseAccumulator
+{
+    __m128 m[12];       // Affine katsayıları (broadcast)
+    __m128 minX, minY, minZ, maxX, maxY, maxZ, maxR2;
+
+    explicit SseAccumulator(const AffineTransform& t)
+    {
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                m[r * 4 + c] = _mm_set1_ps(t.m[r][c]);
+            }
+        }
+        minX = minY = minZ = _mm_set1_ps(FLT_MAX);
+        maxX = maxY = maxZ = _mm_set1_ps(-FLT_MAX);
+        maxR2 = _mm_setzero_ps();
+    }
+
+    void reduce(Extents& e) const
+    {
+        alignas(16) float lanes[7][4];
+        _mm_store_ps(lanes[0], minX);
+        _mm_store_ps(lanes[1], minY);
+        _mm_store_ps(lanes[2], minZ);
+        _mm_store_ps(lanes[3], maxX);
+        _mm_store_ps(lanes[4], maxY);
+        _mm_store_ps(lanes[5], maxZ);
+        _mm_store_ps(lanes[6], maxR2);
+        for (int k = 0; k < 4; ++k)
+        {
+            e.minX = std::min(e.minX, lanes[0][k]);
+            e.minY = std::min(e.minY, lanes[1][k]);
+            e.minZ = std::min(e.minZ, lanes[2][k]);
+            e.maxX = std::max(e.maxX, lanes[3][k]);
+            e.maxY = std::max(e.maxY, lanes[4][k]);
+            e.maxZ = std::max(e.maxZ, lanes[5][k]);
+            e.maxRadiusSq = std::max(e.maxRadiusSq, lanes[6][k]);
+        }
+    }
+};
+
+inline __m128 affineRow(const __m128* m, __m128 x, __m128 y, __m128 z) noexcept
+{
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0], x), _mm_mul_ps(m[1], y)),
+                      _mm_add_ps(_mm_mul_ps(m[2], z), m[3]));
+}
+
+/**
+ * @brief Lane k'nın index'i base + k * step
+ */
+template <typename Volume>
+inline void visitSse2(const Volume& volume, SseAccumulator& acc, __m128 px, __m128 py, __m128 pz,
+                      size_t base, size_t step, Extents& e) noexcept
+{
+    const __m128 x = affineRow(acc.m, px, py, pz);
+    const __m128 y = affineRow(acc.m + 4, px, py, pz);
+    const __m128 z = affineRow(acc.m + 8, px, py, pz);
+
+    acc.minX = _mm_min_ps(acc.minX, x);
+    acc.minY = _mm_min_ps(acc.minY, y);
+    acc.minZ = _mm_min_ps(acc.minZ, z);
+    acc.maxX = _mm_max_ps(acc.maxX, x);
+    acc.maxY = _mm_max_ps(acc.maxY, y);
+    acc.maxZ = _mm_max_ps(acc.maxZ, z);
+
+    __m128 r2 = _mm_setzero_ps();
+    if (Volume::RADIAL)
+    {
+        r2 = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+        acc.maxR2 = _mm_max_ps(acc.maxR2, r2);
+    }
+
+    const int outside = ~_mm_movemask_ps(volume.inside(x, y, z, r2)) & 0xF;
+    if (outside)
+    {
+        alignas(16) float ox[4], oy[4], oz[4];
+        _mm_store_ps(ox, x);
+        _mm_store_ps(oy, y);
+        _mm_store_ps(oz, z);
+        for (int k = 0; k < 4; ++k)
+        {
+            if (outside & (1 << k))
+            {
+                e.addViolation(base + k * step, ox[k], oy[k], oz[k]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief 4 triangle → 12 SoA bileşen (satır = Triangle içindeki float)
+ */
+inline void transpose4(const Triangle* tris, __m128 comp[12]) noexcept
+{
+    for (int row = 0; row < 3; ++row)
+    {
+        __m128 r0 = _mm_loadu_ps(&tris[0].normal.x + row * 4);
+        __m128 r1 = _mm_loadu_ps(&tris[1].normal.x + row * 4);
+        __m128 r2 = _mm_loadu_ps(&tris[2].normal.x + row * 4);
+        __m128 r3 = _mm_loadu_ps(&tris[3].normal.x + row * 4);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        comp[row * 4 + 0] = r0;
+        comp[row * 4 + 1] = r1;
+        comp[row * 4 + 2] = r2;
+        comp[row * 4 + 3] = r3;
+    }
+}
+
+/**
+ * @brief 4 ardışık Vec3 (AoS, 48 byte) → x, y, z (SoA)
+ */
+inline void deinterleave4(const Vec3* points, __m128& x, __m128& y, __m128& z) noexcept
+{
+    const __m128 p0 = _mm_loadu_ps(&points[0].x);    // x0 y0 z0 x1
+    const __m128 p1 = _mm_loadu_ps(&points[0].x + 4);// y1 z1 x2 y2
+    const __m128 p2 = _mm_loadu_ps(&points[0].x + 8);// z2 x3 y3 z3
+
+    const __m128 x23 = _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(1, 0, 3, 2));    // x2 y2 z2 x3
+    x = _mm_shuffle_ps(p0, x23, _MM_SHUFFLE(3, 0, 3, 0));
+
+    const __m128 y01 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(0, 0, 1, 1));    // y0 y0 y1 y1
+    const __m128 y23 = _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(2, 2, 3, 3));    // y2 y2 y3 y3
+    y = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+
+    const __m128 z01 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(1, 1, 2, 2));    // z0 z0 z1 z1
+    const __m128 z23 = _mm_shuffle_ps(p2, p2, _MM_SHUFFLE(3, 3, 0, 0));    // z2 z2 z3 z3
+    z = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+template <typename Volume>
+void trianglesSse2(const Volume& volume, const AffineTransform& t, const Triangle* tris,
+                   size_t first, size_t count, Extents& e) noexcept
+{
+    SseAccumulator acc(t);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 c[12];
+        transpose4(tris + i, c);
+
+        const size_t base = 3 * (first + i);
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            const int row = 3 + 3 * corner;
+            visitSse2(volume, acc, c[row], c[row + 1], c[row + 2], base + corner, 3, e);
+        }
+    }
+
+    acc.reduce(e);
+    trianglesScalar(volume, t, tris + i, first + i, count - i, e);
+}
+
+template <typename Volume>
+void pointsSse2(const Volume& volume, const AffineTransform& t, const Vec3* points,
+                size_t first, size_t count, Extents& e) noexcept
+{
+    SseAccumulator acc(t);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        deinterleave4(points + i, x, y, z);
+        visitSse2(volume, acc, x, y, z, first + i, 1, e);
+    }
+
+    acc.reduce(e);
+    pointsScalar(volume, t, points + i, first + i, count - i, e);
+}
+
+// ============================================================
+// AVX2 + FMA kernels (8 nokta SoA)
+// ============================================================
+
+struct AvxAccumulator
+{
+    __m256 m[12];
+    __m256 minX, minY, minZ, maxX, maxY, maxZ, maxR2;
+
+    PLATE_CONTAINMENT_TARGET_AVX2
+    explicit AvxAccumulator(const AffineTransform& t)
+    {
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                m[r * 4 + c] = _mm256_set1_ps(t.m[r][c]);
+            }
+        }
+        minX = minY = minZ = _mm256_set1_ps(FLT_MAX);
+        maxX = maxY = maxZ = _mm256_set1_ps(-FLT_MAX);
+        maxR2 = _mm256_setzero_ps();
+    }
+
+    PLATE_CONTAINMENT_TARGET_AVX2
+    void reduce(Extents& e) const
+    {
+        alignas(32) float lanes[7][8];
+        _mm256_store_ps(lanes[0], minX);
+        _mm256_store_ps(lanes[1], minY);
+        _mm256_store_ps(lanes[2], minZ);
+        _mm256_store_ps(lanes[3], maxX);
+        _mm256_store_ps(lanes[4], maxY);
+        _mm256_store_ps(lanes[5], maxZ);
+        _mm256_store_ps(lanes[6], maxR2);
+        for (int k = 0; k < 8; ++k)
+        {
+            e.minX = std::min(e.minX, lanes[0][k]);
+            e.minY = std::min(e.minY, lanes[1][k]);
+            e.minZ = std::min(e.minZ, lanes[2][k]);
+            e.maxX = std::max(e.maxX, lanes[3][k]);
+            e.maxY = std::max(e.maxY, lanes[4][k]);
+            e.maxZ = std::max(e.maxZ, lanes[5][k]);
+            e.maxRadiusSq = std::max(e.maxRadiusSq, lanes[6][k]);
+        }
+    }
+};
+
+PLATE_CONTAINMENT_TARGET_AVX2
+inline __m256 combine(__m128 lo, __m128 hi) noexcept
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+}
+
+PLATE_CONTAINMENT_TARGET_AVX2
+inline __m256 affineRow(const __m256* m, __m256 x, __m256 y, __m256 z) noexcept
+{
+    return _mm256_fmadd_ps(m[0], x, _mm256_fmadd_ps(m[1], y, _mm256_fmadd_ps(m[2], z, m[3])));
+}
+
+template <typename Volume>
+PLATE_CONTAINMENT_TARGET_AVX2
+inline void visitAvx2(const Volume& volume, AvxAccumulator& acc, __m256 px, __m256 py, __m256 pz,
+                      size_t base, size_t step, Extents& e) noexcept
+{
+    const __m256 x = affineRow(acc.m, px, py, pz);
+    const __m256 y = affineRow(acc.m + 4, px, py, pz);
+    const __m256 z = affineRow(acc.m + 8, px, py, pz);
+
+    acc.minX = _mm256_min_ps(acc.minX, x);
+    acc.minY = _mm256_min_ps(acc.minY, y);
+    acc.minZ = _mm256_min_ps(acc.minZ, z);
+    acc.maxX = _mm256_max_ps(acc.maxX, x);
+    acc.maxY = _mm256_max_ps(acc.maxY, y);
+    acc.maxZ = _mm256_max_ps(acc.maxZ, z);
+
+    __m256 r2 = _mm256_setzero_ps();
+    if (Volume::RADIAL)
+    {
+        r2 = _mm256_fmadd_ps(x, x, _mm256_mul_ps(y, y));
+        acc.maxR2 = _mm256_max_ps(acc.maxR2, r2);
+    }
+
+    const int outside = ~_mm256_movemask_ps(volume.inside(x, y, z, r2)) & 0xFF;
+    if (outside)
+    {
+        alignas(32) float ox[8], oy[8], oz[8];
+        _mm256_store_ps(ox, x);
+        _mm256_store_ps(oy, y);
+        _mm256_store_ps(oz, z);
+        for (int k = 0; k < 8; ++k)
+        {
+            if (outside & (1 << k))
+            {
+                e.addViolation(base + k * step, ox[k], oy[k], oz[k]);
+            }
+        }
+    }
+}
+
+template <typename Volume>
+PLATE_CONTAINMENT_TARGET_AVX2
+void trianglesAvx2(const Volume& volume, const AffineTransform& t, const Triangle* tris,
+                   size_t first, size_t count, Extents& e) noexcept
+{
+    AvxAccumulator acc(t);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128 lo[12], hi[12];
+        transpose4(tris + i, lo);
+        transpose4(tris + i + 4, hi);
+
+        const size_t base = 3 * (first + i);
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            const int row = 3 + 3 * corner;
+            visitAvx2(volume, acc,
+                      combine(lo[row], hi[row]),
+                      combine(lo[row + 1], hi[row + 1]),
+                      combine(lo[row + 2], hi[row + 2]),
+                      base + corner, 3, e);
+        }
+    }
+
+    acc.reduce(e);
+    trianglesSse2(volume, t, tris + i, first + i, count - i, e);
+}
+
+template <typename Volume>
+PLATE_CONTAINMENT_TARGET_AVX2
+void pointsAvx2(const Volume& volume, const AffineTransform& t, const Vec3* points,
+                size_t first, size_t count, Extents& e) noexcept
+{
+    AvxAccumulator acc(t);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128 x0, y0, z0, x1, y1, z1;
+        deinterleave4(points + i, x0, y0, z0);
+        deinterleave4(points + i + 4, x1, y1, z1);
+        visitAvx2(volume, acc, combine(x0, x1), combine(y0, y1), combine(z0, z1), first + i, 1, e);
+    }
+
+    acc.reduce(e);
+    pointsSse2(volume, t, points + i, first + i, count - i, e);
+}
+
+#endif // PLATE_CONTAINMENT_X86
+
+// ============================================================
+// Dispatch
+// ============================================================
+
+template <typename Volume>
+void scanTriangles(const Volume& volume, const AffineTransform& t, const Triangle* tris,
+                   size_t first, size_t count, Extents& e) noexcept
+{
+    switch (geometry::kernels::activeIsa())
+    {
+#if PLATE_CONTAINMENT_X86
+    case IsaLevel::AVX2: trianglesAvx2(volume, t, tris, first, count, e); break;
+    case IsaLevel::SSE2: trianglesSse2(volume, t, tris, first, count, e); break;
+#endif
+    default:             trianglesScalar(volume, t, tris, first, count, e); break;
+    }
+}
+
+template <typename Volume>
+void scanPoints(const Volume& volume, const AffineTransform& t, const Vec3* points,
+                size_t first, size_t count, Extents& e) noexcept
+{
+    switch (geometry::kernels::activeIsa())
+    {
+#if PLATE_CONTAINMENT_X86
+    case IsaLevel::AVX2: pointsAvx2(volume, t, points, first, count, e); break;
+    case IsaLevel::SSE2: pointsSse2(volume, t, points, first, count, e); break;
+#endif
+    default:             pointsScalar(volume, t, points, first, count, e); break;
+    }
+}
+
+float excess(float amount)
+{
+    return amount > TOLERANCE ? amount : 0.0f;
+}
+
+/**
+ * @brief Tabla tipini bir kez çöz, eleman aralıklarını paralel tara
+ *
+ * scan(volume, first, count, extents) her parça için çağrılır.
+ */
+template <typename Scan>
+ContainmentResult run(parallel::ThreadPool& pool, const BuildPlate& plate,
+                      size_t elementCount, size_t pointsPerElement, size_t chunk, Scan&& scan)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    ContainmentResult result;
+    result.pointCount = elementCount * pointsPerElement;
+
+    const geometry::AABB volumeBounds = plate.bounds();
+    const bool circular = plate.type() == PlateType::Circular;
+
+    std::vector<Extents> partial((elementCount + chunk - 1) / chunk);
+    auto runChunks = [&](const auto& volume) {
+        pool.parallelFor(0, partial.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c)
+            {
+                const size_t first = c * chunk;
+                scan(volume, first, std::min(chunk, elementCount - first), partial[c]);
+            }
+        });
+    };
+
+    if (circular)
+    {
+        const float radius = 0.5f * plate.width() + TOLERANCE;
+        runChunks(CylinderVolume{radius * radius, volumeBounds.min.z - TOLERANCE,
+                                 volumeBounds.max.z + TOLERANCE});
+    }
+    else
+    {
+        runChunks(BoxVolume{volumeBounds.min.x - TOLERANCE, volumeBounds.max.x + TOLERANCE,
+                            volumeBounds.min.y - TOLERANCE, volumeBounds.max.y + TOLERANCE,
+                            volumeBounds.min.z - TOLERANCE, volumeBounds.max.z + TOLERANCE});
+    }
+
+    Extents total;
+    for (const Extents& e : partial)
+    {
+        total.merge(e);
+    }
+
+    result.violationCount = total.violations;
+    result.firstViolation = total.first;
+    result.firstViolationPoint = total.firstPoint;
+    result.bounds.min = Vec3(total.minX, total.minY, total.minZ);
+    result.bounds.max = Vec3(total.maxX, total.maxY, total.maxZ);
+
+    if (result.pointCount > 0)
+    {
+        result.overhangMin.z = excess(volumeBounds.min.z - total.minZ);
+        result.overhangMax.z = excess(total.maxZ - volumeBounds.max.z);
+        if (circular)
+        {
+            result.radialOverhang = excess(std::sqrt(total.maxRadiusSq) - 0.5f * plate.width());
+        }
+        else
+        {
+            result.overhangMin.x = excess(volumeBounds.min.x - total.minX);
+            result.overhangMin.y = excess(volumeBounds.min.y - total.minY);
+            result.overhangMax.x = excess(total.maxX - volumeBounds.max.x);
+            result.overhangMax.y = excess(total.maxY - volumeBounds.max.y);
+        }
+    }
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+} // namespace
+
+float ContainmentResult::maxOverhang() const
+{
+    return std::max({overhangMin.x, overhangMin.y, overhangMin.z,
+                     overhangMax.x, overhangMax.y, overhangMax.z, radialOverhang});
+}
+
+PlateContainment::PlateContainment(parallel::ThreadPool& pool)
+    : pool_(pool)
+{
+}
+
+ContainmentResult PlateContainment::check(const mesh::Mesh& mesh,
+                                          const mesh::ModelTransform& transform,
+                                          const BuildPlate& plate) const
+{
+    const AffineTransform affine = transform.toAffine();
+    const Triangle* tris = mesh.triangles.data();
+
+    return run(pool_, plate, mesh.triangles.size(), 3, TRIANGLE_CHUNK,
+               [&](const auto& volume, size_t first, size_t count, Extents& e) {
+                   scanTriangles(volume, affine, tris + first, first, count, e);
+               });
+}
+
+ContainmentResult PlateContainment::check(const std::vector<geometry::Vec3>& points,
+                                          const mesh::ModelTransform& transform,
+                                          const BuildPlate& plate) const
+{
+    const AffineTransform affine = transform.toAffine();
+    const Vec3* data = points.data();
+
+    return run(pool_, plate, points.size(), 1, POINT_CHUNK,
+               [&](const auto& volume, size_t first, size_t count, Extents& e) {
+                   scanPoints(volume, affine, data + first, first, count, e);
+               });
+}
+
+} // namespace buildplate
+} // namespace core
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "BuildPlate.h"
+#include "core/geometry/aabb.h"
+#include "core/geometry/vec3.h"
+#include "core/mesh/mesh.h"
+#include "core/mesh/MeshTransform.h"
+#include "core/parallel/ThreadPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+namespace buildplate {
+
+/**
+ * @brief Dönüştürülmüş mesh'in baskı hacmine sığma sonucu
+ *
+ * Taşmalar mm cinsindendir ve ≥ 0'dır. Dikdörtgen tablada X/Y taşmaları
+ * ilgili kenardan, dairesel tablada radialOverhang yarıçaptan ölçülür
+ * (X/Y alanları 0 kalır). Z her iki tablada da [0, height] aralığına göre.
+ */
+struct ContainmentResult
+{
+    static constexpr size_t NO_VIOLATION = SIZE_MAX;
+
+    size_t pointCount = 0;
+    size_t violationCount = 0;              // Hacim dışındaki nokta sayısı
+    size_t firstViolation = NO_VIOLATION;   // En küçük index (mesh: 3 * triangle + köşe)
+    geometry::Vec3 firstViolationPoint;     // Dönüştürülmüş konum
+
+    geometry::AABB bounds;                  // Dönüştürülmüş noktaların sınırları
+    geometry::Vec3 overhangMin;             // -X, -Y, -Z yönünde taşma
+    geometry::Vec3 overhangMax;             // +X, +Y, +Z yönünde taşma
+    float radialOverhang = 0.0f;            // Sadece dairesel tabla
+
+    double elapsedMs = 0.0;
+
+    bool fits() const { return violationCount == 0; }
+    float maxOverhang() const;
+};
+
+/**
+ * @brief Toplu baskı hacmi kontrolü (BuildPlate::contains'in vektörize hali)
+ *
+ * Noktalar ModelTransform ile anında dönüştürülür (mesh kopyalanmaz) ve
+ * tek SIMD geçişinde hem hacim testi hem sınır/taşma hesabı yapılır.
+ * Tabla tipi çağrı başına bir kez çözülür; her tip için ayrı şablon
+ * kernel üretilir, nokta başına sanal çağrı yoktur. Komut seti
+ * geometry::kernels::activeIsa() ile seçilir (AVX2 / SSE2 / Scalar).
+ *
+ * Hacim CONTAINMENT_TOLERANCE kadar geniş kabul edilir: tablaya oturan
+ * bir modelin dönüşüm yuvarlaması (z ≈ -1e-6) ihlal sayılmaz.
+ *
+ * Tabla dışbükey olduğu için mesh'in dışbükey zarfının noktaları da
+ * aynı sonucu verir; nokta listesi alan overload bunun içindir.
+ */
+class PlateContainment
+{
+public:
+    static constexpr float CONTAINMENT_TOLERANCE = 1e-3f;   // mm
+
+    explicit PlateContainment(parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    ContainmentResult check(const mesh::Mesh& mesh,
+                            const mesh::ModelTransform& transform,
+                            const BuildPlate& plate) const;
+
+    ContainmentResult check(const std::vector<geometry::Vec3>& points,
+                            const mesh::ModelTransform& transform,
+                            const BuildPlate& plate) const;
+
+private:
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace buildplate
+} // namespace core
@@ -0,0 +1,854 @@
+#include "BVH.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+
+namespace core {
+namespace geometry {
+
+namespace {
+
+constexpr int BIN_COUNT = 16;
+constexpr size_t MIN_SPLIT_SIZE = 4;        // Bu kadar triangle'ı bölmek build'e değmez
+constexpr size_t MAX_LEAF_SIZE = 16;        // SAH daha ucuz bulsa da yaprak bundan büyümez
+constexpr float TRAVERSAL_COST = 1.0f;      // Triangle testine göre bir düğüm ziyareti
+constexpr int MAX_DEPTH = 60;               // Traversal yığını STACK_SIZE'ı aşmasın
+constexpr int STACK_SIZE = 64;
+
+constexpr size_t MIN_TASK_SIZE = 4096;      // Daha küçük alt ağaçlar thread'e değmez
+constexpr size_t PARALLEL_BIN_SIZE = 131072;
+constexpr size_t BIN_CHUNK = 32768;
+
+constexpr float MIN_DIRECTION = 1e-20f;
+constexpr float DET_EPSILON = 1e-12f;
+
+struct Box
+{
+    float min[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+    float max[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+    void grow(const float p[3])
+    {
+        for (int a = 0; a < 3; ++a)
+        {
+            min[a] = std::min(min[a], p[a]);
+            max[a] = std::max(max[a], p[a]);
+        }
+    }
+
+    void grow(const Box& other)
+    {
+        for (int a = 0; a < 3; ++a)
+        {
+            min[a] = std::min(min[a], other.min[a]);
+            max[a] = std::max(max[a], other.max[a]);
+        }
+    }
+
+    float area() const
+    {
+        const float dx = max[0] - min[0];
+        const float dy = max[1] - min[1];
+        const float dz = max[2] - min[2];
+        if (dx < 0.0f)
+        {
+            return 0.0f;    // Boş kutu
+        }
+        return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+};
+
+struct Bin
+{
+    Box box;
+    uint32_t count = 0;
+};
+
+/**
+ * @brief Möller-Trumbore, çift yüzlü; (0, tBest) içinde daha yakınsa true
+ */
+inline bool intersectTriangle(const float o[3], const float d[3],
+                              const float v0[3], const float e1[3], const float e2[3],
+                              float tBest, float& t, float& u, float& v)
+{
+    const float px = d[1] * e2[2] - d[2] * e2[1];
+    const float py = d[2] * e2[0] - d[0] * e2[2];
+    const float pz = d[0] * e2[1] - d[1] * e2[0];
+
+    const float det = e1[0] * px + e1[1] * py + e1[2] * pz;
+    if (std::fabs(det) < DET_EPSILON)
+    {
+        return false;   // Işın yüzeye paralel ya da dejenere triangle
+    }
+    const float inv = 1.0f / det;
+
+    const float sx = o[0] - v0[0];
+    const float sy = o[1] - v0[1];
+    const float sz = o[2] - v0[2];
+
+    u = (sx * px + sy * py + sz * pz) * inv;
+    if (u < 0.0f || u > 1.0f)
+    {
+        return false;
+    }
+
+    const float qx = sy * e1[2] - sz * e1[1];
+    const float qy = sz * e1[0] - sx * e1[2];
+    const float qz = sx * e1[1] - sy * e1[0];
+
+    v = (d[0] * qx + d[1] * qy + d[2] * qz) * inv;
+    if (v < 0.0f || u + v > 1.0f)
+    {
+        return false;
+    }
+
+    t = (e2[0] * qx + e2[1] * qy + e2[2] * qz) * inv;
+    return t > 0.0f && t < tBest;
+}
+
+inline float safeInverse(float d)
+{
+    return 1.0f / (std::fabs(d) < MIN_DIRECTION ? std::copysign(MIN_DIRECTION, d) : d);
+}
+
+/**
+ * @brief Slab testi: kutu (0, tMax) içinde kesiliyor mu
+ */
+inline bool hitsBox(const float nodeMin[3], const float nodeMax[3],
+                    const float o[3], const float inv[3], float tMax)
+{
+    float tNear = 0.0f;
+    float tFar = tMax;
+    for (int a = 0; a < 3; ++a)
+    {
+        const float t1 = (nodeMin[a] - o[a]) * inv[a];
+        const float t2 = (nodeMax[a] - o[a]) * inv[a];
+        tNear = std::max(tNear, std::min(t1, t2));
+        tFar = std::min(tFar, std::max(t1, t2));
+    }
+    return tNear <= tFar;
+}
+
+} // namespace
+
+/**
+ * @brief SAH build durumu (sadece build süresince yaşar)
+ */
+class BVHBuilder
+{
+public:
+    BVHBuilder(const Triangle* triangles, size_t count, parallel::ThreadPool& pool)
+        : source_(triangles)
+        , count_(count)
+        , pool_(pool)
+    {
+    }
+
+    void run(BVH& bvh)
+    {
+        prepare();
+
+        const size_t threads = static_cast<size_t>(pool_.size()) + 1;
+        taskSize_ = std::max(MIN_TASK_SIZE, count_ / (4 * threads));
+
+        const int root = buildTop(0, static_cast<uint32_t>(count_), 0);
+
+        pool_.parallelFor(0, tasks_.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                Task& task = tasks_[i];
+                buildNode(task.nodes, task.begin, task.end, task.depth, task);
+            }
+        });
+
+        bvh.nodes_.clear();
+        bvh.nodes_.reserve(top_.size() + 2 * count_ / 4);
+        emit(root, bvh.nodes_);
+
+        // Triangle'lar yaprak sırasıyla paketlenir
+        bvh.indices_ = std::move(order_);
+        bvh.triangles_.resize(count_);
+        pool_.parallelFor(0, count_, 65536, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const Triangle& tri = source_[bvh.indices_[i]];
+                BVH::PackedTriangle& packed = bvh.triangles_[i];
+                packed.v0[0] = tri.vertex1.x;
+                packed.v0[1] = tri.vertex1.y;
+                packed.v0[2] = tri.vertex1.z;
+                packed.e1[0] = tri.vertex2.x - tri.vertex1.x;
+                packed.e1[1] = tri.vertex2.y - tri.vertex1.y;
+                packed.e1[2] = tri.vertex2.z - tri.vertex1.z;
+                packed.e2[0] = tri.vertex3.x - tri.vertex1.x;
+                packed.e2[1] = tri.vertex3.y - tri.vertex1.y;
+                packed.e2[2] = tri.vertex3.z - tri.vertex1.z;
+            }
+        });
+
+        bvh.stats_.triangles = count_;
+        bvh.stats_.nodes = bvh.nodes_.size();
+        bvh.stats_.leaves = leaves_;
+        bvh.stats_.maxDepth = maxDepth_;
+        for (const Task& task : tasks_)
+        {
+            bvh.stats_.leaves += task.leaves;
+            bvh.stats_.maxDepth = std::max(bvh.stats_.maxDepth, task.maxDepth);
+        }
+    }
+
+private:
+    struct TopNode
+    {
+        BVH::Node node;
+        int left = -1;
+        int right = -1;
+        int task = -1;
+    };
+
+    struct Task
+    {
+        uint32_t begin;
+        uint32_t end;
+        int depth;
+        std::vector<BVH::Node> nodes;
+        size_t leaves = 0;
+        int maxDepth = 0;
+    };
+
+    const Triangle* source_;
+    size_t count_;
+    parallel::ThreadPool& pool_;
+    size_t taskSize_ = MIN_TASK_SIZE;
+
+    std::vector<Box> bounds_;
+    std::vector<float> centroids_;      // 3 / triangle
+    std::vector<uint32_t> order_;
+
+    std::vector<TopNode> top_;
+    std::vector<Task> tasks_;
+    size_t leaves_ = 0;
+    int maxDepth_ = 0;
+
+    void prepare()
+    {
+        bounds_.resize(count_);
+        centroids_.resize(3 * count_);
+        order_.resize(count_);
+
+        pool_.parallelFor(0, count_, 65536, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const Triangle& tri = source_[i];
+                const float p[3][3] = {{tri.vertex1.x, tri.vertex1.y, tri.vertex1.z},
+                                       {tri.vertex2.x, tri.vertex2.y, tri.vertex2.z},
+                                       {tri.vertex3.x, tri.vertex3.y, tri.vertex3.z}};
+                Box box;
+                box.grow(p[0]);
+                box.grow(p[1]);
+                box.grow(p[2]);
+                bounds_[i] = box;
+                for (int a = 0; a < 3; ++a)
+                {
+                    centroids_[3 * i + a] = 0.5f * (box.min[a] + box.max[a]);
+                }
+                order_[i] = static_cast<uint32_t>(i);
+            }
+        });
+    }
+
+    const float* centroid(uint32_t primitive) const { return &centroids_[3 * static_cast<size_t>(primitive)]; }
+
+    /**
+     * @brief Aralığın kutusu ve ağırlık merkezi kutusu (büyük aralıklarda paralel)
+     */
+    void measure(uint32_t begin, uint32_t end, Box& box, Box& centers) const
+    {
+        auto scan = [&](uint32_t from, uint32_t to, Box& b, Box& c) {
+            for (uint32_t i = from; i < to; ++i)
+            {
+                b.grow(bounds_[order_[i]]);
+                c.grow(centroid(order_[i]));
+            }
+        };
+
+        if (end - begin < PARALLEL_BIN_SIZE)
+        {
+            scan(begin, end, box, centers);
+            return;
+        }
+
+        const size_t chunks = (end - begin + BIN_CHUNK - 1) / BIN_CHUNK;
+        std::vector<Box> boxes(chunks);
+        std::vector<Box> centerBoxes(chunks);
+        pool_.parallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+            for (size_t c = first; c < last; ++c)
+            {
+                const uint32_t from = begin + static_cast<uint32_t>(c * BIN_CHUNK);
+                scan(from, std::min<uint32_t>(end, from + static_cast<uint32_t>(BIN_CHUNK)),
+                     boxes[c], centerBoxes[c]);
+            }
+        });
+        for (size_t c = 0; c < chunks; ++c)
+        {
+            box.grow(boxes[c]);
+            centers.grow(centerBoxes[c]);
+        }
+    }
+
+    /**
+     * @brief Üç eksende kutulama (büyük aralıklarda paralel)
+     */
+    void fillBins(uint32_t begin, uint32_t end, const Box& centers, const float scale[3],
+                  Bin bins[3][BIN_COUNT]) const
+    {
+        auto scan = [&](uint32_t from, uint32_t to, auto& local) {
+            for (uint32_t i = from; i < to; ++i)
+            {
+                const float* c = centroid(order_[i]);
+                for (int a = 0; a < 3; ++a)
+                {
+                    const int bin = std::min(BIN_COUNT - 1, static_cast<int>((c[a] - centers.min[a]) * scale[a]));
+                    local[a][bin].box.grow(bounds_[order_[i]]);
+                    local[a][bin].count++;
+                }
+            }
+        };
+
+        if (end - begin < PARALLEL_BIN_SIZE)
+        {
+            scan(begin, end, bins);
+            return;
+        }
+
+        const size_t chunks = (end - begin + BIN_CHUNK - 1) / BIN_CHUNK;
+        std::vector<std::array<std::array<Bin, BIN_COUNT>, 3>> partial(chunks);
+        pool_.parallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+            for (size_t c = first; c < last; ++c)
+            {
+                const uint32_t from = begin + static_cast<uint32_t>(c * BIN_CHUNK);
+                scan(from, std::min<uint32_t>(end, from + static_cast<uint32_t>(BIN_CHUNK)), partial[c]);
+            }
+        });
+        for (const auto& chunk : partial)
+        {
+            for (int a = 0; a < 3; ++a)
+            {
+                for (int b = 0; b < BIN_COUNT; ++b)
+                {
+                    bins[a][b].box.grow(chunk[a][b].box);
+                    bins[a][b].count += chunk[a][b].count;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief SAH bölmesi; yaprak kalması daha iyiyse false
+     */
+    bool split(uint32_t begin, uint32_t end, int depth, Box& box, int& axis, uint32_t& mid)
+    {
+        const size_t n = end - begin;
+
+        Box centers;
+        measure(begin, end, box, centers);
+
+        if (n <= MIN_SPLIT_SIZE || (depth >= MAX_DEPTH && n <= UINT16_MAX))
+        {
+            return false;
+        }
+
+        float scale[3];
+        bool separable = false;
+        for (int a = 0; a < 3; ++a)
+        {
+            const float extent = centers.max[a] - centers.min[a];
+            scale[a] = extent > 0.0f ? BIN_COUNT / extent * (1.0f - 1e-6f) : 0.0f;
+            separable |= extent > 0.0f;
+        }
+
+        if (!separable)
+        {
+            // Tüm merkezler aynı noktada: SAH ayıramaz
+            if (n <= MAX_LEAF_SIZE)
+            {
+                return false;
+            }
+            axis = 0;
+            mid = begin + static_cast<uint32_t>(n / 2);
+            return true;
+        }
+
+        Bin bins[3][BIN_COUNT];
+        fillBins(begin, end, centers, scale, bins);
+
+        float bestCost = FLT_MAX;
+        int bestBin = -1;
+        for (int a = 0; a < 3; ++a)
+        {
+            if (scale[a] == 0.0f)
+            {
+                continue;
+            }
+
+            // Soldan birikimli alan * sayı, sağdan süpürürken karşılaştır
+            float leftCost[BIN_COUNT - 1];
+            Box left;
+            uint32_t leftCount = 0;
+            for (int b = 0; b < BIN_COUNT - 1; ++b)
+            {
+                left.grow(bins[a][b].box);
+                leftCount += bins[a][b].count;
+                leftCost[b] = left.area() * leftCount;
+            }
+
+            Box right;
+            uint32_t rightCount = 0;
+            for (int b = BIN_COUNT - 1; b > 0; --b)
+            {
+                right.grow(bins[a][b].box);
+                rightCount += bins[a][b].count;
+                if (rightCount == 0 || rightCount == n)
+                {
+                    continue;
+                }
+                const float cost = leftCost[b - 1] + right.area() * rightCount;
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestBin = b;
+                    axis = a;
+                }
+            }
+        }
+
+        const float area = box.area();
+        const float splitCost = TRAVERSAL_COST + (area > 0.0f ? bestCost / area : 0.0f);
+        if (bestBin < 0 || (splitCost >= static_cast<float>(n) && n <= MAX_LEAF_SIZE))
+        {
+            if (n <= MAX_LEAF_SIZE)
+            {
+                return false;
+            }
+            axis = 0;
+            mid = begin + static_cast<uint32_t>(n / 2);
+            return true;
+        }
+
+        const int a = axis;
+        const float minimum = centers.min[a];
+        const float s = scale[a];
+        uint32_t* middle = std::partition(
+            order_.data() + begin, order_.data() + end,
+            [&](uint32_t primitive) {
+                return std::min(BIN_COUNT - 1, static_cast<int>((centroid(primitive)[a] - minimum) * s)) < bestBin;
+            });
+        mid = static_cast<uint32_t>(middle - order_.data());
+
+        if (mid == begin || mid == end)
+        {
+            mid = begin + static_cast<uint32_t>(n / 2);
+        }
+        return true;
+    }
+
+    uint32_t buildNode(std::vector<BVH::Node>& nodes, uint32_t begin, uint32_t end, int depth, Task& task)
+    {
+        const uint32_t index = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+
+        Box box;
+        int axis = 0;
+        uint32_t mid = 0;
+        const bool interior = split(begin, end, depth, box, axis, mid);
+
+        BVH::Node& node = nodes[index];
+        std::copy(box.min, box.min + 3, node.min);
+        std::copy(box.max, box.max + 3, node.max);
+        task.maxDepth = std::max(task.maxDepth, depth);
+
+        if (!interior)
+        {
+            node.offset = begin;
+            node.count = static_cast<uint16_t>(end - begin);
+            node.axis = 0;
+            task.leaves++;
+            return index;
+        }
+
+        node.count = 0;
+        node.axis = static_cast<uint16_t>(axis);
+
+        buildNode(nodes, begin, mid, depth + 1, task);
+        const uint32_t right = buildNode(nodes, mid, end, depth + 1, task);
+        nodes[index].offset = right;
+        return index;
+    }
+
+    /**
+     * @brief Üst seviye (sıralı); küçük aralıklar paralel görev olur
+     */
+    int buildTop(uint32_t begin, uint32_t end, int depth)
+    {
+        const int index = static_cast<int>(top_.size());
+        top_.emplace_back();
+
+        if (end - begin <= taskSize_)
+        {
+            top_[index].task = static_cast<int>(tasks_.size());
+            tasks_.push_back(Task{begin, end, depth, {}, 0, 0});
+            return index;
+        }
+
+        Box box;
+        int axis = 0;
+        uint32_t mid = 0;
+        const bool interior = split(begin, end, depth, box, axis, mid);
+
+        BVH::Node node;
+        std::copy(box.min, box.min + 3, node.min);
+        std::copy(box.max, box.max + 3, node.max);
+        node.offset = begin;
+        node.count = interior ? 0 : static_cast<uint16_t>(end - begin);
+        node.axis = static_cast<uint16_t>(interior ? axis : 0);
+        top_[index].node = node;
+        maxDepth_ = std::max(maxDepth_, depth);
+
+        if (!interior)
+        {
+            leaves_++;
+            return index;
+        }
+
+        const int left = buildTop(begin, mid, depth + 1);
+        const int right = buildTop(mid, end, depth + 1);
+        top_[index].left = left;
+        top_[index].right = right;
+        return index;
+    }
+
+    /**
+     * @brief Üst ağacı ve görev alt ağaçlarını derinlik-öncelikli tek diziye yaz
+     */
+    void emit(int index, std::vector<BVH::Node>& out) const
+    {
+        const TopNode& top = top_[index];
+
+        if (top.task >= 0)
+        {
+            const uint32_t base = static_cast<uint32_t>(out.size());
+            for (BVH::Node node : tasks_[top.task].nodes)
+            {
+                if (node.count == 0)
+                {
+                    node.offset += base;
+                }
+                out.push_back(node);
+            }
+            return;
+        }
+
+        const size_t position = out.size();
+        out.push_back(top.node);
+        if (top.left < 0)
+        {
+            return;     // Yaprak
+        }
+
+        emit(top.left, out);
+        out[position].offset = static_cast<uint32_t>(out.size());
+        emit(top.right, out);
+    }
+};
+
+void BVH::build(const Triangle* triangles, size_t count, parallel::ThreadPool& pool)
+{
+    clear();
+    if (count == 0)
+    {
+        return;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    BVHBuilder builder(triangles, count, pool);
+    builder.run(*this);
+
+    const auto endTime = std::chrono::steady_clock::now();
+    stats_.buildMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+}
+
+void BVH::clear()
+{
+    nodes_.clear();
+    triangles_.clear();
+    indices_.clear();
+    stats_ = Stats{};
+}
+
+bool BVH::intersect(const Ray& ray, RayHit& hit, float tMax) const
+{
+    if (nodes_.empty())
+    {
+        return false;
+    }
+
+    const float o[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+    const float d[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+    const float inv[3] = {safeInverse(d[0]), safeInverse(d[1]), safeInverse(d[2])};
+
+    float best = std::min(tMax, hit.t);
+    uint32_t bestTriangle = RayHit::NO_HIT;
+    float bestU = 0.0f;
+    float bestV = 0.0f;
+
+    uint32_t stack[STACK_SIZE];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const uint32_t index = stack[--top];
+        const Node& node = nodes_[index];
+
+        if (!hitsBox(node.min, node.max, o, inv, best))
+        {
+            continue;
+        }
+
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+            {
+                const PackedTriangle& tri = triangles_[i];
+                float t, u, v;
+                if (intersectTriangle(o, d, tri.v0, tri.e1, tri.e2, best, t, u, v))
+                {
+                    best = t;
+                    bestTriangle = i;
+                    bestU = u;
+                    bestV = v;
+                }
+            }
+            continue;
+        }
+
+        // Yakın çocuk son itilir, önce işlenir
+        const bool negative = d[node.axis] < 0.0f;
+        stack[top++] = negative ? index + 1 : node.offset;
+        stack[top++] = negative ? node.offset : index + 1;
+    }
+
+    if (bestTriangle == RayHit::NO_HIT)
+    {
+        return false;
+    }
+
+    hit.t = best;
+    hit.triangle = indices_[bestTriangle];
+    hit.u = bestU;
+    hit.v = bestV;
+    return true;
+}
+
+bool BVH::occluded(const Ray& ray, float tMax) const
+{
+    if (nodes_.empty())
+    {
+        return false;
+    }
+
+    const float o[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+    const float d[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+    const float inv[3] = {safeInverse(d[0]), safeInverse(d[1]), safeInverse(d[2])};
+
+    uint32_t stack[STACK_SIZE];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const uint32_t index = stack[--top];
+        const Node& node = nodes_[index];
+        if (!hitsBox(node.min, node.max, o, inv, tMax))
+        {
+            continue;
+        }
+
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+            {
+                const PackedTriangle& tri = triangles_[i];
+                float t, u, v;
+                if (intersectTriangle(o, d, tri.v0, tri.e1, tri.e2, tMax, t, u, v))
+                {
+                    return true;
+                }
+            }
+            continue;
+        }
+
+        stack[top++] = node.offset;
+        stack[top++] = index + 1;
+    }
+
+    return false;
+}
+
+void BVH::intersect(const Ray* rays, RayHit* hits, size_t count) const
+{
+    for (size_t first = 0; first < count; first += PACKET_SIZE)
+    {
+        intersectPacket(rays + first, hits + first, std::min(PACKET_SIZE, count - first));
+    }
+}
+
+void BVH::intersectPacket(const Ray* rays, RayHit* hits, size_t count) const
+{
+    if (nodes_.empty())
+    {
+        return;
+    }
+
+    // SoA: düğüm testi tüm şeritlerde aynı döngü (vektörleşebilir)
+    float o[PACKET_SIZE][3];
+    float d[PACKET_SIZE][3];
+    float inv[PACKET_SIZE][3];
+    float best[PACKET_SIZE];
+    uint32_t bestTriangle[PACKET_SIZE];
+    float bestU[PACKET_SIZE];
+    float bestV[PACKET_SIZE];
+
+    for (size_t r = 0; r < count; ++r)
+    {
+        o[r][0] = rays[r].origin.x;
+        o[r][1] = rays[r].origin.y;
+        o[r][2] = rays[r].origin.z;
+        d[r][0] = rays[r].direction.x;
+        d[r][1] = rays[r].direction.y;
+        d[r][2] = rays[r].direction.z;
+        for (int a = 0; a < 3; ++a)
+        {
+            inv[r][a] = safeInverse(d[r][a]);
+        }
+        best[r] = hits[r].t;
+        bestTriangle[r] = RayHit::NO_HIT;
+        bestU[r] = bestV[r] = 0.0f;
+    }
+
+    uint32_t stack[STACK_SIZE];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const uint32_t index = stack[--top];
+        const Node& node = nodes_[index];
+
+        bool any = false;
+        for (size_t r = 0; r < count && !any; ++r)
+        {
+            any = hitsBox(node.min, node.max, o[r], inv[r], best[r]);
+        }
+        if (!any)
+        {
+            continue;
+        }
+
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+            {
+                const PackedTriangle& tri = triangles_[i];
+                for (size_t r = 0; r < count; ++r)
+                {
+                    float t, u, v;
+                    if (intersectTriangle(o[r], d[r], tri.v0, tri.e1, tri.e2, best[r], t, u, v))
+                    {
+                        best[r] = t;
+                        bestTriangle[r] = i;
+                        bestU[r] = u;
+                        bestV[r] = v;
+                    }
+                }
+            }
+            continue;
+        }
+
+        // Sıralama ilk ışının yönüne göre (demet uyumlu varsayılır)
+        const bool negative = d[0][node.axis] < 0.0f;
+        stack[top++] = negative ? index + 1 : node.offset;
+        stack[top++] = negative ? node.offset : index + 1;
+    }
+
+    for (size_t r = 0; r < count; ++r)
+    {
+        if (bestTriangle[r] != RayHit::NO_HIT)
+        {
+            hits[r].t = best[r];
+            hits[r].triangle = indices_[bestTriangle[r]];
+            hits[r].u = bestU[r];
+            hits[r].v = bestV[r];
+        }
+    }
+}
+
+void BVH::overlapping(const AABB& box, std::vector<uint32_t>& out) const
+{
+    if (nodes_.empty())
+    {
+        return;
+    }
+
+    const float boxMin[3] = {box.min.x, box.min.y, box.min.z};
+    const float boxMax[3] = {box.max.x, box.max.y, box.max.z};
+
+    auto overlaps = [&](const float lo[3], const float hi[3]) {
+        return lo[0] <= boxMax[0] && hi[0] >= boxMin[0] &&
+               lo[1] <= boxMax[1] && hi[1] >= boxMin[1] &&
+               lo[2] <= boxMax[2] && hi[2] >= boxMin[2];
+    };
+
+    uint32_t stack[STACK_SIZE];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const uint32_t index = stack[--top];
+        const Node& node = nodes_[index];
+        if (!overlaps(node.min, node.max))
+        {
+            continue;
+        }
+
+        if (node.count > 0)
+        {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i)
+            {
+                const PackedTriangle& tri = triangles_[i];
+                float lo[3];
+                float hi[3];
+                for (int a = 0; a < 3; ++a)
+                {
+                    const float p1 = tri.v0[a] + tri.e1[a];
+                    const float p2 = tri.v0[a] + tri.e2[a];
+                    lo[a] = std::min({tri.v0[a], p1, p2});
+                    hi[a] = std::max({tri.v0[a], p1, p2});
+                }
+                if (overlaps(lo, hi))
+                {
+                    out.push_back(indices_[i]);
+                }
+            }
+            continue;
+        }
+
+        stack[top++] = node.offset;
+        stack[top++] = index + 1;
+    }
+}
+
+} // namespace geometry
+} // namespace core
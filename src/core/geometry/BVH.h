@@ -0,0 +1,135 @@
+#pragma once
+
+#include "core/geometry/triangle.h"
+#include "core/geometry/aabb.h"
+#include "core/parallel/ThreadPool.h"
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+namespace geometry {
+
+/**
+ * @brief Işın: origin + t * direction (direction normalize olmak zorunda değil)
+ */
+struct Ray
+{
+    Vec3 origin;
+    Vec3 direction;
+};
+
+struct RayHit
+{
+    static constexpr uint32_t NO_HIT = 0xFFFFFFFFu;
+
+    float t = FLT_MAX;              // direction uzunluğu birimiyle
+    uint32_t triangle = NO_HIT;     // Build'e verilen dizideki index
+    float u = 0.0f;                 // Barycentric (vertex2, vertex3 ağırlıkları)
+    float v = 0.0f;
+
+    bool hit() const { return triangle != NO_HIT; }
+
+    Vec3 point(const Ray& ray) const
+    {
+        return Vec3(ray.origin.x + t * ray.direction.x,
+                    ray.origin.y + t * ray.direction.y,
+                    ray.origin.z + t * ray.direction.z);
+    }
+};
+
+/**
+ * @brief Triangle'lar üzerinde SAH'lı bounding volume hierarchy
+ *
+ * Picking, self-intersection ve destek ışınları için ortak hızlandırıcı.
+ *
+ * Build:
+ *  - Her düğümde üç eksende 16 kutulu (binned) SAH; bölmek yaprak kalmaktan
+ *    pahalıysa yaprak (en çok 16 triangle).
+ *  - Üst seviyeler sırayla bölünür; yeterince küçük alt ağaçlar thread
+ *    pool'da paralel kurulur ve tek diziye dikilir.
+ *
+ * Düzen: düğümler derinlik-öncelikli düz dizide (32 byte): sol çocuk hemen
+ * arkadadır, sadece sağ çocuğun index'i tutulur. Triangle'lar yaprak
+ * sırasıyla (v0, e1, e2) olarak yeniden paketlenir; traversal orijinal
+ * Triangle dizisine dokunmaz (build sonrası serbest bırakılabilir).
+ *
+ * Sorgular thread-safe'tir (salt okunur).
+ */
+class BVH
+{
+public:
+    struct Stats
+    {
+        size_t triangles = 0;
+        size_t nodes = 0;
+        size_t leaves = 0;
+        int maxDepth = 0;
+        double buildMs = 0.0;
+    };
+
+    // Paket traversal'da birlikte yürüyen ışın sayısı
+    static constexpr size_t PACKET_SIZE = 8;
+
+    BVH() = default;
+
+    void build(const Triangle* triangles, size_t count,
+               parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    void clear();
+
+    bool empty() const { return nodes_.empty(); }
+    const Stats& stats() const { return stats_; }
+
+    /**
+     * @brief En yakın kesişim (çift yüzlü); tMax'tan uzaktakiler yok sayılır
+     */
+    bool intersect(const Ray& ray, RayHit& hit, float tMax = FLT_MAX) const;
+
+    /**
+     * @brief (0, tMax) aralığında herhangi bir kesişim var mı (ilk bulunanda durur)
+     */
+    bool occluded(const Ray& ray, float tMax = FLT_MAX) const;
+
+    /**
+     * @brief Işın demeti: PACKET_SIZE'lık gruplar ortak yığınla yürür
+     *
+     * Uyumlu ışınlar (aynı noktadan ya da paralel ızgara, örn. destek
+     * ışınları) düğüm kutularını paylaşır; her düğüm bir kez okunur.
+     */
+    void intersect(const Ray* rays, RayHit* hits, size_t count) const;
+
+    /**
+     * @brief Kutuyla örtüşen triangle'lar (aday listesi, kesin test çağıranda)
+     */
+    void overlapping(const AABB& box, std::vector<uint32_t>& out) const;
+
+private:
+    struct Node
+    {
+        float min[3];
+        uint32_t offset;        // İç düğüm: sağ çocuk; yaprak: ilk triangle
+        float max[3];
+        uint16_t count;         // 0 = iç düğüm
+        uint16_t axis;          // İç düğüm bölme ekseni (yakın çocuk önce)
+    };
+
+    struct PackedTriangle
+    {
+        float v0[3];
+        float e1[3];
+        float e2[3];
+    };
+
+    std::vector<Node> nodes_;
+    std::vector<PackedTriangle> triangles_;     // Yaprak sırasıyla
+    std::vector<uint32_t> indices_;             // Yaprak sırası → orijinal index
+    Stats stats_;
+
+    void intersectPacket(const Ray* rays, RayHit* hits, size_t count) const;
+
+    friend class BVHBuilder;
+};
+
+} // namespace geometry
+} // namespace core
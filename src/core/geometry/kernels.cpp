@@ -0,0 +1,1099 @@
+#include "core/geometry/kernels.h"
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CORE_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define CORE_KERNELS_TARGET_AVX2
+#else
+#define CORE_KERNELS_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#else
+#define CORE_KERNELS_X86 0
+#endif
+
+namespace core {
+namespace geometry {
+namespace kernels {
+
+// SIMD kernel'ler Triangle'ı 12 float'lık düz bir dizi olarak okur:
+// [nx ny nz | v1x v1y v1z | v2x v2y v2z | v3x v3y v3z]
+static_assert(std::is_standard_layout<Triangle>::value, "Triangle must be standard layout");
+static_assert(sizeof(Triangle) == 12 * sizeof(float), "Triangle must be 12 packed floats");
+static_assert(offsetof(Triangle, normal) == 0, "unexpected Triangle layout");
+static_assert(offsetof(Triangle, vertex1) == 3 * sizeof(float), "unexpected Triangle layout");
+static_assert(offsetof(Triangle, vertex2) == 6 * sizeof(float), "unexpected Triangle layout");
+static_assert(offsetof(Triangle, vertex3) == 9 * sizeof(float), "unexpected Triangle layout");
+
+namespace {
+
+constexpr float DEGENERATE_LENGTH = 1e-8f;
+
+// ============================================================
+// CPU detection
+// ============================================================
+
+IsaLevel detectIsaOnce() noexcept
+{
+#if CORE_KERNELS_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {0, 0, 0, 0};
+    __cpuid(info, 0);
+    if (info[0] >= 7)
+    {
+        __cpuid(info, 1);
+        const bool fma = (info[2] & (1 << 12)) != 0;
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+
+        __cpuidex(info, 7, 0);
+        const bool avx2 = (info[1] & (1 << 5)) != 0;
+
+        if (fma && osxsave && avx && avx2 && (_xgetbv(0) & 0x6) == 0x6)
+        {
+            return IsaLevel::AVX2;
+        }
+    }
+    return IsaLevel::SSE2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return IsaLevel::AVX2;
+    }
+    return IsaLevel::SSE2;
+#endif
+#else
+    return IsaLevel::Scalar;
+#endif
+}
+
+std::atomic<int>& isaOverride()
+{
+    static std::atomic<int> value{-1};  // -1 = override yok
+    return value;
+}
+
+// ============================================================
+// Scalar kernels (referans + tail işleme)
+// ============================================================
+
+void boundsScalar(const Triangle* tris, size_t count, AABB& box) noexcept
+{
+    auto update = [&](const Vec3& v)
+    {
+        box.min.x = std::min(box.min.x, v.x);
+        box.min.y = std::min(box.min.y, v.y);
+        box.min.z = std::min(box.min.z, v.z);
+
+        box.max.x = std::max(box.max.x, v.x);
+        box.max.y = std::max(box.max.y, v.y);
+        box.max.z = std::max(box.max.z, v.z);
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        update(tris[i].vertex1);
+        update(tris[i].vertex2);
+        update(tris[i].vertex3);
+    }
+}
+
+// Normal matrisi: linear kısmın cofactor'ü (= det * inverse-transpose).
+// Sadece yön önemli olduğu için det ile bölmek yerine işaretini uyguluyoruz.
+void normalMatrix(const AffineTransform& t, float n[3][3]) noexcept
+{
+    const auto& m = t.m;
+
+    n[0][0] = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    n[0][1] = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    n[0][2] = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+
+    n[1][0] = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+    n[1][1] = m[0][0] * m[2][2] - m[0][2] * m[2][0];
+    n[1][2] = m[0][1] * m[2][0] - m[0][0] * m[2][1];
+
+    n[2][0] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+    n[2][1] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+    n[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+
+    const float det = m[0][0] * n[0][0] + m[0][1] * n[0][1] + m[0][2] * n[0][2];
+    if (det < 0.0f)
+    {
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                n[r][c] = -n[r][c];
+            }
+        }
+    }
+}
+
+void transformScalar(Triangle* tris, size_t count, const AffineTransform& t) noexcept
+{
+    float n[3][3];
+    normalMatrix(t, n);
+    const auto& m = t.m;
+
+    auto point = [&](Vec3& v)
+    {
+        const float x = v.x, y = v.y, z = v.z;
+        v.x = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3];
+        v.y = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3];
+        v.z = m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3];
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Triangle& tri = tris[i];
+        point(tri.vertex1);
+        point(tri.vertex2);
+        point(tri.vertex3);
+
+        const Vec3 src = tri.normal;
+        Vec3 dst(n[0][0] * src.x + n[0][1] * src.y + n[0][2] * src.z,
+                 n[1][0] * src.x + n[1][1] * src.y + n[1][2] * src.z,
+                 n[2][0] * src.x + n[2][1] * src.y + n[2][2] * src.z);
+
+        const float len = std::sqrt(dst.x * dst.x + dst.y * dst.y + dst.z * dst.z);
+        if (len > 1e-12f)
+        {
+            dst.x /= len;
+            dst.y /= len;
+            dst.z /= len;
+        }
+        tri.normal = dst;
+    }
+}
+
+void normalsAreasScalar(const Triangle* tris, size_t count,
+                        Vec3* outNormals, float* outAreas) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Triangle& tri = tris[i];
+
+        const float dx1 = tri.vertex2.x - tri.vertex1.x;
+        const float dy1 = tri.vertex2.y - tri.vertex1.y;
+        const float dz1 = tri.vertex2.z - tri.vertex1.z;
+
+        const float dx2 = tri.vertex3.x - tri.vertex1.x;
+        const float dy2 = tri.vertex3.y - tri.vertex1.y;
+        const float dz2 = tri.vertex3.z - tri.vertex1.z;
+
+        const float cx = dy1 * dz2 - dz1 * dy2;
+        const float cy = dz1 * dx2 - dx1 * dz2;
+        const float cz = dx1 * dy2 - dy1 * dx2;
+
+        const float len = std::sqrt(cx * cx + cy * cy + cz * cz);
+
+        if (outAreas)
+        {
+            outAreas[i] = 0.5f * len;
+        }
+
+        if (outNormals)
+        {
+            outNormals[i] = (len < DEGENERATE_LENGTH)
+                ? Vec3(0.0f, 0.0f, 1.0f)
+                : Vec3(cx / len, cy / len, cz / len);
+        }
+    }
+}
+
+void linesAtYScalar(const double* ox, const double* oy, const double* slope,
+                    size_t count, double y, double* out) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = ox[i] + (y - oy[i]) * slope[i];
+    }
+}
+
+// SoA kernel'leri [begin, count) aralığını işler; SIMD sürümler kalanı buraya bırakır
+
+void minMaxScalar(const float* values, size_t begin, size_t count, float& mn, float& mx) noexcept
+{
+    for (size_t i = begin; i < count; ++i)
+    {
+        mn = std::min(mn, values[i]);
+        mx = std::max(mx, values[i]);
+    }
+}
+
+void rangesZScalar(const TriangleArrays& t, size_t begin, float* outMin, float* outMax) noexcept
+{
+    for (size_t i = begin; i < t.count; ++i)
+    {
+        const float a = t.z[0][i], b = t.z[1][i], c = t.z[2][i];
+        outMin[i] = std::min(a, std::min(b, c));
+        outMax[i] = std::max(a, std::max(b, c));
+    }
+}
+
+size_t crossingsScalar(const TriangleArrays& t, size_t begin, float threshold, uint32_t* out) noexcept
+{
+    size_t n = 0;
+    for (size_t i = begin; i < t.count; ++i)
+    {
+        const int above = (t.z[0][i] > threshold ? 1 : 0) +
+                          (t.z[1][i] > threshold ? 1 : 0) +
+                          (t.z[2][i] > threshold ? 1 : 0);
+        if (above == 1 || above == 2)
+        {
+            out[n++] = static_cast<uint32_t>(i);
+        }
+    }
+    return n;
+}
+
+void sumsScalar(const TriangleArrays& t, size_t begin, TriangleArraySums& sums) noexcept
+{
+    for (size_t i = begin; i < t.count; ++i)
+    {
+        const float x0 = t.x[0][i], y0 = t.y[0][i], z0 = t.z[0][i];
+        const float x1 = t.x[1][i], y1 = t.y[1][i], z1 = t.z[1][i];
+        const float x2 = t.x[2][i], y2 = t.y[2][i], z2 = t.z[2][i];
+
+        const float ax = x1 - x0, ay = y1 - y0, az = z1 - z0;
+        const float bx = x2 - x0, by = y2 - y0, bz = z2 - z0;
+        const float cx = ay * bz - az * by;
+        const float cy = az * bx - ax * bz;
+        const float cz = ax * by - ay * bx;
+        sums.area += 0.5 * std::sqrt(cx * cx + cy * cy + cz * cz);
+
+        const float qx = y1 * z2 - z1 * y2;
+        const float qy = z1 * x2 - x1 * z2;
+        const float qz = x1 * y2 - y1 * x2;
+        sums.signedVolume += (x0 * qx + y0 * qy + z0 * qz) / 6.0;
+
+        sums.sumX += static_cast<double>(x0) + x1 + x2;
+        sums.sumY += static_cast<double>(y0) + y1 + y2;
+        sums.sumZ += static_cast<double>(z0) + z1 + z2;
+    }
+}
+
+#if CORE_KERNELS_X86
+
+// ============================================================
+// SSE2 kernels
+// ============================================================
+
+// Bir triangle'ın 3 vertex'ini 3 register'a yükle.
+// Lane 3 çöp içerir (min/max'ta yok sayılır); okumalar triangle içinde kalır.
+inline void loadVertices(const Triangle& tri, __m128& a, __m128& b, __m128& c) noexcept
+{
+    const float* p = &tri.vertex1.x;
+    a = _mm_loadu_ps(p);        // v1x v1y v1z v2x
+    b = _mm_loadu_ps(p + 3);    // v2x v2y v2z v3x
+    c = _mm_loadu_ps(p + 5);    // v2z v3x v3y v3z
+    c = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 2, 1));  // v3x v3y v3z v3z
+}
+
+inline void storeBounds(__m128 mn, __m128 mx, AABB& box) noexcept
+{
+    alignas(16) float lo[4];
+    alignas(16) float hi[4];
+    _mm_store_ps(lo, mn);
+    _mm_store_ps(hi, mx);
+
+    box.min = Vec3(std::min(box.min.x, lo[0]), std::min(box.min.y, lo[1]), std::min(box.min.z, lo[2]));
+    box.max = Vec3(std::max(box.max.x, hi[0]), std::max(box.max.y, hi[1]), std::max(box.max.z, hi[2]));
+}
+
+void boundsSse2(const Triangle* tris, size_t count, AABB& box) noexcept
+{
+    __m128 mn0 = _mm_set1_ps(FLT_MAX), mx0 = _mm_set1_ps(-FLT_MAX);
+    __m128 mn1 = mn0, mx1 = mx0;
+
+    size_t i = 0;
+    // 2'li unroll: iki bağımsız accumulator zinciri
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128 a0, b0, c0, a1, b1, c1;
+        loadVertices(tris[i], a0, b0, c0);
+        loadVertices(tris[i + 1], a1, b1, c1);
+
+        mn0 = _mm_min_ps(mn0, _mm_min_ps(a0, _mm_min_ps(b0, c0)));
+        mx0 = _mm_max_ps(mx0, _mm_max_ps(a0, _mm_max_ps(b0, c0)));
+        mn1 = _mm_min_ps(mn1, _mm_min_ps(a1, _mm_min_ps(b1, c1)));
+        mx1 = _mm_max_ps(mx1, _mm_max_ps(a1, _mm_max_ps(b1, c1)));
+    }
+
+    storeBounds(_mm_min_ps(mn0, mn1), _mm_max_ps(mx0, mx1), box);
+    boundsScalar(tris + i, count - i, box);
+}
+
+inline __m128 splat(__m128 v, int lane) noexcept
+{
+    switch (lane)
+    {
+    case 0:  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+    case 1:  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+    default: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+    }
+}
+
+struct SseColumns
+{
+    __m128 c0, c1, c2, c3;     // affine kolonları
+    __m128 n0, n1, n2;         // normal matrisi kolonları
+};
+
+SseColumns makeColumns(const AffineTransform& t) noexcept
+{
+    float n[3][3];
+    normalMatrix(t, n);
+    const auto& m = t.m;
+
+    SseColumns cols;
+    cols.c0 = _mm_setr_ps(m[0][0], m[1][0], m[2][0], 0.0f);
+    cols.c1 = _mm_setr_ps(m[0][1], m[1][1], m[2][1], 0.0f);
+    cols.c2 = _mm_setr_ps(m[0][2], m[1][2], m[2][2], 0.0f);
+    cols.c3 = _mm_setr_ps(m[0][3], m[1][3], m[2][3], 0.0f);
+    cols.n0 = _mm_setr_ps(n[0][0], n[1][0], n[2][0], 0.0f);
+    cols.n1 = _mm_setr_ps(n[0][1], n[1][1], n[2][1], 0.0f);
+    cols.n2 = _mm_setr_ps(n[0][2], n[1][2], n[2][2], 0.0f);
+    return cols;
+}
+
+// Normalize (lane 3 = 0 varsayılır). Sıfıra yakın vektör olduğu gibi kalır.
+inline __m128 normalize3(__m128 v) noexcept
+{
+    __m128 sq = _mm_mul_ps(v, v);
+    __m128 sum = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+    sum = _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    const __m128 len = _mm_sqrt_ps(sum);
+    const __m128 valid = _mm_cmpgt_ps(len, _mm_set1_ps(1e-12f));
+    const __m128 scaled = _mm_div_ps(v, _mm_max_ps(len, _mm_set1_ps(1e-12f)));
+    return _mm_or_ps(_mm_and_ps(valid, scaled), _mm_andnot_ps(valid, v));
+}
+
+// 4 register'ı (lane 3'ler çöp) triangle'a yaz. Çakışan store'lar
+// geçici buffer'da yapılır, triangle'a tek memcpy ile kopyalanır.
+inline void storeTriangle(Triangle& tri, __m128 n, __m128 v1, __m128 v2, __m128 v3) noexcept
+{
+    alignas(16) float out[16];
+    _mm_storeu_ps(out + 0, n);
+    _mm_storeu_ps(out + 3, v1);
+    _mm_storeu_ps(out + 6, v2);
+    _mm_storeu_ps(out + 9, v3);
+    std::memcpy(&tri, out, sizeof(Triangle));
+}
+
+void transformSse2(Triangle* tris, size_t count, const AffineTransform& t) noexcept
+{
+    const SseColumns k = makeColumns(t);
+    const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+    auto point = [&](__m128 v)
+    {
+        __m128 r = _mm_add_ps(_mm_mul_ps(k.c0, splat(v, 0)), k.c3);
+        r = _mm_add_ps(r, _mm_mul_ps(k.c1, splat(v, 1)));
+        return _mm_add_ps(r, _mm_mul_ps(k.c2, splat(v, 2)));
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float* p = &tris[i].normal.x;
+        const __m128 n = _mm_loadu_ps(p);
+        __m128 a, b, c;
+        loadVertices(tris[i], a, b, c);
+
+        __m128 nn = _mm_mul_ps(k.n0, splat(n, 0));
+        nn = _mm_add_ps(nn, _mm_mul_ps(k.n1, splat(n, 1)));
+        nn = _mm_add_ps(nn, _mm_mul_ps(k.n2, splat(n, 2)));
+        nn = normalize3(_mm_and_ps(nn, xyzMask));
+
+        storeTriangle(tris[i], nn, point(a), point(b), point(c));
+    }
+}
+
+// 4 triangle'ı AoS → SoA çevir: 12 register, her biri bir bileşenin 4 değeri.
+// Sıra: nx ny nz v1x | v1y v1z v2x v2y | v2z v3x v3y v3z
+inline void transpose4(const Triangle* tris, __m128 comp[12]) noexcept
+{
+    for (int row = 0; row < 3; ++row)
+    {
+        __m128 r0 = _mm_loadu_ps(&tris[0].normal.x + row * 4);
+        __m128 r1 = _mm_loadu_ps(&tris[1].normal.x + row * 4);
+        __m128 r2 = _mm_loadu_ps(&tris[2].normal.x + row * 4);
+        __m128 r3 = _mm_loadu_ps(&tris[3].normal.x + row * 4);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        comp[row * 4 + 0] = r0;
+        comp[row * 4 + 1] = r1;
+        comp[row * 4 + 2] = r2;
+        comp[row * 4 + 3] = r3;
+    }
+}
+
+enum Component
+{
+    V1X = 3, V1Y = 4, V1Z = 5,
+    V2X = 6, V2Y = 7, V2Z = 8,
+    V3X = 9, V3Y = 10, V3Z = 11
+};
+
+inline void storeNormals(Vec3* out, const float* nx, const float* ny, const float* nz, int n) noexcept
+{
+    for (int k = 0; k < n; ++k)
+    {
+        out[k] = Vec3(nx[k], ny[k], nz[k]);
+    }
+}
+
+void normalsAreasSse2(const Triangle* tris, size_t count,
+                      Vec3* outNormals, float* outAreas) noexcept
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 eps = _mm_set1_ps(DEGENERATE_LENGTH);
+    const __m128 one = _mm_set1_ps(1.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 c[12];
+        transpose4(tris + i, c);
+
+        const __m128 dx1 = _mm_sub_ps(c[V2X], c[V1X]);
+        const __m128 dy1 = _mm_sub_ps(c[V2Y], c[V1Y]);
+        const __m128 dz1 = _mm_sub_ps(c[V2Z], c[V1Z]);
+        const __m128 dx2 = _mm_sub_ps(c[V3X], c[V1X]);
+        const __m128 dy2 = _mm_sub_ps(c[V3Y], c[V1Y]);
+        const __m128 dz2 = _mm_sub_ps(c[V3Z], c[V1Z]);
+
+        const __m128 cx = _mm_sub_ps(_mm_mul_ps(dy1, dz2), _mm_mul_ps(dz1, dy2));
+        const __m128 cy = _mm_sub_ps(_mm_mul_ps(dz1, dx2), _mm_mul_ps(dx1, dz2));
+        const __m128 cz = _mm_sub_ps(_mm_mul_ps(dx1, dy2), _mm_mul_ps(dy1, dx2));
+
+        const __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, cx), _mm_mul_ps(cy, cy)),
+                                                  _mm_mul_ps(cz, cz)));
+
+        if (outAreas)
+        {
+            _mm_storeu_ps(outAreas + i, _mm_mul_ps(half, len));
+        }
+
+        if (outNormals)
+        {
+            const __m128 degenerate = _mm_cmplt_ps(len, eps);
+            const __m128 inv = _mm_div_ps(one, _mm_max_ps(len, eps));
+
+            alignas(16) float nx[4], ny[4], nz[4];
+            _mm_store_ps(nx, _mm_andnot_ps(degenerate, _mm_mul_ps(cx, inv)));
+            _mm_store_ps(ny, _mm_andnot_ps(degenerate, _mm_mul_ps(cy, inv)));
+            _mm_store_ps(nz, _mm_or_ps(_mm_andnot_ps(degenerate, _mm_mul_ps(cz, inv)),
+                                       _mm_and_ps(degenerate, one)));
+            storeNormals(outNormals + i, nx, ny, nz, 4);
+        }
+    }
+
+    normalsAreasScalar(tris + i, count - i,
+                       outNormals ? outNormals + i : nullptr,
+                       outAreas ? outAreas + i : nullptr);
+}
+
+void linesAtYSse2(const double* ox, const double* oy, const double* slope,
+                  size_t count, double y, double* out) noexcept
+{
+    const __m128d vy = _mm_set1_pd(y);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128d dy = _mm_sub_pd(vy, _mm_loadu_pd(oy + i));
+        _mm_storeu_pd(out + i, _mm_add_pd(_mm_loadu_pd(ox + i),
+                                          _mm_mul_pd(dy, _mm_loadu_pd(slope + i))));
+    }
+
+    linesAtYScalar(ox + i, oy + i, slope + i, count - i, y, out + i);
+}
+
+// Kısmi float toplamları bu kadar iterasyonda bir double'a aktarılır
+constexpr size_t SUM_FLUSH_INTERVAL = 256;
+
+inline double horizontalSum(__m128 v) noexcept
+{
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, v);
+    return static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+}
+
+void minMaxSse2(const float* values, size_t count, float& mn, float& mx) noexcept
+{
+    // Yeni değer ilk operand: NaN gelirse birikim korunur
+    __m128 vmin = _mm_set1_ps(FLT_MAX), vmax = _mm_set1_ps(-FLT_MAX);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 v = _mm_loadu_ps(values + i);
+        vmin = _mm_min_ps(v, vmin);
+        vmax = _mm_max_ps(v, vmax);
+    }
+
+    alignas(16) float lo[4], hi[4];
+    _mm_store_ps(lo, vmin);
+    _mm_store_ps(hi, vmax);
+    for (int k = 0; k < 4; ++k)
+    {
+        mn = std::min(mn, lo[k]);
+        mx = std::max(mx, hi[k]);
+    }
+    minMaxScalar(values, i, count, mn, mx);
+}
+
+void rangesZSse2(const TriangleArrays& t, float* outMin, float* outMax) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= t.count; i += 4)
+    {
+        const __m128 a = _mm_loadu_ps(t.z[0] + i);
+        const __m128 b = _mm_loadu_ps(t.z[1] + i);
+        const __m128 c = _mm_loadu_ps(t.z[2] + i);
+        _mm_storeu_ps(outMin + i, _mm_min_ps(a, _mm_min_ps(b, c)));
+        _mm_storeu_ps(outMax + i, _mm_max_ps(a, _mm_max_ps(b, c)));
+    }
+
+    rangesZScalar(t, i, outMin, outMax);
+}
+
+size_t crossingsSse2(const TriangleArrays& t, float threshold, uint32_t* out) noexcept
+{
+    const __m128 thr = _mm_set1_ps(threshold);
+    size_t n = 0;
+
+    size_t i = 0;
+    for (; i + 4 <= t.count; i += 4)
+    {
+        const __m128 a = _mm_cmpgt_ps(_mm_loadu_ps(t.z[0] + i), thr);
+        const __m128 b = _mm_cmpgt_ps(_mm_loadu_ps(t.z[1] + i), thr);
+        const __m128 c = _mm_cmpgt_ps(_mm_loadu_ps(t.z[2] + i), thr);
+        const __m128 any = _mm_or_ps(a, _mm_or_ps(b, c));
+        const __m128 all = _mm_and_ps(a, _mm_and_ps(b, c));
+
+        const int mask = _mm_movemask_ps(_mm_andnot_ps(all, any));
+        if (mask != 0)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                if (mask & (1 << k))
+                {
+                    out[n++] = static_cast<uint32_t>(i + k);
+                }
+            }
+        }
+    }
+
+    return n + crossingsScalar(t, i, threshold, out + n);
+}
+
+void sumsSse2(const TriangleArrays& t, TriangleArraySums& sums) noexcept
+{
+    const __m128 zero = _mm_setzero_ps();
+    __m128 area = zero, volume = zero, sx = zero, sy = zero, sz = zero;
+
+    size_t i = 0;
+    size_t pending = 0;
+    for (; i + 4 <= t.count; i += 4)
+    {
+        const __m128 x0 = _mm_loadu_ps(t.x[0] + i), y0 = _mm_loadu_ps(t.y[0] + i), z0 = _mm_loadu_ps(t.z[0] + i);
+        const __m128 x1 = _mm_loadu_ps(t.x[1] + i), y1 = _mm_loadu_ps(t.y[1] + i), z1 = _mm_loadu_ps(t.z[1] + i);
+        const __m128 x2 = _mm_loadu_ps(t.x[2] + i), y2 = _mm_loadu_ps(t.y[2] + i), z2 = _mm_loadu_ps(t.z[2] + i);
+
+        const __m128 ax = _mm_sub_ps(x1, x0), ay = _mm_sub_ps(y1, y0), az = _mm_sub_ps(z1, z0);
+        const __m128 bx = _mm_sub_ps(x2, x0), by = _mm_sub_ps(y2, y0), bz = _mm_sub_ps(z2, z0);
+        const __m128 cx = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+        const __m128 cy = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+        const __m128 cz = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+        area = _mm_add_ps(area, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, cx), _mm_mul_ps(cy, cy)),
+                                                       _mm_mul_ps(cz, cz))));
+
+        const __m128 qx = _mm_sub_ps(_mm_mul_ps(y1, z2), _mm_mul_ps(z1, y2));
+        const __m128 qy = _mm_sub_ps(_mm_mul_ps(z1, x2), _mm_mul_ps(x1, z2));
+        const __m128 qz = _mm_sub_ps(_mm_mul_ps(x1, y2), _mm_mul_ps(y1, x2));
+        volume = _mm_add_ps(volume, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, qx), _mm_mul_ps(y0, qy)),
+                                               _mm_mul_ps(z0, qz)));
+
+        sx = _mm_add_ps(sx, _mm_add_ps(x0, _mm_add_ps(x1, x2)));
+        sy = _mm_add_ps(sy, _mm_add_ps(y0, _mm_add_ps(y1, y2)));
+        sz = _mm_add_ps(sz, _mm_add_ps(z0, _mm_add_ps(z1, z2)));
+
+        if (++pending == SUM_FLUSH_INTERVAL || i + 8 > t.count)
+        {
+            sums.area += 0.5 * horizontalSum(area);
+            sums.signedVolume += horizontalSum(volume) / 6.0;
+            sums.sumX += horizontalSum(sx);
+            sums.sumY += horizontalSum(sy);
+            sums.sumZ += horizontalSum(sz);
+            area = volume = sx = sy = sz = zero;
+            pending = 0;
+        }
+    }
+
+    sumsScalar(t, i, sums);
+}
+
+// ============================================================
+// AVX2 + FMA kernels
+// ============================================================
+
+CORE_KERNELS_TARGET_AVX2
+inline __m256 combine(__m128 lo, __m128 hi) noexcept
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+}
+
+CORE_KERNELS_TARGET_AVX2
+void boundsAvx2(const Triangle* tris, size_t count, AABB& box) noexcept
+{
+    // Her 256-bit register iki triangle'ın aynı vertex'ini taşır
+    __m256 mn0 = _mm256_set1_ps(FLT_MAX), mx0 = _mm256_set1_ps(-FLT_MAX);
+    __m256 mn1 = mn0, mx1 = mx0;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 a0, b0, c0, a1, b1, c1, a2, b2, c2, a3, b3, c3;
+        loadVertices(tris[i], a0, b0, c0);
+        loadVertices(tris[i + 1], a1, b1, c1);
+        loadVertices(tris[i + 2], a2, b2, c2);
+        loadVertices(tris[i + 3], a3, b3, c3);
+
+        const __m256 a01 = combine(a0, a1), b01 = combine(b0, b1), c01 = combine(c0, c1);
+        const __m256 a23 = combine(a2, a3), b23 = combine(b2, b3), c23 = combine(c2, c3);
+
+        mn0 = _mm256_min_ps(mn0, _mm256_min_ps(a01, _mm256_min_ps(b01, c01)));
+        mx0 = _mm256_max_ps(mx0, _mm256_max_ps(a01, _mm256_max_ps(b01, c01)));
+        mn1 = _mm256_min_ps(mn1, _mm256_min_ps(a23, _mm256_min_ps(b23, c23)));
+        mx1 = _mm256_max_ps(mx1, _mm256_max_ps(a23, _mm256_max_ps(b23, c23)));
+    }
+
+    const __m256 mn = _mm256_min_ps(mn0, mn1);
+    const __m256 mx = _mm256_max_ps(mx0, mx1);
+    storeBounds(_mm_min_ps(_mm256_castps256_ps128(mn), _mm256_extractf128_ps(mn, 1)),
+                _mm_max_ps(_mm256_castps256_ps128(mx), _mm256_extractf128_ps(mx, 1)),
+                box);
+    boundsSse2(tris + i, count - i, box);
+}
+
+CORE_KERNELS_TARGET_AVX2
+void transformAvx2(Triangle* tris, size_t count, const AffineTransform& t) noexcept
+{
+    const SseColumns k = makeColumns(t);
+    const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+    auto point = [&](__m128 v) CORE_KERNELS_TARGET_AVX2
+    {
+        __m128 r = _mm_fmadd_ps(k.c0, _mm_permute_ps(v, 0x00), k.c3);
+        r = _mm_fmadd_ps(k.c1, _mm_permute_ps(v, 0x55), r);
+        return _mm_fmadd_ps(k.c2, _mm_permute_ps(v, 0xAA), r);
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const __m128 n = _mm_loadu_ps(&tris[i].normal.x);
+        __m128 a, b, c;
+        loadVertices(tris[i], a, b, c);
+
+        __m128 nn = _mm_mul_ps(k.n0, _mm_permute_ps(n, 0x00));
+        nn = _mm_fmadd_ps(k.n1, _mm_permute_ps(n, 0x55), nn);
+        nn = _mm_fmadd_ps(k.n2, _mm_permute_ps(n, 0xAA), nn);
+        nn = normalize3(_mm_and_ps(nn, xyzMask));
+
+        storeTriangle(tris[i], nn, point(a), point(b), point(c));
+    }
+}
+
+CORE_KERNELS_TARGET_AVX2
+void normalsAreasAvx2(const Triangle* tris, size_t count,
+                      Vec3* outNormals, float* outAreas) noexcept
+{
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 eps = _mm256_set1_ps(DEGENERATE_LENGTH);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128 lo[12], hi[12];
+        transpose4(tris + i, lo);
+        transpose4(tris + i + 4, hi);
+
+        auto comp = [&](int k) CORE_KERNELS_TARGET_AVX2 { return combine(lo[k], hi[k]); };
+
+        const __m256 v1x = comp(V1X), v1y = comp(V1Y), v1z = comp(V1Z);
+        const __m256 dx1 = _mm256_sub_ps(comp(V2X), v1x);
+        const __m256 dy1 = _mm256_sub_ps(comp(V2Y), v1y);
+        const __m256 dz1 = _mm256_sub_ps(comp(V2Z), v1z);
+        const __m256 dx2 = _mm256_sub_ps(comp(V3X), v1x);
+        const __m256 dy2 = _mm256_sub_ps(comp(V3Y), v1y);
+        const __m256 dz2 = _mm256_sub_ps(comp(V3Z), v1z);
+
+        const __m256 cx = _mm256_fmsub_ps(dy1, dz2, _mm256_mul_ps(dz1, dy2));
+        const __m256 cy = _mm256_fmsub_ps(dz1, dx2, _mm256_mul_ps(dx1, dz2));
+        const __m256 cz = _mm256_fmsub_ps(dx1, dy2, _mm256_mul_ps(dy1, dx2));
+
+        const __m256 len = _mm256_sqrt_ps(
+            _mm256_fmadd_ps(cz, cz, _mm256_fmadd_ps(cy, cy, _mm256_mul_ps(cx, cx))));
+
+        if (outAreas)
+        {
+            _mm256_storeu_ps(outAreas + i, _mm256_mul_ps(half, len));
+        }
+
+        if (outNormals)
+        {
+            const __m256 degenerate = _mm256_cmp_ps(len, eps, _CMP_LT_OQ);
+            const __m256 inv = _mm256_div_ps(one, _mm256_max_ps(len, eps));
+
+            alignas(32) float nx[8], ny[8], nz[8];
+            _mm256_store_ps(nx, _mm256_andnot_ps(degenerate, _mm256_mul_ps(cx, inv)));
+            _mm256_store_ps(ny, _mm256_andnot_ps(degenerate, _mm256_mul_ps(cy, inv)));
+            _mm256_store_ps(nz, _mm256_blendv_ps(_mm256_mul_ps(cz, inv), one, degenerate));
+            storeNormals(outNormals + i, nx, ny, nz, 8);
+        }
+    }
+
+    normalsAreasSse2(tris + i, count - i,
+                     outNormals ? outNormals + i : nullptr,
+                     outAreas ? outAreas + i : nullptr);
+}
+
+CORE_KERNELS_TARGET_AVX2
+void linesAtYAvx2(const double* ox, const double* oy, const double* slope,
+                  size_t count, double y, double* out) noexcept
+{
+    const __m256d vy = _mm256_set1_pd(y);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256d dy = _mm256_sub_pd(vy, _mm256_loadu_pd(oy + i));
+        _mm256_storeu_pd(out + i, _mm256_fmadd_pd(dy, _mm256_loadu_pd(slope + i),
+                                                  _mm256_loadu_pd(ox + i)));
+    }
+
+    linesAtYSse2(ox + i, oy + i, slope + i, count - i, y, out + i);
+}
+
+CORE_KERNELS_TARGET_AVX2
+inline double horizontalSum(__m256 v) noexcept
+{
+    return horizontalSum(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+}
+
+CORE_KERNELS_TARGET_AVX2
+void minMaxAvx2(const float* values, size_t count, float& mn, float& mx) noexcept
+{
+    __m256 vmin = _mm256_set1_ps(FLT_MAX), vmax = _mm256_set1_ps(-FLT_MAX);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 v = _mm256_loadu_ps(values + i);
+        vmin = _mm256_min_ps(v, vmin);
+        vmax = _mm256_max_ps(v, vmax);
+    }
+
+    alignas(32) float lo[8], hi[8];
+    _mm256_store_ps(lo, vmin);
+    _mm256_store_ps(hi, vmax);
+    for (int k = 0; k < 8; ++k)
+    {
+        mn = std::min(mn, lo[k]);
+        mx = std::max(mx, hi[k]);
+    }
+    minMaxScalar(values, i, count, mn, mx);
+}
+
+CORE_KERNELS_TARGET_AVX2
+void rangesZAvx2(const TriangleArrays& t, float* outMin, float* outMax) noexcept
+{
+    size_t i = 0;
+    for (; i + 8 <= t.count; i += 8)
+    {
+        const __m256 a = _mm256_loadu_ps(t.z[0] + i);
+        const __m256 b = _mm256_loadu_ps(t.z[1] + i);
+        const __m256 c = _mm256_loadu_ps(t.z[2] + i);
+        _mm256_storeu_ps(outMin + i, _mm256_min_ps(a, _mm256_min_ps(b, c)));
+        _mm256_storeu_ps(outMax + i, _mm256_max_ps(a, _mm256_max_ps(b, c)));
+    }
+
+    rangesZScalar(t, i, outMin, outMax);
+}
+
+CORE_KERNELS_TARGET_AVX2
+size_t crossingsAvx2(const TriangleArrays& t, float threshold, uint32_t* out) noexcept
+{
+    const __m256 thr = _mm256_set1_ps(threshold);
+    size_t n = 0;
+
+    size_t i = 0;
+    for (; i + 8 <= t.count; i += 8)
+    {
+        const __m256 a = _mm256_cmp_ps(_mm256_loadu_ps(t.z[0] + i), thr, _CMP_GT_OQ);
+        const __m256 b = _mm256_cmp_ps(_mm256_loadu_ps(t.z[1] + i), thr, _CMP_GT_OQ);
+        const __m256 c = _mm256_cmp_ps(_mm256_loadu_ps(t.z[2] + i), thr, _CMP_GT_OQ);
+        const __m256 any = _mm256_or_ps(a, _mm256_or_ps(b, c));
+        const __m256 all = _mm256_and_ps(a, _mm256_and_ps(b, c));
+
+        const int mask = _mm256_movemask_ps(_mm256_andnot_ps(all, any));
+        if (mask != 0)
+        {
+            for (int k = 0; k < 8; ++k)
+            {
+                if (mask & (1 << k))
+                {
+                    out[n++] = static_cast<uint32_t>(i + k);
+                }
+            }
+        }
+    }
+
+    return n + crossingsScalar(t, i, threshold, out + n);
+}
+
+CORE_KERNELS_TARGET_AVX2
+void sumsAvx2(const TriangleArrays& t, TriangleArraySums& sums) noexcept
+{
+    const __m256 zero = _mm256_setzero_ps();
+    __m256 area = zero, volume = zero, sx = zero, sy = zero, sz = zero;
+
+    size_t i = 0;
+    size_t pending = 0;
+    for (; i + 8 <= t.count; i += 8)
+    {
+        const __m256 x0 = _mm256_loadu_ps(t.x[0] + i), y0 = _mm256_loadu_ps(t.y[0] + i), z0 = _mm256_loadu_ps(t.z[0] + i);
+        const __m256 x1 = _mm256_loadu_ps(t.x[1] + i), y1 = _mm256_loadu_ps(t.y[1] + i), z1 = _mm256_loadu_ps(t.z[1] + i);
+        const __m256 x2 = _mm256_loadu_ps(t.x[2] + i), y2 = _mm256_loadu_ps(t.y[2] + i), z2 = _mm256_loadu_ps(t.z[2] + i);
+
+        const __m256 ax = _mm256_sub_ps(x1, x0), ay = _mm256_sub_ps(y1, y0), az = _mm256_sub_ps(z1, z0);
+        const __m256 bx = _mm256_sub_ps(x2, x0), by = _mm256_sub_ps(y2, y0), bz = _mm256_sub_ps(z2, z0);
+        const __m256 cx = _mm256_fmsub_ps(ay, bz, _mm256_mul_ps(az, by));
+        const __m256 cy = _mm256_fmsub_ps(az, bx, _mm256_mul_ps(ax, bz));
+        const __m256 cz = _mm256_fmsub_ps(ax, by, _mm256_mul_ps(ay, bx));
+        area = _mm256_add_ps(area, _mm256_sqrt_ps(
+            _mm256_fmadd_ps(cz, cz, _mm256_fmadd_ps(cy, cy, _mm256_mul_ps(cx, cx)))));
+
+        const __m256 qx = _mm256_fmsub_ps(y1, z2, _mm256_mul_ps(z1, y2));
+        const __m256 qy = _mm256_fmsub_ps(z1, x2, _mm256_mul_ps(x1, z2));
+        const __m256 qz = _mm256_fmsub_ps(x1, y2, _mm256_mul_ps(y1, x2));
+        volume = _mm256_fmadd_ps(z0, qz, _mm256_fmadd_ps(y0, qy, _mm256_fmadd_ps(x0, qx, volume)));
+
+        sx = _mm256_add_ps(sx, _mm256_add_ps(x0, _mm256_add_ps(x1, x2)));
+        sy = _mm256_add_ps(sy, _mm256_add_ps(y0, _mm256_add_ps(y1, y2)));
+        sz = _mm256_add_ps(sz, _mm256_add_ps(z0, _mm256_add_ps(z1, z2)));
+
+        if (++pending == SUM_FLUSH_INTERVAL || i + 16 > t.count)
+        {
+            sums.area += 0.5 * horizontalSum(area);
+            sums.signedVolume += horizontalSum(volume) / 6.0;
+            sums.sumX += horizontalSum(sx);
+            sums.sumY += horizontalSum(sy);
+            sums.sumZ += horizontalSum(sz);
+            area = volume = sx = sy = sz = zero;
+            pending = 0;
+        }
+    }
+
+    sumsScalar(t, i, sums);
+}
+
+#endif // CORE_KERNELS_X86
+
+} // namespace
+
+// ============================================================
+// Public API (dispatch)
+// ============================================================
+
+IsaLevel detectedIsa() noexcept
+{
+    static const IsaLevel detected = detectIsaOnce();
+    return detected;
+}
+
+IsaLevel activeIsa() noexcept
+{
+    const int forced = isaOverride().load(std::memory_order_relaxed);
+    return forced < 0 ? detectedIsa() : static_cast<IsaLevel>(forced);
+}
+
+void forceIsa(IsaLevel isa) noexcept
+{
+    const IsaLevel clamped = std::min(isa, detectedIsa());
+    isaOverride().store(static_cast<int>(clamped), std::memory_order_relaxed);
+}
+
+const char* isaName(IsaLevel isa) noexcept
+{
+    switch (isa)
+    {
+    case IsaLevel::AVX2: return "AVX2";
+    case IsaLevel::SSE2: return "SSE2";
+    default:             return "Scalar";
+    }
+}
+
+AABB computeBounds(const Triangle* triangles, size_t count) noexcept
+{
+    AABB box;
+    box.min = Vec3(FLT_MAX, FLT_MAX, FLT_MAX);
+    box.max = Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+    if (!triangles || count == 0)
+    {
+        return box;
+    }
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: boundsAvx2(triangles, count, box); break;
+    case IsaLevel::SSE2: boundsSse2(triangles, count, box); break;
+#endif
+    default:             boundsScalar(triangles, count, box); break;
+    }
+
+    return box;
+}
+
+void transformTriangles(Triangle* triangles, size_t count,
+                        const AffineTransform& transform) noexcept
+{
+    if (!triangles || count == 0)
+    {
+        return;
+    }
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: transformAvx2(triangles, count, transform); break;
+    case IsaLevel::SSE2: transformSse2(triangles, count, transform); break;
+#endif
+    default:             transformScalar(triangles, count, transform); break;
+    }
+}
+
+void computeNormalsAndAreas(const Triangle* triangles, size_t count,
+                            Vec3* outNormals, float* outAreas) noexcept
+{
+    if (!triangles || count == 0 || (!outNormals && !outAreas))
+    {
+        return;
+    }
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: normalsAreasAvx2(triangles, count, outNormals, outAreas); break;
+    case IsaLevel::SSE2: normalsAreasSse2(triangles, count, outNormals, outAreas); break;
+#endif
+    default:             normalsAreasScalar(triangles, count, outNormals, outAreas); break;
+    }
+}
+
+void evaluateLinesAtY(const double* originX, const double* originY, const double* slope,
+                      size_t count, double y, double* outX) noexcept
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: linesAtYAvx2(originX, originY, slope, count, y, outX); break;
+    case IsaLevel::SSE2: linesAtYSse2(originX, originY, slope, count, y, outX); break;
+#endif
+    default:             linesAtYScalar(originX, originY, slope, count, y, outX); break;
+    }
+}
+
+void minMax(const float* values, size_t count, float& outMin, float& outMax) noexcept
+{
+    outMin = FLT_MAX;
+    outMax = -FLT_MAX;
+
+    if (!values || count == 0)
+    {
+        return;
+    }
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: minMaxAvx2(values, count, outMin, outMax); break;
+    case IsaLevel::SSE2: minMaxSse2(values, count, outMin, outMax); break;
+#endif
+    default:             minMaxScalar(values, 0, count, outMin, outMax); break;
+    }
+}
+
+void triangleRangesZ(const TriangleArrays& tris, float* outMin, float* outMax) noexcept
+{
+    if (tris.count == 0)
+    {
+        return;
+    }
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: rangesZAvx2(tris, outMin, outMax); break;
+    case IsaLevel::SSE2: rangesZSse2(tris, outMin, outMax); break;
+#endif
+    default:             rangesZScalar(tris, 0, outMin, outMax); break;
+    }
+}
+
+size_t selectPlaneCrossings(const TriangleArrays& tris, float threshold,
+                            uint32_t* outIndices) noexcept
+{
+    if (tris.count == 0)
+    {
+        return 0;
+    }
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: return crossingsAvx2(tris, threshold, outIndices);
+    case IsaLevel::SSE2: return crossingsSse2(tris, threshold, outIndices);
+#endif
+    default:             return crossingsScalar(tris, 0, threshold, outIndices);
+    }
+}
+
+TriangleArraySums sumTriangleArrays(const TriangleArrays& tris) noexcept
+{
+    TriangleArraySums sums;
+
+    switch (activeIsa())
+    {
+#if CORE_KERNELS_X86
+    case IsaLevel::AVX2: sumsAvx2(tris, sums); break;
+    case IsaLevel::SSE2: sumsSse2(tris, sums); break;
+#endif
+    default:             sumsScalar(tris, 0, sums); break;
+    }
+
+    return sums;
+}
+
+} // namespace kernels
+} // namespace geometry
+} // namespace core
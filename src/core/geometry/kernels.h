@@ -0,0 +1,169 @@
+#pragma once
+
+#include "core/geometry/triangle.h"
+#include "core/geometry/aabb.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace core {
+namespace geometry {
+namespace kernels {
+
+/**
+ * @brief Vektörize geometri kernel'leri (bounds, transform, normal/alan)
+ *
+ * Mesh, MeshAnalyzer, ZIndexedMesh, Slicer ve MeshRenderer aynı
+ * vertex taramasını tek tek yapmak yerine bu modülü kullanır.
+ * Uygun komut seti runtime'da bir kez tespit edilir:
+ * - AVX2 + FMA (x86-64, destekleniyorsa)
+ * - SSE2      (x86-64 baseline)
+ * - Scalar    (diğer mimariler, örn. ARM)
+ */
+enum class IsaLevel
+{
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+/**
+ * @brief Şu an kullanılan komut seti
+ */
+IsaLevel activeIsa() noexcept;
+
+/**
+ * @brief CPU'nun desteklediği en yüksek komut seti
+ */
+IsaLevel detectedIsa() noexcept;
+
+/**
+ * @brief Komut setini zorla (benchmark karşılaştırmaları için)
+ *
+ * CPU'nun desteklediğinden yüksek bir seviye istenirse
+ * desteklenen en yüksek seviyeye düşürülür.
+ */
+void forceIsa(IsaLevel isa) noexcept;
+
+/**
+ * @brief Okunabilir isim ("AVX2", "SSE2", "Scalar")
+ */
+const char* isaName(IsaLevel isa) noexcept;
+
+/**
+ * @brief 3x4 affine matris (row-major)
+ *
+ * p' = M * (x, y, z, 1)
+ */
+struct AffineTransform
+{
+    float m[3][4] = {
+        {1.0f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f, 0.0f}
+    };
+};
+
+/**
+ * @brief Tüm vertex'lerin AABB'si
+ *
+ * count == 0 ise min = +FLT_MAX, max = -FLT_MAX döner.
+ */
+AABB computeBounds(const Triangle* triangles, size_t count) noexcept;
+
+/**
+ * @brief Tüm triangle'lara affine transform uygula (in-place)
+ *
+ * Vertex'ler M ile, normaller M'nin inverse-transpose'u ile
+ * dönüştürülür ve tekrar normalize edilir. Sıfır normaller sıfır kalır.
+ */
+void transformTriangles(Triangle* triangles, size_t count,
+                        const AffineTransform& transform) noexcept;
+
+/**
+ * @brief Her triangle için geometrik normal ve alan
+ *
+ * Normal = normalize((v2-v1) × (v3-v1)), dejenere triangle'da (0,0,1).
+ * Alan   = 0.5 * ||(v2-v1) × (v3-v1)||
+ *
+ * @param outNormals count elemanlı çıktı (nullptr olabilir)
+ * @param outAreas   count elemanlı çıktı (nullptr olabilir)
+ */
+void computeNormalsAndAreas(const Triangle* triangles, size_t count,
+                            Vec3* outNormals, float* outAreas) noexcept;
+
+/**
+ * @brief Doğruları verilen y'de değerlendir (tarama çizgisi kesişimleri)
+ *
+ * outX[i] = originX[i] + (y - originY[i]) * slope[i]
+ *
+ * Diziler SoA düzenindedir (infill'in aktif kenar tablosu); her tarama
+ * çizgisinde tüm aktif kenarlar tek geçişte hesaplanır.
+ */
+void evaluateLinesAtY(const double* originX, const double* originY, const double* slope,
+                      size_t count, double y, double* outX) noexcept;
+
+/**
+ * @brief SoA triangle köşeleri (mesh::MeshSoA görünümü)
+ *
+ * x[k][i] = triangle i'nin k. köşesinin x'i. Sadece Z okuyan taramalar
+ * (sınır, bucket aralığı, düzlem sınıflandırma) AoS Triangle'ın
+ * 48 byte'ı yerine 12 byte gezer.
+ */
+struct TriangleArrays
+{
+    const float* x[3] = {nullptr, nullptr, nullptr};
+    const float* y[3] = {nullptr, nullptr, nullptr};
+    const float* z[3] = {nullptr, nullptr, nullptr};
+    size_t count = 0;
+};
+
+/**
+ * @brief Dizinin min/max'ı
+ *
+ * count == 0 ise min = +FLT_MAX, max = -FLT_MAX döner.
+ */
+void minMax(const float* values, size_t count, float& outMin, float& outMax) noexcept;
+
+/**
+ * @brief Triangle başına Z aralığı (ZIndexedMesh bucket aralıkları)
+ *
+ * @param outMin, outMax tris.count elemanlı çıktı
+ */
+void triangleRangesZ(const TriangleArrays& tris, float* outMin, float* outMax) noexcept;
+
+/**
+ * @brief Z = threshold düzlemini kesen aday triangle'lar
+ *
+ * Triangle seçilir ⇔ köşelerinden en az biri threshold'un üstünde
+ * (z > threshold), en az biri değil. Slicer'ın "Above" sınıflandırmasıyla
+ * aynıdır (NaN üstte sayılmaz); segment üretmeyen adaylar kalabilir.
+ *
+ * @param outIndices En az tris.count elemanlı, artan sırada doldurulur
+ * @return Seçilen triangle sayısı
+ */
+size_t selectPlaneCrossings(const TriangleArrays& tris, float threshold,
+                            uint32_t* outIndices) noexcept;
+
+/**
+ * @brief MeshAnalyzer toplamları
+ */
+struct TriangleArraySums
+{
+    double area = 0.0;              // Σ 0.5 * |(v2-v1) × (v3-v1)|
+    double signedVolume = 0.0;      // Σ v1 · (v2 × v3) / 6
+    double sumX = 0.0;              // Köşe koordinatları toplamı
+    double sumY = 0.0;
+    double sumZ = 0.0;
+};
+
+/**
+ * @brief Alan, işaretli hacim ve köşe toplamları tek geçişte
+ *
+ * Kısmi toplamlar blok blok double'a aktarılır (büyük mesh'te float
+ * birikim hatası büyümez).
+ */
+TriangleArraySums sumTriangleArrays(const TriangleArrays& tris) noexcept;
+
+} // namespace kernels
+} // namespace geometry
+} // namespace core
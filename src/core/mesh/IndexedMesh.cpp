@@ -0,0 +1,159 @@
+#include "IndexedMesh.h"
+#include "core/geometry/kernels.h"
+#include <algorithm>
+#include <cstring>
+
+namespace core {
+namespace mesh {
+
+namespace {
+
+constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFFu;
+constexpr size_t NORMAL_CHUNK = 16384;
+
+uint32_t floatBits(float value)
+{
+    // -0 ve 0 aynı vertex
+    if (value == 0.0f)
+    {
+        return 0u;
+    }
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+uint64_t hashPosition(const geometry::Vec3& v)
+{
+    uint64_t h = floatBits(v.x) * 0x9E3779B97F4A7C15ull;
+    h ^= floatBits(v.y) * 0xC2B2AE3D27D4EB4Full;
+    h ^= floatBits(v.z) * 0x165667B19E3779F9ull;
+    return h ^ (h >> 29);
+}
+
+bool samePosition(const geometry::Vec3& a, const geometry::Vec3& b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+/**
+ * @brief Açık adresli konum → vertex index tablosu
+ */
+class VertexTable
+{
+public:
+    explicit VertexTable(size_t expected)
+    {
+        size_t capacity = 1024;
+        while (capacity < expected * 2)
+        {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, EMPTY_SLOT);
+    }
+
+    uint32_t insert(const geometry::Vec3& v, std::vector<geometry::Vec3>& vertices)
+    {
+        // Doluluk %50'yi geçerse büyüt
+        if ((vertices.size() + 1) * 2 > slots_.size())
+        {
+            grow(vertices);
+        }
+
+        const size_t mask = slots_.size() - 1;
+        for (size_t slot = hashPosition(v) & mask;; slot = (slot + 1) & mask)
+        {
+            const uint32_t index = slots_[slot];
+            if (index == EMPTY_SLOT)
+            {
+                const uint32_t created = static_cast<uint32_t>(vertices.size());
+                vertices.push_back(v);
+                slots_[slot] = created;
+                return created;
+            }
+            if (samePosition(vertices[index], v))
+            {
+                return index;
+            }
+        }
+    }
+
+private:
+    std::vector<uint32_t> slots_;
+
+    void grow(const std::vector<geometry::Vec3>& vertices)
+    {
+        slots_.assign(slots_.size() * 2, EMPTY_SLOT);
+        const size_t mask = slots_.size() - 1;
+
+        for (uint32_t i = 0; i < vertices.size(); ++i)
+        {
+            size_t slot = hashPosition(vertices[i]) & mask;
+            while (slots_[slot] != EMPTY_SLOT)
+            {
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = i;
+        }
+    }
+};
+
+} // namespace
+
+IndexedMesh IndexedMesh::fromMesh(const Mesh& mesh)
+{
+    IndexedMesh result;
+
+    const size_t count = mesh.triangles.size();
+    result.indices.resize(count * 3);
+
+    // Kapalı mesh'te vertex ≈ triangle / 2
+    result.vertices.reserve(count / 2 + 3);
+    VertexTable table(count / 2 + 3);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const geometry::Triangle& tri = mesh.triangles[i];
+        result.indices[3 * i] = table.insert(tri.vertex1, result.vertices);
+        result.indices[3 * i + 1] = table.insert(tri.vertex2, result.vertices);
+        result.indices[3 * i + 2] = table.insert(tri.vertex3, result.vertices);
+    }
+
+    return result;
+}
+
+Mesh IndexedMesh::toMesh() const
+{
+    Mesh mesh;
+
+    const size_t count = triangleCount();
+    mesh.triangles.resize(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        geometry::Triangle& tri = mesh.triangles[i];
+        tri.vertex1 = vertices[indices[3 * i]];
+        tri.vertex2 = vertices[indices[3 * i + 1]];
+        tri.vertex3 = vertices[indices[3 * i + 2]];
+    }
+
+    std::vector<geometry::Vec3> normals(NORMAL_CHUNK);
+    std::vector<float> areas(NORMAL_CHUNK);
+
+    for (size_t first = 0; first < count; first += NORMAL_CHUNK)
+    {
+        const size_t n = std::min(NORMAL_CHUNK, count - first);
+        geometry::kernels::computeNormalsAndAreas(mesh.triangles.data() + first, n,
+                                                  normals.data(), areas.data());
+        for (size_t i = 0; i < n; ++i)
+        {
+            mesh.triangles[first + i].normal = normals[i];
+        }
+    }
+
+    mesh.computeBounds();
+    return mesh;
+}
+
+} // namespace mesh
+} // namespace core
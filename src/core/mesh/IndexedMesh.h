@@ -0,0 +1,42 @@
+#pragma once
+
+#include "mesh.h"
+#include "core/geometry/vec3.h"
+#include <cstdint>
+#include <vector>
+
+namespace core {
+namespace mesh {
+
+/**
+ * @brief Paylaşılan vertex'li (indexed) mesh
+ *
+ * STL triangle çorbası her köşeyi ayrı saklar; topoloji işlemleri
+ * (edge collapse, komşuluk, bağlı bileşen) için aynı konumdaki köşelerin
+ * tek vertex'e kaynaklanması gerekir. Kaynak birebir konum eşitliğiyle
+ * yapılır (STL'de komşu yüzeyler aynı float'ları yazar; -0 ile 0 eşittir).
+ *
+ * Triangle sırası ve köşe sırası (yön) korunur: triangle i'nin köşeleri
+ * indices[3i], indices[3i+1], indices[3i+2].
+ */
+struct IndexedMesh
+{
+    std::vector<geometry::Vec3> vertices;
+    std::vector<uint32_t> indices;
+
+    size_t triangleCount() const noexcept { return indices.size() / 3; }
+    size_t vertexCount() const noexcept { return vertices.size(); }
+
+    /**
+     * @brief Triangle çorbasından kaynaklı mesh (hash tablosu, O(n))
+     */
+    static IndexedMesh fromMesh(const Mesh& mesh);
+
+    /**
+     * @brief Triangle çorbasına geri dön (normaller geometriden hesaplanır)
+     */
+    Mesh toMesh() const;
+};
+
+} // namespace mesh
+} // namespace core
@@ -1,7 +1,9 @@
 #include "MeshAnalyzer.h"
-#include <cmath>
-#include <limits>
+#include "core/geometry/kernels.h"
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
 
 namespace core {
 namespace mesh {
@@ -48,66 +50,84 @@ MeshStatistics MeshAnalyzer::analyze(const Mesh& mesh) const
     return stats;
 }
 
-geometry::AABB MeshAnalyzer::computeBoundingBox(const Mesh& mesh) const
+MeshStatistics MeshAnalyzer::analyze(const MeshSoA& soa) const
 {
-    geometry::AABB bounds;
+    MeshStatistics stats;
 
-    // Başlangıç değerleri
-    bounds.min = geometry::Vec3(
-        std::numeric_limits<float>::max(),
-        std::numeric_limits<float>::max(),
-        std::numeric_limits<float>::max()
-        );
-    bounds.max = geometry::Vec3(
-        std::numeric_limits<float>::lowest(),
-        std::numeric_limits<float>::lowest(),
-        std::numeric_limits<float>::lowest()
+    if (soa.empty())
+    {
+        return stats;
+    }
+
+    stats.triangleCount = static_cast<int>(soa.triangleCount());
+    stats.vertexCount = stats.triangleCount * 3;
+
+    // Bounding box: dokuz dizinin her biri tek geçiş
+    stats.bounds.min = geometry::Vec3(FLT_MAX, FLT_MAX, FLT_MAX);
+    stats.bounds.max = geometry::Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+    for (int corner = 0; corner < 3; ++corner)
+    {
+        float lo, hi;
+        geometry::kernels::minMax(soa.x(corner), soa.triangleCount(), lo, hi);
+        stats.bounds.min.x = std::min(stats.bounds.min.x, lo);
+        stats.bounds.max.x = std::max(stats.bounds.max.x, hi);
+
+        geometry::kernels::minMax(soa.y(corner), soa.triangleCount(), lo, hi);
+        stats.bounds.min.y = std::min(stats.bounds.min.y, lo);
+        stats.bounds.max.y = std::max(stats.bounds.max.y, hi);
+
+        geometry::kernels::minMax(soa.z(corner), soa.triangleCount(), lo, hi);
+        stats.bounds.min.z = std::min(stats.bounds.min.z, lo);
+        stats.bounds.max.z = std::max(stats.bounds.max.z, hi);
+    }
+
+    stats.dimensions = geometry::Vec3(
+        stats.bounds.max.x - stats.bounds.min.x,
+        stats.bounds.max.y - stats.bounds.min.y,
+        stats.bounds.max.z - stats.bounds.min.z
         );
 
-    // Her vertex'i kontrol et
-    for (const auto& tri : mesh.triangles)
+    // Alan, signed volume ve köşe toplamları
+    const geometry::kernels::TriangleArraySums sums = geometry::kernels::sumTriangleArrays(soa.arrays());
+
+    stats.surfaceArea = static_cast<float>(sums.area);
+    stats.volume = static_cast<float>(sums.signedVolume);
+    stats.isWatertight = (std::abs(stats.volume) > 1e-6f);
+
+    if (stats.volume < 0)
     {
-        // Vertex 1
-        bounds.min.x = std::min(bounds.min.x, tri.vertex1.x);
-        bounds.min.y = std::min(bounds.min.y, tri.vertex1.y);
-        bounds.min.z = std::min(bounds.min.z, tri.vertex1.z);
-
-        bounds.max.x = std::max(bounds.max.x, tri.vertex1.x);
-        bounds.max.y = std::max(bounds.max.y, tri.vertex1.y);
-        bounds.max.z = std::max(bounds.max.z, tri.vertex1.z);
-
-        // Vertex 2
-        bounds.min.x = std::min(bounds.min.x, tri.vertex2.x);
-        bounds.min.y = std::min(bounds.min.y, tri.vertex2.y);
-        bounds.min.z = std::min(bounds.min.z, tri.vertex2.z);
-
-        bounds.max.x = std::max(bounds.max.x, tri.vertex2.x);
-        bounds.max.y = std::max(bounds.max.y, tri.vertex2.y);
-        bounds.max.z = std::max(bounds.max.z, tri.vertex2.z);
-
-        // Vertex 3
-        bounds.min.x = std::min(bounds.min.x, tri.vertex3.x);
-        bounds.min.y = std::min(bounds.min.y, tri.vertex3.y);
-        bounds.min.z = std::min(bounds.min.z, tri.vertex3.z);
-
-        bounds.max.x = std::max(bounds.max.x, tri.vertex3.x);
-        bounds.max.y = std::max(bounds.max.y, tri.vertex3.y);
-        bounds.max.z = std::max(bounds.max.z, tri.vertex3.z);
+        stats.volume = -stats.volume;
     }
 
-    return bounds;
+    const double vertexCount = static_cast<double>(stats.vertexCount);
+    stats.centerOfMass = geometry::Vec3(static_cast<float>(sums.sumX / vertexCount),
+                                        static_cast<float>(sums.sumY / vertexCount),
+                                        static_cast<float>(sums.sumZ / vertexCount));
+
+    return stats;
+}
+
+geometry::AABB MeshAnalyzer::computeBoundingBox(const Mesh& mesh) const
+{
+    return geometry::kernels::computeBounds(mesh.triangles.data(), mesh.triangles.size());
 }
 
 float MeshAnalyzer::computeSurfaceArea(const Mesh& mesh) const
 {
-    float totalArea = 0.0f;
+    // Triangle alanları tek SIMD geçişte, toplam double ile
+    std::vector<float> areas(mesh.triangles.size());
+    geometry::kernels::computeNormalsAndAreas(mesh.triangles.data(), mesh.triangles.size(),
+                                              nullptr, areas.data());
 
-    for (const auto& tri : mesh.triangles)
+    double totalArea = 0.0;
+
+    for (float area : areas)
     {
-        totalArea += triangleArea(tri);
+        totalArea += area;
     }
 
-    return totalArea;
+    return static_cast<float>(totalArea);
 }
 
 float MeshAnalyzer::computeVolume(const Mesh& mesh) const
@@ -148,29 +168,6 @@ geometry::Vec3 MeshAnalyzer::computeCenterOfMass(const Mesh& mesh) const
     return center;
 }
 
-float MeshAnalyzer::triangleArea(const geometry::Triangle& tri) const
-{
-    // Area = 0.5 * ||(v2-v1) × (v3-v1)||
-
-    float dx1 = tri.vertex2.x - tri.vertex1.x;
-    float dy1 = tri.vertex2.y - tri.vertex1.y;
-    float dz1 = tri.vertex2.z - tri.vertex1.z;
-
-    float dx2 = tri.vertex3.x - tri.vertex1.x;
-    float dy2 = tri.vertex3.y - tri.vertex1.y;
-    float dz2 = tri.vertex3.z - tri.vertex1.z;
-
-    // Cross product
-    float cx = dy1 * dz2 - dz1 * dy2;
-    float cy = dz1 * dx2 - dx1 * dz2;
-    float cz = dx1 * dy2 - dy1 * dx2;
-
-    // Magnitude
-    float magnitude = std::sqrt(cx*cx + cy*cy + cz*cz);
-
-    return 0.5f * magnitude;
-}
-
 float MeshAnalyzer::signedVolumeOfTriangle(const geometry::Triangle& tri) const
 {
     // Signed volume of tetrahedron formed by triangle and origin
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "mesh.h"
+#include "MeshSoA.h"
 #include "core/geometry/vec3.h"
 #include "core/geometry/aabb.h"
 
@@ -46,6 +47,13 @@ public:
      */
     MeshStatistics analyze(const Mesh& mesh) const;
 
+    /**
+     * @brief SoA görünümünden analiz (tek SIMD geçişte alan, hacim, merkez)
+     *
+     * Sonuçlar analyze(Mesh) ile aynıdır; toplamlar double'da birikir.
+     */
+    MeshStatistics analyze(const MeshSoA& soa) const;
+
 private:
     // Yardımcı fonksiyonlar
     geometry::AABB computeBoundingBox(const Mesh& mesh) const;
@@ -54,7 +62,6 @@ private:
     geometry::Vec3 computeCenterOfMass(const Mesh& mesh) const;
 
     // Tek triangle için
-    float triangleArea(const geometry::Triangle& tri) const;
     float signedVolumeOfTriangle(const geometry::Triangle& tri) const;
 };
 
@@ -0,0 +1,964 @@
+#include "MeshDecimator.h"
+#include "IndexedMesh.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+namespace mesh {
+
+namespace {
+
+constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+// Dilim sınırları bu kadar örnek ağırlık merkezinden seçilir
+constexpr size_t PARTITION_SAMPLES = 65536;
+
+// Çöküş sonrası yüzey normali bundan fazla dönmemeli (cos ~78°)
+constexpr double MIN_NORMAL_DOT = 0.2;
+
+// Hedefin bu kadar üstü kabul edilir, tek bölgeli son tur atlanır
+constexpr double FINISH_SLACK = 1.02;
+
+/**
+ * @brief Simetrik 4x4 quadric (üst üçgen, 10 eleman)
+ */
+struct Quadric
+{
+    double m[10] = {};
+
+    static Quadric fromPlane(double a, double b, double c, double d)
+    {
+        Quadric q;
+        q.m[0] = a * a; q.m[1] = a * b; q.m[2] = a * c; q.m[3] = a * d;
+        q.m[4] = b * b; q.m[5] = b * c; q.m[6] = b * d;
+        q.m[7] = c * c; q.m[8] = c * d;
+        q.m[9] = d * d;
+        return q;
+    }
+
+    Quadric& operator+=(const Quadric& other)
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            m[i] += other.m[i];
+        }
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const
+    {
+        Quadric result = *this;
+        result += other;
+        return result;
+    }
+
+    double evaluate(double x, double y, double z) const
+    {
+        return m[0] * x * x + 2.0 * m[1] * x * y + 2.0 * m[2] * x * z + 2.0 * m[3] * x
+             + m[4] * y * y + 2.0 * m[5] * y * z + 2.0 * m[6] * y
+             + m[7] * z * z + 2.0 * m[8] * z
+             + m[9];
+    }
+
+    /**
+     * @brief Hatayı en aza indiren konum (A p = -b, Cramer); tekilse false
+     */
+    bool minimum(double& x, double& y, double& z) const
+    {
+        const double a00 = m[0], a01 = m[1], a02 = m[2];
+        const double a11 = m[4], a12 = m[5], a22 = m[7];
+        const double r0 = -m[3], r1 = -m[6], r2 = -m[8];
+
+        const double det = a00 * (a11 * a22 - a12 * a12)
+                         - a01 * (a01 * a22 - a12 * a02)
+                         + a02 * (a01 * a12 - a11 * a02);
+
+        // Düzlem ya da silindir: tek çözüm yok
+        const double scale = std::fabs(a00) + std::fabs(a11) + std::fabs(a22);
+        if (std::fabs(det) <= 1e-9 * scale * scale * scale)
+        {
+            return false;
+        }
+
+        x = (r0 * (a11 * a22 - a12 * a12) - a01 * (r1 * a22 - a12 * r2) + a02 * (r1 * a12 - a11 * r2)) / det;
+        y = (a00 * (r1 * a22 - a12 * r2) - r0 * (a01 * a22 - a12 * a02) + a02 * (a01 * r2 - r1 * a02)) / det;
+        z = (a00 * (a11 * r2 - r1 * a12) - a01 * (a01 * r2 - r1 * a02) + r0 * (a01 * a12 - a11 * a02)) / det;
+        return true;
+    }
+};
+
+struct WorkMesh
+{
+    std::vector<geometry::Vec3> positions;
+    std::vector<Quadric> quadrics;
+    std::vector<uint32_t> indices;
+
+    size_t triangleCount() const { return indices.size() / 3; }
+};
+
+/**
+ * @brief Triangle'ların dilimlere dağılımı (CSR) ve dilim içi vertex numaraları
+ */
+struct Partition
+{
+    std::vector<size_t> start;              // dilim → triangles içindeki ilk
+    std::vector<uint32_t> triangles;
+    std::vector<char> shared;               // vertex → birden fazla dilimde
+
+    std::vector<uint32_t> owner;            // vertex → ilk göründüğü dilim
+    std::vector<uint32_t> localId;          // vertex → owner dilimindeki lokal index
+    std::vector<std::vector<uint32_t>> vertices;                    // dilim → lokal → global
+    std::vector<std::unordered_map<uint32_t, uint32_t>> foreign;    // dilim → paylaşılan → lokal
+
+    size_t count() const { return start.size() - 1; }
+
+    uint32_t local(size_t slab, uint32_t vertex) const
+    {
+        return owner[vertex] == slab ? localId[vertex] : foreign[slab].at(vertex);
+    }
+};
+
+struct CellOutput
+{
+    std::vector<uint32_t> indices;          // Global vertex index'li
+    std::vector<std::pair<uint32_t, Quadric>> lockedDeltas;
+    size_t collapses = 0;
+};
+
+void cross(double ax, double ay, double az, double bx, double by, double bz,
+           double& nx, double& ny, double& nz)
+{
+    nx = ay * bz - az * by;
+    ny = az * bx - ax * bz;
+    nz = ax * by - ay * bx;
+}
+
+void initializeQuadrics(WorkMesh& work)
+{
+    work.quadrics.assign(work.positions.size(), Quadric{});
+
+    for (size_t t = 0; t < work.triangleCount(); ++t)
+    {
+        const uint32_t* v = &work.indices[3 * t];
+        const geometry::Vec3& p0 = work.positions[v[0]];
+        const geometry::Vec3& p1 = work.positions[v[1]];
+        const geometry::Vec3& p2 = work.positions[v[2]];
+
+        double nx, ny, nz;
+        cross(double(p1.x) - p0.x, double(p1.y) - p0.y, double(p1.z) - p0.z,
+              double(p2.x) - p0.x, double(p2.y) - p0.y, double(p2.z) - p0.z, nx, ny, nz);
+
+        const double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+        if (length <= 0.0)
+        {
+            continue;   // Dejenere triangle düzlem tanımlamaz
+        }
+        nx /= length; ny /= length; nz /= length;
+
+        const Quadric q = Quadric::fromPlane(nx, ny, nz, -(nx * p0.x + ny * p0.y + nz * p0.z));
+        work.quadrics[v[0]] += q;
+        work.quadrics[v[1]] += q;
+        work.quadrics[v[2]] += q;
+    }
+}
+
+float axisValue(const geometry::Vec3& p, int axis)
+{
+    return axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+}
+
+/**
+ * @brief Triangle'ları ağırlık merkezine göre eksen boyunca eşit sayılı dilimlere böl
+ * @param shifted Sınırlar yarım dilim kaydırılır (slabs + 1 dilim)
+ */
+Partition partition(const WorkMesh& work, size_t slabs, bool shifted, int axis,
+                    parallel::ThreadPool& pool)
+{
+    const size_t count = work.triangleCount();
+
+    std::vector<float> keys(count);
+    pool.parallelFor(0, count, 65536, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t)
+        {
+            const uint32_t* v = &work.indices[3 * t];
+            keys[t] = axisValue(work.positions[v[0]], axis)
+                    + axisValue(work.positions[v[1]], axis)
+                    + axisValue(work.positions[v[2]], axis);
+        }
+    });
+
+    // Eşit triangle sayısı için sınırlar örneklemin quantile'larından
+    const size_t step = std::max<size_t>(1, count / PARTITION_SAMPLES);
+    std::vector<float> samples;
+    samples.reserve(count / step + 1);
+    for (size_t t = 0; t < count; t += step)
+    {
+        samples.push_back(keys[t]);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    std::vector<float> bounds;
+    for (size_t i = shifted ? 0 : 1; i < slabs; ++i)
+    {
+        const double q = (static_cast<double>(i) + (shifted ? 0.5 : 0.0)) / slabs;
+        bounds.push_back(samples[std::min(samples.size() - 1, static_cast<size_t>(q * samples.size()))]);
+    }
+
+    Partition result;
+    const size_t slabCount = bounds.size() + 1;
+    result.start.assign(slabCount + 1, 0);
+
+    std::vector<uint32_t> slabOf(count);
+    for (size_t t = 0; t < count; ++t)
+    {
+        slabOf[t] = static_cast<uint32_t>(std::upper_bound(bounds.begin(), bounds.end(), keys[t]) - bounds.begin());
+        result.start[slabOf[t] + 1]++;
+    }
+    for (size_t s = 0; s < slabCount; ++s)
+    {
+        result.start[s + 1] += result.start[s];
+    }
+
+    result.triangles.resize(count);
+    std::vector<size_t> cursor(result.start.begin(), result.start.end() - 1);
+    for (size_t t = 0; t < count; ++t)
+    {
+        result.triangles[cursor[slabOf[t]]++] = static_cast<uint32_t>(t);
+    }
+
+    // Lokal vertex numaraları: dilim içinde ilk görülme sırası. Sınır
+    // vertex'leri ilk dilimde sahiplenilir, diğerlerinde küçük tabloda
+    const size_t vertexCount = work.positions.size();
+    result.shared.assign(vertexCount, 0);
+    result.owner.assign(vertexCount, NO_SLOT);
+    result.localId.resize(vertexCount);
+    result.vertices.resize(slabCount);
+    result.foreign.resize(slabCount);
+
+    for (uint32_t slab = 0; slab < slabCount; ++slab)
+    {
+        std::vector<uint32_t>& locals = result.vertices[slab];
+        for (size_t i = result.start[slab]; i < result.start[slab + 1]; ++i)
+        {
+            const uint32_t* v = &work.indices[3 * static_cast<size_t>(result.triangles[i])];
+            for (int c = 0; c < 3; ++c)
+            {
+                const uint32_t vertex = v[c];
+                if (result.owner[vertex] == NO_SLOT)
+                {
+                    result.owner[vertex] = slab;
+                    result.localId[vertex] = static_cast<uint32_t>(locals.size());
+                    locals.push_back(vertex);
+                }
+                else if (result.owner[vertex] != slab)
+                {
+                    result.shared[vertex] = 1;
+                    if (result.foreign[slab].try_emplace(vertex, static_cast<uint32_t>(locals.size())).second)
+                    {
+                        locals.push_back(vertex);
+                    }
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Tek dilimde öncelik kuyruklu edge collapse
+ *
+ * Kilitli vertex'ler (dilim sınırı, açık kenar) yerinden oynamaz; serbest
+ * bir vertex kilitliye çökebilir. Serbest vertex'ler yalnız bu dilime ait
+ * olduğundan konumları ve quadric'leri doğrudan WorkMesh'e yazılır; kilitli
+ * vertex'lerin quadric artışları sonradan sırayla birleştirilir.
+ */
+class CellDecimator
+{
+public:
+    CellDecimator(WorkMesh& work, const Partition& parts, size_t slab, bool preserveBorders)
+        : work_(work)
+        , parts_(parts)
+        , slab_(slab)
+        , preserveBorders_(preserveBorders)
+    {
+    }
+
+    /**
+     * @param ratio Serbest triangle'ların hedef oranı (0 = sadece maxCost)
+     */
+    CellOutput run(const uint32_t* triangles, size_t count, double ratio, double maxCost)
+    {
+        const size_t lockedTriangles = build(triangles, count);
+
+        // Dilim sınırına değen triangle'lar bu turda azalamaz; oran kalanlara
+        // uygulanır, yoksa dilim içi hedefi tutturmak için aşırı sadeleşir
+        const size_t target = ratio > 0.0
+            ? lockedTriangles + static_cast<size_t>(std::ceil((count - lockedTriangles) * ratio))
+            : 0;
+
+        size_t live = count;
+        while (live > target && !heap_.empty())
+        {
+            const Candidate candidate = heap_.top();
+            heap_.pop();
+
+            if (candidate.cost > maxCost)
+            {
+                break;
+            }
+
+            const Vertex& a = vertices_[candidate.a];
+            const Vertex& b = vertices_[candidate.b];
+            if (a.removed || b.removed || a.version + b.version != candidate.stamp)
+            {
+                continue;   // Eski kayıt
+            }
+
+            // Kuyruk kaydı küçük tutulur; hedef konum yeniden hesaplanır
+            Collapse c;
+            evaluate(candidate.a, candidate.b, c);
+            if (!canCollapse(c))
+            {
+                continue;
+            }
+
+            live -= collapse(c);
+            output_.collapses++;
+        }
+
+        finish();
+        return std::move(output_);
+    }
+
+private:
+    struct Vertex
+    {
+        uint32_t global = 0;
+        uint32_t refStart = 0;
+        uint32_t refCount = 0;
+        uint32_t version = 0;
+        uint32_t lockedSlot = NO_SLOT;      // Kilitliyse lockedQuadrics_ içindeki yer
+        bool removed = false;
+    };
+
+    struct Collapse
+    {
+        uint32_t keep;
+        uint32_t drop;
+        double x, y, z;
+        double cost;
+    };
+
+    /**
+     * @brief Kuyruk kaydı; stamp iki vertex'in version toplamı (version'lar
+     *        sadece artar, toplam aynıysa ikisi de değişmemiştir)
+     */
+    struct Candidate
+    {
+        float cost;
+        uint32_t a;
+        uint32_t b;
+        uint32_t stamp;
+
+        bool operator>(const Candidate& other) const { return cost > other.cost; }
+    };
+
+    WorkMesh& work_;
+    const Partition& parts_;
+    size_t slab_;
+    bool preserveBorders_;
+
+    std::vector<Vertex> vertices_;
+    std::vector<uint32_t> corners_;                 // 3 köşe / triangle (lokal vertex)
+    std::vector<char> triangleRemoved_;
+    std::vector<uint32_t> refs_;                    // vertex → köşe index'leri (triangle * 3 + köşe)
+    std::vector<Quadric> lockedQuadrics_;
+    std::vector<Quadric> lockedDeltas_;
+
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> heap_;
+    std::vector<uint32_t> keepNeighbors_;
+    std::vector<uint32_t> dropNeighbors_;
+
+    CellOutput output_;
+
+    bool isLocked(const Vertex& v) const { return v.lockedSlot != NO_SLOT; }
+
+    const Quadric& quadric(const Vertex& v) const
+    {
+        return isLocked(v) ? lockedQuadrics_[v.lockedSlot] : work_.quadrics[v.global];
+    }
+
+    const geometry::Vec3& position(const Vertex& v) const
+    {
+        return work_.positions[v.global];
+    }
+
+    /**
+     * @return Dilim sınırındaki vertex'e değen triangle sayısı
+     */
+    size_t build(const uint32_t* triangles, size_t count)
+    {
+        const std::vector<uint32_t>& globals = parts_.vertices[slab_];
+
+        corners_.resize(count * 3);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint32_t* v = &work_.indices[3 * static_cast<size_t>(triangles[i])];
+            for (int c = 0; c < 3; ++c)
+            {
+                corners_[3 * i + c] = parts_.local(slab_, v[c]);
+            }
+        }
+        triangleRemoved_.assign(count, 0);
+
+        vertices_.resize(globals.size());
+        std::vector<char> locked(globals.size(), 0);
+        for (size_t v = 0; v < globals.size(); ++v)
+        {
+            vertices_[v].global = globals[v];
+            locked[v] = parts_.shared[globals[v]];
+        }
+
+        // vertex → köşe (CSR)
+        for (uint32_t c : corners_)
+        {
+            vertices_[c].refCount++;
+        }
+        uint32_t offset = 0;
+        for (Vertex& v : vertices_)
+        {
+            v.refStart = offset;
+            offset += v.refCount;
+            v.refCount = 0;
+        }
+        refs_.resize(corners_.size());
+        for (uint32_t c = 0; c < corners_.size(); ++c)
+        {
+            Vertex& v = vertices_[corners_[c]];
+            refs_[v.refStart + v.refCount++] = c;
+        }
+
+        // Kenar katlılığı komşuluktan: tek triangle'lı kenar açık kenardır.
+        // Her kenar bir kez (a < b yönünde ya da tek triangle'lıysa) kuyruğa girer
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        edges.reserve(corners_.size() / 2 + 1);
+        for (uint32_t c = 0; c < corners_.size(); ++c)
+        {
+            const uint32_t a = corners_[c];
+            const uint32_t b = corners_[c - c % 3 + (c + 1) % 3];
+
+            const Vertex& va = vertices_[a];
+            size_t multiplicity = 0;
+            for (uint32_t r = va.refStart; r < va.refStart + va.refCount; ++r)
+            {
+                multiplicity += containsVertex(refs_[r] / 3, b);
+            }
+
+            if (multiplicity == 1 && preserveBorders_)
+            {
+                locked[a] = 1;
+                locked[b] = 1;
+            }
+            if (a < b || multiplicity == 1)
+            {
+                edges.emplace_back(a, b);
+            }
+        }
+
+        for (size_t v = 0; v < vertices_.size(); ++v)
+        {
+            if (locked[v])
+            {
+                vertices_[v].lockedSlot = static_cast<uint32_t>(lockedQuadrics_.size());
+                lockedQuadrics_.push_back(work_.quadrics[vertices_[v].global]);
+            }
+        }
+        lockedDeltas_.assign(lockedQuadrics_.size(), Quadric{});
+
+        // Kuyruk tek seferde kurulur (make_heap, O(n))
+        std::vector<Candidate> initial;
+        initial.reserve(edges.size());
+        for (const auto& [a, b] : edges)
+        {
+            Collapse c;
+            if (evaluate(a, b, c))
+            {
+                initial.push_back(Candidate{static_cast<float>(c.cost), a, b, 0});
+            }
+        }
+        heap_ = decltype(heap_)(std::greater<Candidate>(), std::move(initial));
+
+        // Açık kenarlar her turda kilitli, sayılmaz; sadece dilim sınırları
+        size_t lockedTriangles = 0;
+        for (size_t t = 0; t < count; ++t)
+        {
+            const uint32_t* c = &corners_[3 * t];
+            if (parts_.shared[globals[c[0]]] || parts_.shared[globals[c[1]]] || parts_.shared[globals[c[2]]])
+            {
+                lockedTriangles++;
+            }
+        }
+        return lockedTriangles;
+    }
+
+    void pushCandidate(uint32_t a, uint32_t b)
+    {
+        Collapse c;
+        if (evaluate(a, b, c))
+        {
+            heap_.push(Candidate{static_cast<float>(c.cost), a, b,
+                                 vertices_[a].version + vertices_[b].version});
+        }
+    }
+
+    /**
+     * @brief a-b edge'inin çöküş konumu ve hatası; iki uç da kilitliyse false
+     */
+    bool evaluate(uint32_t a, uint32_t b, Collapse& candidate) const
+    {
+        const Vertex& va = vertices_[a];
+        const Vertex& vb = vertices_[b];
+        if (isLocked(va) && isLocked(vb))
+        {
+            return false;
+        }
+
+        const Quadric q = quadric(va) + quadric(vb);
+        const geometry::Vec3& pa = position(va);
+        const geometry::Vec3& pb = position(vb);
+
+        if (isLocked(va) || isLocked(vb))
+        {
+            // Kilitli vertex yerinde kalır, serbest olan ona çöker
+            const bool keepA = isLocked(va);
+            const geometry::Vec3& p = keepA ? pa : pb;
+            candidate.keep = keepA ? a : b;
+            candidate.drop = keepA ? b : a;
+            candidate.x = p.x; candidate.y = p.y; candidate.z = p.z;
+            candidate.cost = q.evaluate(p.x, p.y, p.z);
+        }
+        else
+        {
+            candidate.keep = a;
+            candidate.drop = b;
+
+            const double mx = 0.5 * (double(pa.x) + pb.x);
+            const double my = 0.5 * (double(pa.y) + pb.y);
+            const double mz = 0.5 * (double(pa.z) + pb.z);
+            const double dx = double(pa.x) - pb.x, dy = double(pa.y) - pb.y, dz = double(pa.z) - pb.z;
+
+            double x, y, z;
+            const bool solved = q.minimum(x, y, z) &&
+                (x - mx) * (x - mx) + (y - my) * (y - my) + (z - mz) * (z - mz) <= dx * dx + dy * dy + dz * dz;
+
+            if (solved)
+            {
+                candidate.x = x; candidate.y = y; candidate.z = z;
+                candidate.cost = q.evaluate(x, y, z);
+            }
+            else
+            {
+                // Neredeyse düz bölge: uçlar ve orta noktadan en iyisi
+                const double options[3][3] = {{pa.x, pa.y, pa.z}, {pb.x, pb.y, pb.z}, {mx, my, mz}};
+                candidate.cost = std::numeric_limits<double>::max();
+                for (const auto& o : options)
+                {
+                    const double cost = q.evaluate(o[0], o[1], o[2]);
+                    if (cost < candidate.cost)
+                    {
+                        candidate.cost = cost;
+                        candidate.x = o[0]; candidate.y = o[1]; candidate.z = o[2];
+                    }
+                }
+            }
+        }
+
+        candidate.cost = std::max(0.0, candidate.cost);
+        return true;
+    }
+
+    void gatherNeighbors(const Vertex& v, std::vector<uint32_t>& out) const
+    {
+        out.clear();
+        for (uint32_t r = v.refStart; r < v.refStart + v.refCount; ++r)
+        {
+            const uint32_t corner = refs_[r];
+            const uint32_t t = corner / 3;
+            if (triangleRemoved_[t])
+            {
+                continue;
+            }
+            out.push_back(corners_[3 * t + (corner + 1) % 3]);
+            out.push_back(corners_[3 * t + (corner + 2) % 3]);
+        }
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    /**
+     * @brief Köşesi 'moved' olan triangle, 'moved' (x,y,z)'ye taşınınca ters dönüyor ya da çöküyor mu
+     */
+    bool flips(uint32_t t, uint32_t moved, double x, double y, double z) const
+    {
+        double p[3][3];
+        double q[3][3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const uint32_t v = corners_[3 * t + i];
+            const geometry::Vec3& pos = position(vertices_[v]);
+            p[i][0] = q[i][0] = pos.x;
+            p[i][1] = q[i][1] = pos.y;
+            p[i][2] = q[i][2] = pos.z;
+            if (v == moved)
+            {
+                q[i][0] = x; q[i][1] = y; q[i][2] = z;
+            }
+        }
+
+        double ox, oy, oz, nx, ny, nz;
+        cross(p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2],
+              p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2], ox, oy, oz);
+        cross(q[1][0] - q[0][0], q[1][1] - q[0][1], q[1][2] - q[0][2],
+              q[2][0] - q[0][0], q[2][1] - q[0][1], q[2][2] - q[0][2], nx, ny, nz);
+
+        const double oldLength2 = ox * ox + oy * oy + oz * oz;
+        const double newLength2 = nx * nx + ny * ny + nz * nz;
+        if (newLength2 <= 1e-12 * oldLength2 || newLength2 <= 0.0)
+        {
+            return true;
+        }
+        return ox * nx + oy * ny + oz * nz < MIN_NORMAL_DOT * std::sqrt(oldLength2 * newLength2);
+    }
+
+    bool canCollapse(const Collapse& c)
+    {
+        const Vertex& keep = vertices_[c.keep];
+        const Vertex& drop = vertices_[c.drop];
+
+        // Link koşulu: ortak komşu sayısı edge'i paylaşan triangle sayısını aşmamalı
+        gatherNeighbors(keep, keepNeighbors_);
+        gatherNeighbors(drop, dropNeighbors_);
+
+        size_t edgeTriangles = 0;
+        for (uint32_t r = drop.refStart; r < drop.refStart + drop.refCount; ++r)
+        {
+            const uint32_t t = refs_[r] / 3;
+            if (!triangleRemoved_[t] &&
+                (corners_[3 * t] == c.keep || corners_[3 * t + 1] == c.keep || corners_[3 * t + 2] == c.keep))
+            {
+                edgeTriangles++;
+            }
+        }
+        if (edgeTriangles == 0)
+        {
+            return false;
+        }
+
+        size_t common = 0;
+        for (size_t i = 0, j = 0; i < keepNeighbors_.size() && j < dropNeighbors_.size();)
+        {
+            if (keepNeighbors_[i] < dropNeighbors_[j]) ++i;
+            else if (dropNeighbors_[j] < keepNeighbors_[i]) ++j;
+            else { ++common; ++i; ++j; }
+        }
+        if (common > edgeTriangles)
+        {
+            return false;
+        }
+
+        // Kalan triangle'lar ters dönmemeli
+        for (uint32_t r = drop.refStart; r < drop.refStart + drop.refCount; ++r)
+        {
+            const uint32_t t = refs_[r] / 3;
+            if (!triangleRemoved_[t] && !containsVertex(t, c.keep) &&
+                flips(t, c.drop, c.x, c.y, c.z))
+            {
+                return false;
+            }
+        }
+        if (!isLocked(keep))
+        {
+            for (uint32_t r = keep.refStart; r < keep.refStart + keep.refCount; ++r)
+            {
+                const uint32_t t = refs_[r] / 3;
+                if (!triangleRemoved_[t] && !containsVertex(t, c.drop) &&
+                    flips(t, c.keep, c.x, c.y, c.z))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool containsVertex(uint32_t t, uint32_t v) const
+    {
+        return corners_[3 * t] == v || corners_[3 * t + 1] == v || corners_[3 * t + 2] == v;
+    }
+
+    /**
+     * @brief drop → keep; silinen triangle sayısını döner
+     */
+    size_t collapse(const Collapse& c)
+    {
+        Vertex& keep = vertices_[c.keep];
+        Vertex& drop = vertices_[c.drop];
+
+        size_t removed = 0;
+        const uint32_t newStart = static_cast<uint32_t>(refs_.size());
+
+        for (uint32_t r = keep.refStart; r < keep.refStart + keep.refCount; ++r)
+        {
+            const uint32_t corner = refs_[r];
+            const uint32_t t = corner / 3;
+            if (triangleRemoved_[t])
+            {
+                continue;
+            }
+            if (containsVertex(t, c.drop))
+            {
+                triangleRemoved_[t] = 1;
+                removed++;
+                continue;
+            }
+            refs_.push_back(corner);
+        }
+        for (uint32_t r = drop.refStart; r < drop.refStart + drop.refCount; ++r)
+        {
+            const uint32_t corner = refs_[r];
+            if (triangleRemoved_[corner / 3])
+            {
+                continue;
+            }
+            corners_[corner] = c.keep;
+            refs_.push_back(corner);
+        }
+
+        keep.refStart = newStart;
+        keep.refCount = static_cast<uint32_t>(refs_.size()) - newStart;
+
+        if (isLocked(keep))
+        {
+            lockedQuadrics_[keep.lockedSlot] += quadric(drop);
+            lockedDeltas_[keep.lockedSlot] += quadric(drop);
+        }
+        else
+        {
+            work_.quadrics[keep.global] += quadric(drop);
+            work_.positions[keep.global] = geometry::Vec3(static_cast<float>(c.x),
+                                                          static_cast<float>(c.y),
+                                                          static_cast<float>(c.z));
+        }
+
+        drop.removed = true;
+        drop.refCount = 0;
+        keep.version++;
+
+        gatherNeighbors(keep, keepNeighbors_);
+        for (uint32_t neighbor : keepNeighbors_)
+        {
+            pushCandidate(c.keep, neighbor);
+        }
+
+        return removed;
+    }
+
+    void finish()
+    {
+        const size_t count = triangleRemoved_.size();
+        for (size_t t = 0; t < count; ++t)
+        {
+            if (triangleRemoved_[t])
+            {
+                continue;
+            }
+            for (int i = 0; i < 3; ++i)
+            {
+                output_.indices.push_back(vertices_[corners_[3 * t + i]].global);
+            }
+        }
+
+        for (const Vertex& v : vertices_)
+        {
+            // Plane quadric'lerinin izi (aa + bb + cc) 1'dir: iz > 0 → çöküş almış
+            const Quadric* delta = isLocked(v) ? &lockedDeltas_[v.lockedSlot] : nullptr;
+            if (delta && delta->m[0] + delta->m[4] + delta->m[7] > 0.0)
+            {
+                output_.lockedDeltas.emplace_back(v.global, *delta);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Tek tur: dilimle, dilimleri paralel indir, birleştir
+ * @return Yapılan çöküş sayısı
+ */
+size_t runRound(WorkMesh& work, size_t slabs, bool shifted, int axis, double ratio,
+                double maxCost, bool preserveBorders, parallel::ThreadPool& pool)
+{
+    const Partition parts = partition(work, slabs, shifted, axis, pool);
+    const size_t count = parts.count();
+
+    std::vector<CellOutput> outputs(count);
+    pool.parallelFor(0, count, 1, [&](size_t begin, size_t end) {
+        for (size_t s = begin; s < end; ++s)
+        {
+            const size_t triangles = parts.start[s + 1] - parts.start[s];
+            if (triangles == 0)
+            {
+                continue;
+            }
+            CellDecimator cell(work, parts, s, preserveBorders);
+            outputs[s] = cell.run(parts.triangles.data() + parts.start[s], triangles, ratio, maxCost);
+        }
+    });
+
+    size_t total = 0;
+    size_t collapses = 0;
+    for (const CellOutput& output : outputs)
+    {
+        total += output.indices.size();
+        collapses += output.collapses;
+    }
+
+    // Dikiş: dilimler sınır vertex'lerini paylaşır (global index'ler değişmedi)
+    work.indices.clear();
+    work.indices.reserve(total);
+    for (CellOutput& output : outputs)
+    {
+        work.indices.insert(work.indices.end(), output.indices.begin(), output.indices.end());
+        for (const auto& [vertex, delta] : output.lockedDeltas)
+        {
+            work.quadrics[vertex] += delta;
+        }
+    }
+
+    return collapses;
+}
+
+} // namespace
+
+MeshDecimator::MeshDecimator(const DecimationSettings& settings, parallel::ThreadPool& pool)
+    : settings_(settings)
+    , pool_(pool)
+{
+}
+
+DecimationResult MeshDecimator::decimate(const Mesh& mesh) const
+{
+    DecimationResult result;
+
+    if (mesh.triangles.empty())
+    {
+        result.errorMessage = "Mesh is empty";
+        return result;
+    }
+    if (settings_.targetTriangles == 0 && settings_.maxError <= 0.0f)
+    {
+        result.errorMessage = "Decimation needs a target triangle count or an error bound";
+        return result;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    IndexedMesh indexed = IndexedMesh::fromMesh(mesh);
+    result.inputTriangles = indexed.triangleCount();
+    result.inputVertices = indexed.vertexCount();
+
+    if (settings_.targetTriangles > 0 && settings_.targetTriangles >= result.inputTriangles)
+    {
+        result.mesh = mesh;
+        result.outputTriangles = result.inputTriangles;
+        result.outputVertices = result.inputVertices;
+        return result;
+    }
+
+    WorkMesh work;
+    work.positions = std::move(indexed.vertices);
+    work.indices = std::move(indexed.indices);
+    initializeQuadrics(work);
+
+    const double maxCost = settings_.maxError > 0.0f
+        ? static_cast<double>(settings_.maxError) * settings_.maxError
+        : std::numeric_limits<double>::max();
+
+    // En uzun eksen boyunca dilimle
+    geometry::Vec3 low = work.positions.front();
+    geometry::Vec3 high = low;
+    for (const geometry::Vec3& p : work.positions)
+    {
+        low = geometry::Vec3(std::min(low.x, p.x), std::min(low.y, p.y), std::min(low.z, p.z));
+        high = geometry::Vec3(std::max(high.x, p.x), std::max(high.y, p.y), std::max(high.z, p.z));
+    }
+    const float sx = high.x - low.x;
+    const float sy = high.y - low.y;
+    const float sz = high.z - low.z;
+    const int axis = sx >= sy && sx >= sz ? 0 : (sy >= sz ? 1 : 2);
+
+    // Dilimler inceldikçe kilitli sınır bandı büyür: thread başına iki dilim yeter
+    const size_t maxSlabs = 2 * (static_cast<size_t>(pool_.size()) + 1);
+    const size_t slabs = std::clamp<size_t>(result.inputTriangles / std::max<size_t>(1, settings_.minTrianglesPerPartition),
+                                            1, maxSlabs);
+    result.partitions = slabs;
+
+    auto ratio = [&]() {
+        return settings_.targetTriangles > 0
+            ? static_cast<double>(settings_.targetTriangles) / work.triangleCount()
+            : 0.0;
+    };
+    auto aboveTarget = [&](double slack) {
+        return settings_.targetTriangles == 0 ||
+               work.triangleCount() > settings_.targetTriangles * slack;
+    };
+
+    result.collapses += runRound(work, slabs, false, axis, ratio(), maxCost,
+                                 settings_.preserveBorders, pool_);
+
+    if (slabs > 1 && aboveTarget(1.0))
+    {
+        result.collapses += runRound(work, slabs, true, axis, ratio(), maxCost,
+                                     settings_.preserveBorders, pool_);
+    }
+    if (slabs > 1 && settings_.targetTriangles > 0 && aboveTarget(FINISH_SLACK))
+    {
+        result.collapses += runRound(work, 1, false, axis, ratio(), maxCost,
+                                     settings_.preserveBorders, pool_);
+    }
+
+    // Kullanılan vertex'leri sıkıştır
+    IndexedMesh output;
+    std::vector<uint32_t> remap(work.positions.size(), NO_SLOT);
+    output.indices.resize(work.indices.size());
+    for (size_t i = 0; i < work.indices.size(); ++i)
+    {
+        uint32_t& mapped = remap[work.indices[i]];
+        if (mapped == NO_SLOT)
+        {
+            mapped = static_cast<uint32_t>(output.vertices.size());
+            output.vertices.push_back(work.positions[work.indices[i]]);
+        }
+        output.indices[i] = mapped;
+    }
+
+    result.mesh = output.toMesh();
+    result.mesh.name = mesh.name;
+    result.outputTriangles = output.triangleCount();
+    result.outputVertices = output.vertexCount();
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return result;
+}
+
+} // namespace mesh
+} // namespace core
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "mesh.h"
+#include "core/parallel/ThreadPool.h"
+#include <string>
+
+namespace core {
+namespace mesh {
+
+struct DecimationSettings
+{
+    size_t targetTriangles = 0;         // 0 = sayı sınırı yok (sadece hata sınırı)
+    float maxError = 0.0f;              // mm, 0 = hata sınırı yok
+    bool preserveBorders = true;        // Açık kenarlar (delik sınırları) yerinde kalır
+    size_t minTrianglesPerPartition = 200000;
+};
+
+struct DecimationResult
+{
+    Mesh mesh;
+
+    size_t inputTriangles = 0;
+    size_t outputTriangles = 0;
+    size_t inputVertices = 0;
+    size_t outputVertices = 0;
+    size_t collapses = 0;
+    size_t partitions = 0;              // İlk turdaki bölge sayısı
+    double elapsedMs = 0.0;
+
+    std::string errorMessage;
+
+    bool success() const { return errorMessage.empty(); }
+
+    double reduction() const
+    {
+        return outputTriangles > 0 ? static_cast<double>(inputTriangles) / outputTriangles : 0.0;
+    }
+};
+
+/**
+ * @brief Quadric hata metrikli edge-collapse mesh sadeleştirme
+ *
+ * Viewport ve hızlı analiz için düşük çözünürlüklü vekil (proxy) mesh
+ * üretir; slicing her zaman tam çözünürlüklü mesh'le yapılmalıdır.
+ *
+ * Garland-Heckbert: her vertex komşu yüzey düzlemlerine uzaklık karelerinin
+ * toplamını (quadric) taşır. En ucuz edge önce çöker; yeni vertex quadric'i
+ * en aza indiren konuma oturur. Normali ters çeviren ya da manifold'u bozan
+ * çöküşler reddedilir.
+ *
+ * Paralellik mekânsal bölmeyle:
+ *
+ *  1. Triangle'lar en uzun eksende ağırlık merkezine göre dilimlere ayrılır.
+ *     Birden fazla dilime değen vertex'ler kilitlenir; her dilim kendi
+ *     hedefine (aynı oran) bağımsız ve paralel indirilir.
+ *  2. Dilimler yarım dilim kaydırılarak tekrarlanır: önceki sınırlar artık
+ *     dilim içinde kalır ve sınır bantları dikişlenir.
+ *  3. Hedefe hâlâ ulaşılmadıysa kalan fark tek bölgede kapatılır.
+ *
+ * Quadric'ler turlar arasında korunur; maxError orijinal yüzeye göredir
+ * (mm, düzlem uzaklık kareleri toplamının karekökü, yani üst sınır).
+ */
+class MeshDecimator
+{
+public:
+    explicit MeshDecimator(const DecimationSettings& settings,
+                           parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    DecimationResult decimate(const Mesh& mesh) const;
+
+private:
+    DecimationSettings settings_;
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace mesh
+} // namespace core
@@ -0,0 +1,261 @@
+#include "MeshReorder.h"
+#include "core/geometry/kernels.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+
+namespace core {
+namespace mesh {
+
+namespace {
+
+constexpr size_t KEY_CHUNK = 16384;
+constexpr size_t RADIX_CHUNK = 65536;    // Radix geçişinde parça başına minimum anahtar
+constexpr int RADIX_BITS = 8;
+constexpr size_t RADIX_BUCKETS = size_t(1) << RADIX_BITS;
+
+/**
+ * @brief 21 bit'i her üç bitten birine yay (Morton serpiştirme)
+ */
+inline uint64_t spreadBits3(uint32_t value) noexcept
+{
+    uint64_t v = value & 0x1FFFFFu;
+    v = (v | (v << 32)) & 0x001F00000000FFFFull;
+    v = (v | (v << 16)) & 0x001F0000FF0000FFull;
+    v = (v | (v << 8))  & 0x100F00F00F00F00Full;
+    v = (v | (v << 4))  & 0x10C30C30C30C30C3ull;
+    v = (v | (v << 2))  & 0x1249249249249249ull;
+    return v;
+}
+
+} // namespace
+
+std::vector<uint32_t> MeshReorderResult::inversePermutation() const
+{
+    std::vector<uint32_t> inverse(permutation.size());
+    for (size_t i = 0; i < permutation.size(); ++i)
+    {
+        inverse[permutation[i]] = static_cast<uint32_t>(i);
+    }
+    return inverse;
+}
+
+MeshReorderer::MeshReorderer(parallel::ThreadPool& pool)
+    : pool_(pool)
+{
+}
+
+uint64_t MeshReorderer::mortonKey(uint32_t x, uint32_t y, uint32_t z) noexcept
+{
+    return spreadBits3(x) | (spreadBits3(y) << 1) | (spreadBits3(z) << 2);
+}
+
+uint64_t MeshReorderer::hilbertKey(uint32_t x, uint32_t y, uint32_t z) noexcept
+{
+    // Skilling (2004) "Programming the Hilbert curve": eksenlerden
+    // transpoze Hilbert index'e, ardından bitleri Morton gibi serpiştir
+    uint32_t axes[3] = {x & 0x1FFFFFu, y & 0x1FFFFFu, z & 0x1FFFFFu};
+    const uint32_t top = 1u << (BITS_PER_AXIS - 1);
+
+    for (uint32_t q = top; q > 1; q >>= 1)
+    {
+        const uint32_t p = q - 1;
+        for (int i = 0; i < 3; ++i)
+        {
+            // Bit set ise axes[0]'ın alt bitlerini çevir, değilse axes[i] ile
+            // değiş tokuş et (dallanmasız: veri rastgele, tahmin tutmaz)
+            const uint32_t set = 0u - static_cast<uint32_t>((axes[i] & q) != 0);
+            const uint32_t t = (axes[0] ^ axes[i]) & p & ~set;
+            axes[0] ^= t | (p & set);
+            axes[i] ^= t;
+        }
+    }
+
+    // Gray kodlama
+    axes[1] ^= axes[0];
+    axes[2] ^= axes[1];
+
+    uint32_t t = 0;
+    for (uint32_t q = top; q > 1; q >>= 1)
+    {
+        t ^= (q - 1) & (0u - static_cast<uint32_t>((axes[2] & q) != 0));
+    }
+    axes[0] ^= t;
+    axes[1] ^= t;
+    axes[2] ^= t;
+
+    // axes[0] her seviyenin en anlamlı biti
+    return mortonKey(axes[2], axes[1], axes[0]);
+}
+
+std::vector<uint64_t> MeshReorderer::curveKeys(const Mesh& mesh, SpaceFillingCurve curve) const
+{
+    const size_t count = mesh.triangles.size();
+    std::vector<uint64_t> keys(count);
+
+    if (count == 0)
+    {
+        return keys;
+    }
+
+    // Merkezler mesh sınırları içindedir: sınırlar nicelleme kutusu
+    const geometry::AABB bounds = geometry::kernels::computeBounds(mesh.triangles.data(), count);
+    const float cells = static_cast<float>((1u << BITS_PER_AXIS) - 1);
+
+    const auto axisScale = [cells](float extent) {
+        return extent > 0.0f ? cells / extent : 0.0f;
+    };
+    const float sx = axisScale(bounds.max.x - bounds.min.x);
+    const float sy = axisScale(bounds.max.y - bounds.min.y);
+    const float sz = axisScale(bounds.max.z - bounds.min.z);
+
+    const auto quantize = [cells](float value, float origin, float scale) {
+        const float q = (value - origin) * scale;
+        return q > 0.0f ? static_cast<uint32_t>(std::min(q, cells)) : 0u;   // NaN → 0
+    };
+
+    const geometry::Triangle* tris = mesh.triangles.data();
+    uint64_t* out = keys.data();
+
+    pool_.parallelFor(0, count, KEY_CHUNK, [&](size_t begin, size_t end)
+                      {
+                          for (size_t i = begin; i < end; ++i)
+                          {
+                              const geometry::Triangle& t = tris[i];
+                              const float cx = (t.vertex1.x + t.vertex2.x + t.vertex3.x) * (1.0f / 3.0f);
+                              const float cy = (t.vertex1.y + t.vertex2.y + t.vertex3.y) * (1.0f / 3.0f);
+                              const float cz = (t.vertex1.z + t.vertex2.z + t.vertex3.z) * (1.0f / 3.0f);
+
+                              const uint32_t qx = quantize(cx, bounds.min.x, sx);
+                              const uint32_t qy = quantize(cy, bounds.min.y, sy);
+                              const uint32_t qz = quantize(cz, bounds.min.z, sz);
+
+                              out[i] = curve == SpaceFillingCurve::Hilbert ? hilbertKey(qx, qy, qz)
+                                                                           : mortonKey(qx, qy, qz);
+                          }
+                      });
+
+    return keys;
+}
+
+std::vector<uint32_t> MeshReorderer::sortedOrder(const std::vector<uint64_t>& keys) const
+{
+    const size_t count = keys.size();
+
+    std::vector<uint64_t> keyA(keys), keyB(count);
+    std::vector<uint32_t> idxA(count), idxB(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        idxA[i] = static_cast<uint32_t>(i);
+    }
+
+    if (count < 2)
+    {
+        return idxA;
+    }
+
+    // Tüm anahtarlarda aynı olan bitler: o byte'ın geçişi sırayı değiştirmez
+    uint64_t anyBits = 0, allBits = ~uint64_t(0);
+    for (uint64_t key : keys)
+    {
+        anyBits |= key;
+        allBits &= key;
+    }
+    const uint64_t varyingBits = anyBits ^ allBits;
+
+    // Sabit parçalama: her geçişte aynı parça aynı aralığı işler (kararlılık)
+    const size_t chunkCount = std::max<size_t>(
+        1, std::min<size_t>(count / RADIX_CHUNK, 4 * (static_cast<size_t>(pool_.size()) + 1)));
+    const auto chunkBegin = [count, chunkCount](size_t c) { return count * c / chunkCount; };
+
+    std::vector<std::array<size_t, RADIX_BUCKETS>> histograms(chunkCount);
+
+    for (int shift = 0; shift < 64; shift += RADIX_BITS)
+    {
+        if (((varyingBits >> shift) & (RADIX_BUCKETS - 1)) == 0)
+        {
+            continue;
+        }
+
+        // 1. Parça başına histogram
+        pool_.parallelFor(0, chunkCount, 1, [&](size_t first, size_t last)
+                          {
+                              for (size_t c = first; c < last; ++c)
+                              {
+                                  auto& hist = histograms[c];
+                                  hist.fill(0);
+                                  for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+                                  {
+                                      hist[(keyA[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+                                  }
+                              }
+                          });
+
+        // 2. Bucket-major, parça-minor prefix sum: histogram → yazma konumu
+        size_t offset = 0;
+        for (size_t b = 0; b < RADIX_BUCKETS; ++b)
+        {
+            for (size_t c = 0; c < chunkCount; ++c)
+            {
+                const size_t n = histograms[c][b];
+                histograms[c][b] = offset;
+                offset += n;
+            }
+        }
+
+        // 3. Kararlı dağıtım
+        pool_.parallelFor(0, chunkCount, 1, [&](size_t first, size_t last)
+                          {
+                              for (size_t c = first; c < last; ++c)
+                              {
+                                  auto& pos = histograms[c];
+                                  for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i)
+                                  {
+                                      const size_t dst = pos[(keyA[i] >> shift) & (RADIX_BUCKETS - 1)]++;
+                                      keyB[dst] = keyA[i];
+                                      idxB[dst] = idxA[i];
+                                  }
+                              }
+                          });
+
+        keyA.swap(keyB);
+        idxA.swap(idxB);
+    }
+
+    return idxA;
+}
+
+MeshReorderResult MeshReorderer::reorder(Mesh& mesh, SpaceFillingCurve curve) const
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    MeshReorderResult result;
+    result.curve = curve;
+    result.permutation = sortedOrder(curveKeys(mesh, curve));
+
+    const size_t count = mesh.triangles.size();
+    std::vector<geometry::Triangle> reordered(count);
+
+    const geometry::Triangle* src = mesh.triangles.data();
+    const uint32_t* order = result.permutation.data();
+    geometry::Triangle* dst = reordered.data();
+
+    pool_.parallelFor(0, count, KEY_CHUNK, [=](size_t begin, size_t end)
+                      {
+                          for (size_t i = begin; i < end; ++i)
+                          {
+                              dst[i] = src[order[i]];
+                          }
+                      });
+
+    // Sınırlar değişmez, sadece sıra
+    mesh.triangles.swap(reordered);
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    return result;
+}
+
+} // namespace mesh
+} // namespace core
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "mesh.h"
+#include "core/parallel/ThreadPool.h"
+#include <cstdint>
+#include <vector>
+
+namespace core {
+namespace mesh {
+
+/**
+ * @brief Triangle sıralamasında kullanılan uzay doldurma eğrisi
+ */
+enum class SpaceFillingCurve
+{
+    Morton,     // Z-order: bit serpiştirme, en ucuz anahtar
+    Hilbert     // Komşu anahtarlar daima komşu hücre, daha iyi yerellik
+};
+
+struct MeshReorderResult
+{
+    // Yeni sıra → kaynak triangle index (MeshPart::sourceTriangles ile aynı yön)
+    std::vector<uint32_t> permutation;
+    SpaceFillingCurve curve = SpaceFillingCurve::Morton;
+    double elapsedMs = 0.0;
+
+    /**
+     * @brief Kaynak triangle index → yeni sıra
+     */
+    std::vector<uint32_t> inversePermutation() const;
+};
+
+/**
+ * @brief Triangle'ları merkezlerinin uzay doldurma eğrisi sırasına dizer
+ *
+ * Dosyadaki triangle sırası çoğunlukla uzaysal değildir: komşu triangle'lar
+ * bellekte dağınıktır. Bu, ZIndexedMesh bucket'larının, vertex kaynaklama
+ * (IndexedMesh / komşuluk) hash erişimlerinin ve GPU'ya giden vertex
+ * buffer'ının yerelliğini bozar.
+ *
+ * Merkezler mesh sınırlarında eksen başına 21 bit'e nicelenir, 63 bit
+ * Morton ya da Hilbert anahtarı üretilir ve (anahtar, index) çiftleri
+ * paralel LSD radix sort ile sıralanır (8 bit'lik geçişler; tüm anahtarlarda
+ * aynı olan byte'lar atlanır). Sıralama kararlıdır: eşit anahtarlı
+ * triangle'lar dosya sırasını korur.
+ *
+ * Geometri ve köşe sırası (yön) değişmez, sadece triangle sırası değişir.
+ * Sonuçtaki permütasyon, yeni index'lere göre üretilmiş sonuçları
+ * (ör. doğrulama raporundaki triangle'lar) kaynak sıraya çevirir.
+ */
+class MeshReorderer
+{
+public:
+    static constexpr int BITS_PER_AXIS = 21;
+
+    explicit MeshReorderer(parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    /**
+     * @brief Triangle başına eğri anahtarı (merkez, mesh sınırlarında nicelenmiş)
+     */
+    std::vector<uint64_t> curveKeys(const Mesh& mesh, SpaceFillingCurve curve) const;
+
+    /**
+     * @brief Anahtarları kararlı sıralayan permütasyon (sıra → index)
+     */
+    std::vector<uint32_t> sortedOrder(const std::vector<uint64_t>& keys) const;
+
+    /**
+     * @brief Mesh'i yerinde yeniden sırala
+     */
+    MeshReorderResult reorder(Mesh& mesh, SpaceFillingCurve curve = SpaceFillingCurve::Morton) const;
+
+    static uint64_t mortonKey(uint32_t x, uint32_t y, uint32_t z) noexcept;
+    static uint64_t hilbertKey(uint32_t x, uint32_t y, uint32_t z) noexcept;
+
+private:
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace mesh
+} // namespace core
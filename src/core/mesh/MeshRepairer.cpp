@@ -1,11 +1,258 @@
 #include "MeshRepairer.h"
+#include "IndexedMesh.h"
+#include "core/parallel/ThreadPool.h"
 #include <cmath>
+#include <cstdint>
 #include <unordered_map>
 #include <algorithm>
 
 namespace core {
 namespace mesh {
 
+namespace {
+
+struct BoundaryEdge
+{
+    uint32_t from;
+    uint32_t to;
+};
+
+struct BoundaryLoop
+{
+    std::vector<uint32_t> vertices;     // Sınır kenarları yönünde
+    bool closed = false;
+};
+
+uint64_t edgeKey(uint32_t from, uint32_t to)
+{
+    return (static_cast<uint64_t>(from) << 32) | to;
+}
+
+/**
+ * @brief İkizi olmayan yönlü kenarları kapalı döngülere zincirle
+ */
+std::vector<BoundaryLoop> extractBoundaryLoops(const IndexedMesh& indexed)
+{
+    const size_t triangleCount = indexed.triangleCount();
+
+    std::vector<uint64_t> edges;
+    edges.reserve(3 * triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            edges.push_back(edgeKey(indexed.indices[3 * t + k], indexed.indices[3 * t + (k + 1) % 3]));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    // Sıralı kenarlardan from'a göre sıralı sınır listesi
+    std::vector<BoundaryEdge> boundary;
+    for (uint64_t key : edges)
+    {
+        const uint32_t from = static_cast<uint32_t>(key >> 32);
+        const uint32_t to = static_cast<uint32_t>(key);
+        if (!std::binary_search(edges.begin(), edges.end(), edgeKey(to, from)))
+        {
+            boundary.push_back(BoundaryEdge{from, to});
+        }
+    }
+
+    std::vector<BoundaryLoop> loops;
+    std::vector<bool> used(boundary.size(), false);
+
+    auto nextUnused = [&](uint32_t vertex) -> size_t {
+        auto it = std::lower_bound(boundary.begin(), boundary.end(), vertex,
+                                   [](const BoundaryEdge& e, uint32_t v) { return e.from < v; });
+        for (; it != boundary.end() && it->from == vertex; ++it)
+        {
+            const size_t index = static_cast<size_t>(it - boundary.begin());
+            if (!used[index])
+            {
+                return index;
+            }
+        }
+        return boundary.size();
+    };
+
+    for (size_t first = 0; first < boundary.size(); ++first)
+    {
+        if (used[first])
+        {
+            continue;
+        }
+
+        BoundaryLoop loop;
+        used[first] = true;
+        loop.vertices.push_back(boundary[first].from);
+
+        const uint32_t start = boundary[first].from;
+        uint32_t current = boundary[first].to;
+        while (current != start)
+        {
+            const size_t next = nextUnused(current);
+            if (next == boundary.size())
+            {
+                break;      // Açık zincir (non-manifold sınır)
+            }
+            used[next] = true;
+            loop.vertices.push_back(current);
+            current = boundary[next].to;
+        }
+
+        loop.closed = current == start;
+        loops.push_back(std::move(loop));
+    }
+
+    return loops;
+}
+
+/**
+ * @brief Çokgeni en uygun düzleminde ear clipping ile üçgenle (fan yedekli)
+ *
+ * polygon dolgu yönündedir (sınır döngüsünün tersi); çıktı triangle'ları
+ * Newell normali yönünde, yani çevre yüzeyle aynı sarımda.
+ */
+void triangulateHole(const std::vector<geometry::Vec3>& vertices,
+                     const std::vector<uint32_t>& polygon,
+                     std::vector<uint32_t>& out)
+{
+    const size_t count = polygon.size();
+
+    // Newell normali
+    double nx = 0.0, ny = 0.0, nz = 0.0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const geometry::Vec3& a = vertices[polygon[i]];
+        const geometry::Vec3& b = vertices[polygon[(i + 1) % count]];
+        nx += (static_cast<double>(a.y) - b.y) * (static_cast<double>(a.z) + b.z);
+        ny += (static_cast<double>(a.z) - b.z) * (static_cast<double>(a.x) + b.x);
+        nz += (static_cast<double>(a.x) - b.x) * (static_cast<double>(a.y) + b.y);
+    }
+
+    std::vector<uint32_t> remaining(polygon);
+    const double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+
+    if (length > 0.0)
+    {
+        nx /= length;
+        ny /= length;
+        nz /= length;
+
+        // u × v = n olan düzlem tabanı: çokgen 2B'de saat yönünün tersine
+        double ux = 0.0, uy = nz, uz = -ny;
+        if (std::fabs(nx) >= 0.9)
+        {
+            ux = -nz;
+            uy = 0.0;
+            uz = nx;
+        }
+        const double ul = std::sqrt(ux * ux + uy * uy + uz * uz);
+        ux /= ul;
+        uy /= ul;
+        uz /= ul;
+        const double vx = ny * uz - nz * uy;
+        const double vy = nz * ux - nx * uz;
+        const double vz = nx * uy - ny * ux;
+
+        std::vector<double> px(count);
+        std::vector<double> py(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const geometry::Vec3& p = vertices[polygon[i]];
+            px[i] = p.x * ux + p.y * uy + p.z * uz;
+            py[i] = p.x * vx + p.y * vy + p.z * vz;
+        }
+
+        std::vector<size_t> ring(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ring[i] = i;
+        }
+
+        auto cross = [&](size_t a, size_t b, size_t c) {
+            return (px[b] - px[a]) * (py[c] - py[a]) - (py[b] - py[a]) * (px[c] - px[a]);
+        };
+
+        size_t cursor = 0;
+        while (ring.size() > 3)
+        {
+            bool clipped = false;
+            for (size_t attempt = 0; attempt < ring.size() && !clipped; ++attempt)
+            {
+                const size_t n = ring.size();
+                const size_t i = (cursor + attempt) % n;
+                const size_t a = ring[(i + n - 1) % n];
+                const size_t b = ring[i];
+                const size_t c = ring[(i + 1) % n];
+
+                if (cross(a, b, c) <= 0.0)
+                {
+                    continue;   // Reflex ya da doğrusal köşe
+                }
+
+                bool empty = true;
+                for (size_t k = 0; k < n && empty; ++k)
+                {
+                    const size_t p = ring[k];
+                    if (p == a || p == b || p == c ||
+                        polygon[p] == polygon[a] || polygon[p] == polygon[b] || polygon[p] == polygon[c])
+                    {
+                        continue;
+                    }
+                    empty = !(cross(a, b, p) >= 0.0 && cross(b, c, p) >= 0.0 && cross(c, a, p) >= 0.0);
+                }
+                if (!empty)
+                {
+                    continue;
+                }
+
+                out.push_back(polygon[a]);
+                out.push_back(polygon[b]);
+                out.push_back(polygon[c]);
+                ring.erase(ring.begin() + static_cast<std::ptrdiff_t>(i));
+                cursor = i;
+                clipped = true;
+            }
+
+            if (!clipped)
+            {
+                break;      // Kendini kesen izdüşüm: kalanı fan
+            }
+        }
+
+        remaining.clear();
+        for (size_t index : ring)
+        {
+            remaining.push_back(polygon[index]);
+        }
+    }
+
+    for (size_t i = 1; i + 1 < remaining.size(); ++i)
+    {
+        out.push_back(remaining[0]);
+        out.push_back(remaining[i]);
+        out.push_back(remaining[i + 1]);
+    }
+}
+
+geometry::Vec3 faceNormal(const geometry::Vec3& a, const geometry::Vec3& b, const geometry::Vec3& c)
+{
+    const float e1x = b.x - a.x, e1y = b.y - a.y, e1z = b.z - a.z;
+    const float e2x = c.x - a.x, e2y = c.y - a.y, e2z = c.z - a.z;
+    geometry::Vec3 n(e1y * e2z - e1z * e2y, e1z * e2x - e1x * e2z, e1x * e2y - e1y * e2x);
+    const float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+    if (length > 0.0f)
+    {
+        n.x /= length;
+        n.y /= length;
+        n.z /= length;
+    }
+    return n;
+}
+
+} // namespace
+
 MeshRepairResult MeshRepairer::repair(Mesh& mesh) const
 {
     MeshRepairResult result;
@@ -39,10 +286,27 @@ MeshRepairResult MeshRepairer::repair(Mesh& mesh) const
                          " duplicate vertices");
     }
 
+    // Step 4: Fill holes (open boundaries → open slice contours)
+    auto holeResult = fillHoles(mesh);
+    result.holesFound = holeResult.holesFound;
+    result.holesFilled = holeResult.holesFilled;
+    result.holesSkipped = holeResult.holesSkipped;
+    result.trianglesAdded = holeResult.trianglesAdded;
+    if (holeResult.holesFilled > 0)
+    {
+        result.addAction("Filled " + std::to_string(holeResult.holesFilled) + " holes with " +
+                         std::to_string(holeResult.trianglesAdded) + " triangles");
+    }
+    if (holeResult.holesSkipped > 0)
+    {
+        result.addAction("Left " + std::to_string(holeResult.holesSkipped) +
+                         " holes open (too large to fill)");
+    }
+
     // Final stats
     result.finalTriangles = static_cast<int>(mesh.triangles.size());
     result.finalVertices = result.finalTriangles * 3;
-    result.trianglesRemoved = result.originalTriangles - result.finalTriangles;
+    result.trianglesRemoved = result.originalTriangles + result.trianglesAdded - result.finalTriangles;
 
     if (result.actions.empty())
     {
@@ -184,6 +448,68 @@ MeshRepairResult MeshRepairer::removeInvalidTriangles(Mesh& mesh) const
     return result;
 }
 
+MeshRepairResult MeshRepairer::fillHoles(Mesh& mesh, size_t maxHoleEdges) const
+{
+    MeshRepairResult result;
+    result.originalTriangles = static_cast<int>(mesh.triangles.size());
+
+    if (mesh.triangles.empty())
+    {
+        result.success = false;
+        return result;
+    }
+
+    const IndexedMesh indexed = IndexedMesh::fromMesh(mesh);
+    const std::vector<BoundaryLoop> loops = extractBoundaryLoops(indexed);
+
+    // Doldurulacak döngüler; dolgu yönü sınır yönünün tersi
+    std::vector<std::vector<uint32_t>> holes;
+    for (const BoundaryLoop& loop : loops)
+    {
+        if (!loop.closed || loop.vertices.size() < 3)
+        {
+            continue;
+        }
+        result.holesFound++;
+        if (loop.vertices.size() > maxHoleEdges)
+        {
+            result.holesSkipped++;
+            continue;
+        }
+        holes.emplace_back(loop.vertices.rbegin(), loop.vertices.rend());
+    }
+
+    std::vector<std::vector<uint32_t>> patches(holes.size());
+    parallel::ThreadPool::shared().parallelFor(0, holes.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t h = begin; h < end; ++h)
+        {
+            triangulateHole(indexed.vertices, holes[h], patches[h]);
+        }
+    });
+
+    // Döngü sırasıyla ekle (deterministik)
+    for (const std::vector<uint32_t>& patch : patches)
+    {
+        for (size_t i = 0; i + 2 < patch.size(); i += 3)
+        {
+            const geometry::Vec3& a = indexed.vertices[patch[i]];
+            const geometry::Vec3& b = indexed.vertices[patch[i + 1]];
+            const geometry::Vec3& c = indexed.vertices[patch[i + 2]];
+            mesh.triangles.emplace_back(a, b, c, faceNormal(a, b, c));
+        }
+        result.trianglesAdded += static_cast<int>(patch.size() / 3);
+    }
+    result.holesFilled = static_cast<int>(holes.size());
+
+    if (result.trianglesAdded > 0)
+    {
+        mesh.computeBounds();
+    }
+
+    result.finalTriangles = static_cast<int>(mesh.triangles.size());
+    return result;
+}
+
 float MeshRepairer::triangleArea(const geometry::Triangle& tri) const
 {
     // Area = 0.5 * ||(v2-v1) × (v3-v1)||
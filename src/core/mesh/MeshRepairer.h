@@ -26,6 +26,11 @@ struct MeshRepairResult
     int degenerateTrianglesRemoved = 0;
     int invalidTrianglesRemoved = 0;
 
+    int holesFound = 0;                 // Kapalı sınır döngüleri
+    int holesFilled = 0;
+    int holesSkipped = 0;               // Boyut sınırını aşanlar
+    int trianglesAdded = 0;
+
     // Summary
     std::vector<std::string> actions;
 
@@ -67,6 +72,16 @@ public:
      */
     MeshRepairResult removeInvalidTriangles(Mesh& mesh) const;
 
+    /**
+     * @brief Fill holes (open boundary loops)
+     * Boundary loops come from unmatched half-edges of the welded mesh and
+     * are triangulated in parallel with ear clipping on their best-fit
+     * plane (fan fallback). New triangles follow the surrounding winding.
+     * Run after removeDuplicateVertices: loops are found by exact position.
+     * @param maxHoleEdges Larger loops are left open (default: 200)
+     */
+    MeshRepairResult fillHoles(Mesh& mesh, size_t maxHoleEdges = 200) const;
+
 private:
     // Helpers
     float triangleArea(const geometry::Triangle& tri) const;
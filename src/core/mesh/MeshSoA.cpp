@@ -0,0 +1,84 @@
+#include "MeshSoA.h"
+#include <new>
+
+namespace core {
+namespace mesh {
+
+namespace {
+
+constexpr size_t FLOATS_PER_LINE = MeshSoA::ALIGNMENT / sizeof(float);
+
+// Transpose iş parçası (triangle); küçük mesh'ler tek thread'de kalır
+constexpr size_t TRANSPOSE_CHUNK = 16384;
+
+} // namespace
+
+void MeshSoA::AlignedDeleter::operator()(float* p) const noexcept
+{
+    ::operator delete[](p, std::align_val_t(ALIGNMENT));
+}
+
+MeshSoA::MeshSoA(const Mesh& mesh, parallel::ThreadPool& pool)
+    : count_(mesh.triangles.size())
+    , stride_((mesh.triangles.size() + FLOATS_PER_LINE - 1) / FLOATS_PER_LINE * FLOATS_PER_LINE)
+{
+    if (count_ == 0)
+    {
+        return;
+    }
+
+    const size_t bytes = 9 * stride_ * sizeof(float);
+    data_.reset(static_cast<float*>(::operator new[](bytes, std::align_val_t(ALIGNMENT))));
+
+    float* base = data_.get();
+    const size_t stride = stride_;
+    const geometry::Triangle* tris = mesh.triangles.data();
+
+    pool.parallelFor(0, count_, TRANSPOSE_CHUNK, [=](size_t begin, size_t end)
+                     {
+                         float* x0 = base;              float* x1 = base + stride;     float* x2 = base + 2 * stride;
+                         float* y0 = base + 3 * stride; float* y1 = base + 4 * stride; float* y2 = base + 5 * stride;
+                         float* z0 = base + 6 * stride; float* z1 = base + 7 * stride; float* z2 = base + 8 * stride;
+
+                         for (size_t i = begin; i < end; ++i)
+                         {
+                             const geometry::Triangle& t = tris[i];
+                             x0[i] = t.vertex1.x; y0[i] = t.vertex1.y; z0[i] = t.vertex1.z;
+                             x1[i] = t.vertex2.x; y1[i] = t.vertex2.y; z1[i] = t.vertex2.z;
+                             x2[i] = t.vertex3.x; y2[i] = t.vertex3.y; z2[i] = t.vertex3.z;
+                         }
+                     });
+
+    // Dolgu bölgesi sıfırlanır; dizi sonuna taşan vektör okumaları tanımlı veri görür
+    for (int a = 0; a < 9; ++a)
+    {
+        float* arr = base + a * stride_;
+        for (size_t i = count_; i < stride_; ++i)
+        {
+            arr[i] = 0.0f;
+        }
+    }
+}
+
+geometry::kernels::TriangleArrays MeshSoA::arrays() const noexcept
+{
+    geometry::kernels::TriangleArrays view{};
+    view.count = count_;
+
+    if (count_ == 0)
+    {
+        return view;
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        view.x[c] = x(c);
+        view.y[c] = y(c);
+        view.z[c] = z(c);
+    }
+
+    return view;
+}
+
+} // namespace mesh
+} // namespace core
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "mesh.h"
+#include "core/geometry/kernels.h"
+#include "core/parallel/ThreadPool.h"
+#include <cstddef>
+#include <memory>
+
+namespace core {
+namespace mesh {
+
+/**
+ * @brief Mesh'in structure-of-arrays görünümü (salt okunur, önbelleklenir)
+ *
+ * Triangle dizisi 48 byte'lık AoS kayıtlardır; sadece Z okuyan taramalar
+ * (slicing aday seçimi, Z aralıkları, Z sınırları) her cache line'ın
+ * yalnızca 1/4'ünü kullanır. Bu görünüm köşe koordinatlarını dokuz ayrı
+ * diziye böler (x/y/z × köşe 1-3), böylece Z taraması sadece z dizilerini
+ * okur ve SIMD kernel'leri gather yerine düz load kullanır.
+ *
+ * Tüm diziler tek, ALIGNMENT hizalı bloktadır; her dizinin uzunluğu 16
+ * float'a (64 byte) yuvarlanır, yani her dizi başı hem AVX hem cache line
+ * hizalıdır. Normaller taşınmaz (gerekirse kaynak mesh'ten okunur).
+ *
+ * Görünüm kaynak mesh'in o anki kopyasıdır; mesh değişirse yeniden
+ * oluşturulmalıdır. Triangle sırası kaynakla aynıdır (index i = triangles[i]).
+ */
+class MeshSoA
+{
+public:
+    static constexpr size_t ALIGNMENT = 64;
+
+    MeshSoA() = default;
+    explicit MeshSoA(const Mesh& mesh,
+                     parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    MeshSoA(MeshSoA&&) noexcept = default;
+    MeshSoA& operator=(MeshSoA&&) noexcept = default;
+    MeshSoA(const MeshSoA&) = delete;
+    MeshSoA& operator=(const MeshSoA&) = delete;
+
+    size_t triangleCount() const noexcept { return count_; }
+    bool empty() const noexcept { return count_ == 0; }
+
+    /**
+     * @brief Köşe koordinat dizileri (corner: 0, 1, 2)
+     */
+    const float* x(int corner) const noexcept { return array(corner); }
+    const float* y(int corner) const noexcept { return array(3 + corner); }
+    const float* z(int corner) const noexcept { return array(6 + corner); }
+
+    /**
+     * @brief geometry::kernels SoA fonksiyonları için görünüm
+     */
+    geometry::kernels::TriangleArrays arrays() const noexcept;
+
+    /**
+     * @brief Ayrılan bellek (byte)
+     */
+    size_t memoryBytes() const noexcept { return 9 * stride_ * sizeof(float); }
+
+private:
+    struct AlignedDeleter
+    {
+        void operator()(float* p) const noexcept;
+    };
+
+    const float* array(int index) const noexcept { return data_.get() + index * stride_; }
+
+    std::unique_ptr<float[], AlignedDeleter> data_;
+    size_t count_ = 0;
+    size_t stride_ = 0;   // Dizi başına float (16'nın katı)
+};
+
+} // namespace mesh
+} // namespace core
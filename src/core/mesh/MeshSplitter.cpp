@@ -0,0 +1,213 @@
+#include "MeshSplitter.h"
+#include "IndexedMesh.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+namespace core {
+namespace mesh {
+
+namespace {
+
+constexpr size_t UNION_CHUNK = 16384;
+constexpr uint32_t NO_COMPONENT = 0xFFFFFFFFu;
+
+/**
+ * @brief Kilitsiz union-find (kökler küçük index'e bağlanır, döngü oluşamaz)
+ */
+class ConcurrentUnionFind
+{
+public:
+    explicit ConcurrentUnionFind(size_t count)
+        : parent_(count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            parent_[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t find(uint32_t x)
+    {
+        for (;;)
+        {
+            uint32_t p = parent_[x].load(std::memory_order_relaxed);
+            if (p == x)
+            {
+                return x;
+            }
+            const uint32_t grandparent = parent_[p].load(std::memory_order_relaxed);
+            if (grandparent != p)
+            {
+                // Yol yarılama; başarısızsa başka thread zaten kısaltmış
+                parent_[x].compare_exchange_weak(p, grandparent, std::memory_order_relaxed);
+            }
+            x = grandparent;
+        }
+    }
+
+    void unite(uint32_t a, uint32_t b)
+    {
+        for (;;)
+        {
+            a = find(a);
+            b = find(b);
+            if (a == b)
+            {
+                return;
+            }
+            if (a < b)
+            {
+                std::swap(a, b);
+            }
+
+            // a hâlâ kökse b'ye bağla; değilse arada biri bağlamış, tekrar dene
+            uint32_t expected = a;
+            if (parent_[a].compare_exchange_strong(expected, b, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<uint32_t>> parent_;
+};
+
+} // namespace
+
+MeshSplitter::MeshSplitter(parallel::ThreadPool& pool)
+    : pool_(pool)
+{
+}
+
+std::vector<uint32_t> MeshSplitter::labelComponents(const Mesh& mesh, size_t& componentCount) const
+{
+    return labelComponents(IndexedMesh::fromMesh(mesh), componentCount);
+}
+
+std::vector<uint32_t> MeshSplitter::labelComponents(const IndexedMesh& indexed, size_t& componentCount) const
+{
+    componentCount = 0;
+    const size_t count = indexed.triangleCount();
+    std::vector<uint32_t> labels(count);
+    if (count == 0)
+    {
+        return labels;
+    }
+
+    ConcurrentUnionFind sets(indexed.vertexCount());
+
+    pool_.parallelFor(0, count, UNION_CHUNK, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t)
+        {
+            const uint32_t a = indexed.indices[3 * t];
+            sets.unite(a, indexed.indices[3 * t + 1]);
+            sets.unite(a, indexed.indices[3 * t + 2]);
+        }
+    });
+
+    // Kök → bileşen index'i, ilk triangle sırasıyla (deterministik)
+    std::vector<uint32_t> component(indexed.vertexCount(), NO_COMPONENT);
+    for (size_t t = 0; t < count; ++t)
+    {
+        const uint32_t root = sets.find(indexed.indices[3 * t]);
+        if (component[root] == NO_COMPONENT)
+        {
+            component[root] = static_cast<uint32_t>(componentCount++);
+        }
+        labels[t] = component[root];
+    }
+
+    return labels;
+}
+
+MeshSplitResult MeshSplitter::split(const Mesh& mesh) const
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    MeshSplitResult result;
+
+    const IndexedMesh indexed = IndexedMesh::fromMesh(mesh);
+    result.vertexCount = indexed.vertexCount();
+
+    size_t componentCount = 0;
+    const std::vector<uint32_t> labels = labelComponents(indexed, componentCount);
+
+    // Bileşen başına triangle listesi (CSR)
+    std::vector<uint32_t> offsets(componentCount + 1, 0);
+    for (uint32_t label : labels)
+    {
+        offsets[label + 1]++;
+    }
+    for (size_t c = 0; c < componentCount; ++c)
+    {
+        offsets[c + 1] += offsets[c];
+    }
+    std::vector<uint32_t> members(labels.size());
+    {
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (uint32_t t = 0; t < labels.size(); ++t)
+        {
+            members[cursor[labels[t]]++] = t;
+        }
+    }
+
+    // Büyük parçalar önce; eşitlikte ilk triangle sırası
+    std::vector<uint32_t> order(componentCount);
+    for (uint32_t c = 0; c < componentCount; ++c)
+    {
+        order[c] = c;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+    });
+
+    result.parts.resize(componentCount);
+    pool_.parallelFor(0, componentCount, 1, [&](size_t begin, size_t end) {
+        MeshAnalyzer analyzer;
+        for (size_t i = begin; i < end; ++i)
+        {
+            const uint32_t c = order[i];
+            MeshPart& part = result.parts[i];
+
+            part.sourceTriangles.assign(members.begin() + offsets[c], members.begin() + offsets[c + 1]);
+            part.mesh.name = mesh.name + " #" + std::to_string(i + 1);
+            part.mesh.triangles.reserve(part.sourceTriangles.size());
+            for (uint32_t t : part.sourceTriangles)
+            {
+                part.mesh.triangles.push_back(mesh.triangles[t]);
+            }
+            part.mesh.computeBounds();
+            part.stats = analyzer.analyze(part.mesh);
+        }
+    });
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+Mesh MeshSplitter::merge(const std::vector<MeshPart>& parts)
+{
+    Mesh merged;
+
+    size_t total = 0;
+    for (const MeshPart& part : parts)
+    {
+        total += part.mesh.triangles.size();
+    }
+    merged.reserve(total);
+
+    for (const MeshPart& part : parts)
+    {
+        merged.triangles.insert(merged.triangles.end(),
+                                part.mesh.triangles.begin(), part.mesh.triangles.end());
+    }
+
+    merged.computeBounds();
+    return merged;
+}
+
+} // namespace mesh
+} // namespace core
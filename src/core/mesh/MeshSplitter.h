@@ -0,0 +1,66 @@
+#pragma once
+
+#include "mesh.h"
+#include "MeshAnalyzer.h"
+#include "IndexedMesh.h"
+#include "core/parallel/ThreadPool.h"
+#include <cstdint>
+#include <vector>
+
+namespace core {
+namespace mesh {
+
+/**
+ * @brief Bağlı bileşen (parça): kendi mesh'i, sınırları ve istatistikleri
+ */
+struct MeshPart
+{
+    Mesh mesh;                              // bounds hesaplanmış
+    MeshStatistics stats;
+    std::vector<uint32_t> sourceTriangles;  // Parça triangle'ı → kaynak index
+};
+
+struct MeshSplitResult
+{
+    std::vector<MeshPart> parts;            // Büyükten küçüğe (triangle sayısı)
+    size_t vertexCount = 0;                 // Kaynaklı vertex sayısı
+    double elapsedMs = 0.0;
+
+    size_t partCount() const { return parts.size(); }
+};
+
+/**
+ * @brief Çok parçalı mesh'i bağlı bileşenlerine ayırır
+ *
+ * Ortak vertex'i (birebir konum) olan triangle'lar aynı parçadadır.
+ * Vertex'ler kaynaklandıktan sonra triangle'lar paralel olarak kilitsiz
+ * (CAS tabanlı) union-find'a işlenir: kökler daima küçük index'e bağlanır,
+ * yol yarılama da CAS'la yapılır.
+ *
+ * Parçalar (kopya, bounds, analiz) da paralel üretilir; her parça ayrı
+ * onarılabilir, analiz edilebilir, dilimlenebilir ve tablaya yerleştirilebilir.
+ */
+class MeshSplitter
+{
+public:
+    explicit MeshSplitter(parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    /**
+     * @brief Triangle başına bileşen index'i (ilk triangle sırasıyla 0..count-1)
+     */
+    std::vector<uint32_t> labelComponents(const Mesh& mesh, size_t& componentCount) const;
+    std::vector<uint32_t> labelComponents(const IndexedMesh& indexed, size_t& componentCount) const;
+
+    MeshSplitResult split(const Mesh& mesh) const;
+
+    /**
+     * @brief Parçaları tek mesh'te birleştir (parça sırasıyla)
+     */
+    static Mesh merge(const std::vector<MeshPart>& parts);
+
+private:
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace mesh
+} // namespace core
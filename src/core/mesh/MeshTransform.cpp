@@ -0,0 +1,99 @@
+#include "MeshTransform.h"
+#include "core/parallel/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+namespace mesh {
+
+namespace {
+
+constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+constexpr size_t MIN_TRIANGLES_PER_THREAD = 16384;
+
+using Matrix3 = float[3][3];
+
+void multiply(const Matrix3 a, const Matrix3 b, Matrix3 out)
+{
+    for (int r = 0; r < 3; ++r)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            out[r][c] = a[r][0] * b[0][c] + a[r][1] * b[1][c] + a[r][2] * b[2][c];
+        }
+    }
+}
+
+} // namespace
+
+geometry::kernels::AffineTransform ModelTransform::rotationMatrix() const noexcept
+{
+    const float cx = std::cos(rotation.x * DEG_TO_RAD), sx = std::sin(rotation.x * DEG_TO_RAD);
+    const float cy = std::cos(rotation.y * DEG_TO_RAD), sy = std::sin(rotation.y * DEG_TO_RAD);
+    const float cz = std::cos(rotation.z * DEG_TO_RAD), sz = std::sin(rotation.z * DEG_TO_RAD);
+
+    const Matrix3 rx = {{1, 0, 0}, {0, cx, -sx}, {0, sx, cx}};
+    const Matrix3 ry = {{cy, 0, sy}, {0, 1, 0}, {-sy, 0, cy}};
+    const Matrix3 rz = {{cz, -sz, 0}, {sz, cz, 0}, {0, 0, 1}};
+
+    // MeshRenderer::paintGL ile aynı: Rz * Ry * Rx
+    Matrix3 zy, zyx;
+    multiply(rz, ry, zy);
+    multiply(zy, rx, zyx);
+
+    geometry::kernels::AffineTransform result;
+    for (int r = 0; r < 3; ++r)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            result.m[r][c] = zyx[r][c];
+        }
+        result.m[r][3] = 0.0f;
+    }
+    return result;
+}
+
+geometry::kernels::AffineTransform ModelTransform::toAffine() const noexcept
+{
+    geometry::kernels::AffineTransform result = rotationMatrix();
+    result.m[0][3] = translation.x;
+    result.m[1][3] = translation.y;
+    result.m[2][3] = translation.z;
+    return result;
+}
+
+Mesh MeshTransform::transformed(const Mesh& source,
+                                const geometry::kernels::AffineTransform& transform)
+{
+    Mesh result;
+    result.name = source.name;
+    result.triangles.resize(source.triangles.size());
+
+    const geometry::Triangle* src = source.triangles.data();
+    geometry::Triangle* dst = result.triangles.data();
+
+    // Kopya + transform aynı parçada: her thread kendi cache'i sıcakken dönüştürür
+    parallel::parallelFor(0, source.triangles.size(), MIN_TRIANGLES_PER_THREAD,
+                          [&](size_t begin, size_t end) {
+                              std::copy(src + begin, src + end, dst + begin);
+                              geometry::kernels::transformTriangles(dst + begin, end - begin, transform);
+                          });
+
+    result.computeBounds();
+    return result;
+}
+
+void MeshTransform::apply(Mesh& mesh, const geometry::kernels::AffineTransform& transform)
+{
+    geometry::Triangle* data = mesh.triangles.data();
+
+    parallel::parallelFor(0, mesh.triangles.size(), MIN_TRIANGLES_PER_THREAD,
+                          [&](size_t begin, size_t end) {
+                              geometry::kernels::transformTriangles(data + begin, end - begin, transform);
+                          });
+
+    mesh.computeBounds();
+}
+
+} // namespace mesh
+} // namespace core
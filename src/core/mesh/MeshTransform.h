@@ -0,0 +1,61 @@
+#pragma once
+
+#include "mesh.h"
+#include "core/geometry/kernels.h"
+
+namespace core {
+namespace mesh {
+
+/**
+ * @brief Build plate üzerindeki yerleşim (MeshRenderer ile aynı sıra)
+ *
+ * p' = T * Rz * Ry * Rx * p
+ * Rotasyonlar derece cinsinden, mesh orijini etrafında uygulanır.
+ */
+struct ModelTransform
+{
+    geometry::Vec3 translation;     // mm
+    geometry::Vec3 rotation;        // derece (X, Y, Z)
+
+    bool hasRotation() const noexcept
+    {
+        return rotation.x != 0.0f || rotation.y != 0.0f || rotation.z != 0.0f;
+    }
+
+    bool isIdentity() const noexcept
+    {
+        return !hasRotation() &&
+               translation.x == 0.0f && translation.y == 0.0f && translation.z == 0.0f;
+    }
+
+    /**
+     * @brief Sadece rotasyon kısmı (translation = 0)
+     */
+    geometry::kernels::AffineTransform rotationMatrix() const noexcept;
+
+    /**
+     * @brief Tam affine matris (rotasyon + translation)
+     */
+    geometry::kernels::AffineTransform toAffine() const noexcept;
+};
+
+/**
+ * @brief Mesh'e affine transform uygulama (paralel)
+ */
+class MeshTransform
+{
+public:
+    /**
+     * @brief Dönüştürülmüş kopya oluştur
+     * Kopyalama ve transform thread'ler arasında parçalanır.
+     */
+    static Mesh transformed(const Mesh& source, const geometry::kernels::AffineTransform& transform);
+
+    /**
+     * @brief Mesh'i yerinde dönüştür
+     */
+    static void apply(Mesh& mesh, const geometry::kernels::AffineTransform& transform);
+};
+
+} // namespace mesh
+} // namespace core
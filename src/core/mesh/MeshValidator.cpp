@@ -1,4 +1,5 @@
 #include "MeshValidator.h"
+#include "SelfIntersectionDetector.h"
 #include <cmath>
 #include <unordered_set>
 #include <sstream>
@@ -72,6 +73,25 @@ ValidationResult MeshValidator::validate(const Mesh& mesh) const
         result.addWarning(oss.str());
     }
 
+    // 4. Self-intersection kontrolü (slice'ları bozan kesişen kabuklar)
+    if (checkSelfIntersections_)
+    {
+        SelfIntersectionDetector detector;
+        SelfIntersectionResult intersections = detector.detect(mesh);
+
+        result.selfIntersections = static_cast<int>(intersections.intersectingPairs);
+        result.selfIntersectingTriangles = std::move(intersections.triangles);
+
+        if (intersections.hasIntersections())
+        {
+            std::ostringstream oss;
+            oss << "Mesh is self-intersecting: " << intersections.intersectingPairs
+                << " triangle pairs (" << result.selfIntersectingTriangles.size()
+                << " triangles" << (intersections.truncated() ? " listed" : "") << ")";
+            result.addWarning(oss.str());
+        }
+    }
+
     // Özet
     if (result.isValid)
     {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "mesh.h"
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -20,6 +21,10 @@ struct ValidationResult
     int degenerateTriangles = 0;            // Sıfır alanlı üçgenler
     int invalidVertices = 0;                // NaN/Inf koordinatlar
     int duplicateVertices = 0;              // Aynı konumda vertex'ler
+    int selfIntersections = 0;              // Kesişen triangle çiftleri
+
+    // Kesişen triangle index'leri (vurgulama için)
+    std::vector<uint32_t> selfIntersectingTriangles;
 
     void addError(const std::string& error) {
         errors.push_back(error);
@@ -56,9 +61,15 @@ public:
      */
     void setVertexTolerance(float tolerance) { vertexTolerance_ = tolerance; }
 
+    /**
+     * @brief Self-intersection kontrolü (BVH + kesin test, milyon triangle'da saniyeler)
+     */
+    void setCheckSelfIntersections(bool check) { checkSelfIntersections_ = check; }
+
 private:
     float minTriangleArea_ = 1e-6f;         // Minimum triangle area
     float vertexTolerance_ = 1e-5f;         // Vertex equality tolerance
+    bool checkSelfIntersections_ = true;
 
     // Yardımcı fonksiyonlar
     bool isDegenerate(const geometry::Triangle& tri) const;
@@ -1,11 +1,40 @@
 #include "NormalProcessor.h"
+#include "IndexedMesh.h"
+#include "core/geometry/kernels.h"
+#include "core/parallel/ThreadPool.h"
+#include <algorithm>
 #include <cmath>
-#include <unordered_map>
+#include <cstdint>
 #include <vector>
 
 namespace core {
 namespace mesh {
 
+namespace {
+
+constexpr uint32_t NO_NEIGHBOR = 0xFFFFFFFFu;
+constexpr size_t NORMAL_CHUNK = 16384;
+
+struct EdgeUse
+{
+    uint64_t key;           // (küçük vertex, büyük vertex)
+    uint32_t triangle;
+    uint8_t corner;         // Kenar corner → corner + 1
+    bool forward;           // Küçükten büyüğe mi yürüyor
+};
+
+uint32_t findRoot(std::vector<uint32_t>& parent, uint32_t x)
+{
+    while (parent[x] != x)
+    {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+} // namespace
+
 NormalProcessingResult NormalProcessor::recalculateNormals(Mesh& mesh) const
 {
     NormalProcessingResult result;
@@ -16,19 +45,56 @@ NormalProcessingResult NormalProcessor::recalculateNormals(Mesh& mesh) const
         return result;
     }
 
-    // Recalculate normal for each triangle
-    for (auto& tri : mesh.triangles)
+    // Recalculate normal for each triangle (SIMD kernel)
+    std::vector<geometry::Vec3> normals(mesh.triangles.size());
+    geometry::kernels::computeNormalsAndAreas(mesh.triangles.data(), mesh.triangles.size(),
+                                              normals.data(), nullptr);
+
+    for (size_t i = 0; i < mesh.triangles.size(); ++i)
     {
-        tri.normal = computeNormal(tri);
-        result.normalsRecalculated++;
+        mesh.triangles[i].normal = normals[i];
     }
+    result.normalsRecalculated = static_cast<int>(mesh.triangles.size());
 
     return result;
 }
 
 NormalProcessingResult NormalProcessor::smoothNormals(Mesh& mesh, float angleThreshold) const
+{
+    std::vector<geometry::Vec3> cornerNormals;
+    NormalProcessingResult result = computeVertexNormals(mesh, cornerNormals, angleThreshold);
+    if (!result.success)
+    {
+        return result;
+    }
+
+    result.normalsSmoothed = 0;
+    for (size_t i = 0; i < mesh.triangles.size(); ++i)
+    {
+        const geometry::Vec3& a = cornerNormals[3 * i];
+        const geometry::Vec3& b = cornerNormals[3 * i + 1];
+        const geometry::Vec3& c = cornerNormals[3 * i + 2];
+        const geometry::Vec3 smoothed = normalize(geometry::Vec3(a.x + b.x + c.x,
+                                                                 a.y + b.y + c.y,
+                                                                 a.z + b.z + c.z));
+
+        geometry::Vec3& normal = mesh.triangles[i].normal;
+        if (smoothed.x != normal.x || smoothed.y != normal.y || smoothed.z != normal.z)
+        {
+            normal = smoothed;
+            result.normalsSmoothed++;
+        }
+    }
+
+    return result;
+}
+
+NormalProcessingResult NormalProcessor::computeVertexNormals(const Mesh& mesh,
+                                                             std::vector<geometry::Vec3>& cornerNormals,
+                                                             float creaseAngle) const
 {
     NormalProcessingResult result;
+    cornerNormals.clear();
 
     if (mesh.triangles.empty())
     {
@@ -36,106 +102,93 @@ NormalProcessingResult NormalProcessor::smoothNormals(Mesh& mesh, float angleThr
         return result;
     }
 
-    // Build vertex → triangles map
-    // Key: vertex position (rounded), Value: list of triangle indices
-    struct VertexKey {
-        int x, y, z;
-
-        bool operator==(const VertexKey& other) const {
-            return x == other.x && y == other.y && z == other.z;
-        }
-    };
+    parallel::ThreadPool& pool = parallel::ThreadPool::shared();
+    const IndexedMesh indexed = IndexedMesh::fromMesh(mesh);
+    const size_t count = indexed.triangleCount();
 
-    struct VertexKeyHash {
-        std::size_t operator()(const VertexKey& k) const {
-            return std::hash<int>()(k.x) ^
-                   (std::hash<int>()(k.y) << 1) ^
-                   (std::hash<int>()(k.z) << 2);
-        }
-    };
+    // 1. Face normalleri (SIMD kernel) ve köşe açıları (ağırlık)
+    std::vector<geometry::Vec3> faceNormals(count);
+    std::vector<float> cornerAngles(3 * count);
 
-    std::unordered_map<VertexKey, std::vector<size_t>, VertexKeyHash> vertexMap;
+    pool.parallelFor(0, count, NORMAL_CHUNK, [&](size_t begin, size_t end) {
+        geometry::kernels::computeNormalsAndAreas(mesh.triangles.data() + begin, end - begin,
+                                                  faceNormals.data() + begin, nullptr);
 
-    auto makeKey = [](const geometry::Vec3& v) -> VertexKey {
-        const float scale = 10000.0f;
-        return {
-            static_cast<int>(v.x * scale),
-            static_cast<int>(v.y * scale),
-            static_cast<int>(v.z * scale)
-        };
-    };
+        for (size_t t = begin; t < end; ++t)
+        {
+            for (int k = 0; k < 3; ++k)
+            {
+                const geometry::Vec3& p = indexed.vertices[indexed.indices[3 * t + k]];
+                const geometry::Vec3& q = indexed.vertices[indexed.indices[3 * t + (k + 1) % 3]];
+                const geometry::Vec3& r = indexed.vertices[indexed.indices[3 * t + (k + 2) % 3]];
+                const float ax = q.x - p.x, ay = q.y - p.y, az = q.z - p.z;
+                const float bx = r.x - p.x, by = r.y - p.y, bz = r.z - p.z;
+                const float cx = ay * bz - az * by;
+                const float cy = az * bx - ax * bz;
+                const float cz = ax * by - ay * bx;
+                cornerAngles[3 * t + k] = std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz),
+                                                     ax * bx + ay * by + az * bz);
+            }
+        }
+    });
 
-    // Populate map
-    for (size_t i = 0; i < mesh.triangles.size(); ++i)
+    // 2. Vertex → köşe CSR
+    const size_t vertexCount = indexed.vertexCount();
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (uint32_t v : indexed.indices)
     {
-        const auto& tri = mesh.triangles[i];
-        vertexMap[makeKey(tri.vertex1)].push_back(i);
-        vertexMap[makeKey(tri.vertex2)].push_back(i);
-        vertexMap[makeKey(tri.vertex3)].push_back(i);
+        offsets[v + 1]++;
+    }
+    for (size_t v = 0; v < vertexCount; ++v)
+    {
+        offsets[v + 1] += offsets[v];
+    }
+    std::vector<uint32_t> corners(indexed.indices.size());
+    {
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (uint32_t c = 0; c < indexed.indices.size(); ++c)
+        {
+            corners[cursor[indexed.indices[c]]++] = c;
+        }
     }
 
-    // Smooth each triangle's normal
-    std::vector<geometry::Vec3> newNormals(mesh.triangles.size());
+    // 3. Köşe başına toplama; eşik önceden kosinüs
+    const float creaseCos = std::cos(creaseAngle * 3.14159265f / 180.0f);
+    cornerNormals.resize(3 * count);
 
-    for (size_t i = 0; i < mesh.triangles.size(); ++i)
-    {
-        const auto& tri = mesh.triangles[i];
-        geometry::Vec3 avgNormal = tri.normal;
-        int count = 1;
+    pool.parallelFor(0, count, NORMAL_CHUNK, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t)
+        {
+            const geometry::Vec3& own = faceNormals[t];
 
-        // Find neighbors (triangles sharing vertices)
-        auto addNeighbors = [&](const geometry::Vec3& vertex) {
-            auto it = vertexMap.find(makeKey(vertex));
-            if (it != vertexMap.end())
+            for (int k = 0; k < 3; ++k)
             {
-                for (size_t neighborIdx : it->second)
+                const uint32_t vertex = indexed.indices[3 * t + k];
+                float sx = 0.0f, sy = 0.0f, sz = 0.0f;
+
+                for (uint32_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i)
                 {
-                    if (neighborIdx != i)
+                    const uint32_t corner = corners[i];
+                    const geometry::Vec3& other = faceNormals[corner / 3];
+                    if (dot(own, other) < creaseCos)
                     {
-                        const auto& neighborNormal = mesh.triangles[neighborIdx].normal;
-
-                        // Only average if angle is small enough
-                        float dotProd = dot(tri.normal, neighborNormal);
-                        float angleRad = std::acos(std::min(std::max(dotProd, -1.0f), 1.0f));
-                        float angleDeg = angleRad * 180.0f / 3.14159f;
-
-                        if (angleDeg < angleThreshold)
-                        {
-                            avgNormal.x += neighborNormal.x;
-                            avgNormal.y += neighborNormal.y;
-                            avgNormal.z += neighborNormal.z;
-                            count++;
-                        }
+                        continue;   // Sert kenar
                     }
+                    const float weight = cornerAngles[corner];
+                    sx += weight * other.x;
+                    sy += weight * other.y;
+                    sz += weight * other.z;
                 }
-            }
-        };
 
-        addNeighbors(tri.vertex1);
-        addNeighbors(tri.vertex2);
-        addNeighbors(tri.vertex3);
-
-        // Average
-        if (count > 1)
-        {
-            avgNormal.x /= count;
-            avgNormal.y /= count;
-            avgNormal.z /= count;
-            newNormals[i] = normalize(avgNormal);
-            result.normalsSmoothed++;
-        }
-        else
-        {
-            newNormals[i] = tri.normal;
+                const float length = std::sqrt(sx * sx + sy * sy + sz * sz);
+                cornerNormals[3 * t + k] = length > 1e-12f
+                    ? geometry::Vec3(sx / length, sy / length, sz / length)
+                    : own;
+            }
         }
-    }
-
-    // Apply new normals
-    for (size_t i = 0; i < mesh.triangles.size(); ++i)
-    {
-        mesh.triangles[i].normal = newNormals[i];
-    }
+    });
 
+    result.normalsRecalculated = static_cast<int>(cornerNormals.size());
     return result;
 }
 
@@ -154,23 +207,216 @@ NormalProcessingResult NormalProcessor::flipNormals(Mesh& mesh) const
     return result;
 }
 
-geometry::Vec3 NormalProcessor::computeNormal(const geometry::Triangle& tri) const
+NormalProcessingResult NormalProcessor::orientWinding(Mesh& mesh) const
 {
-    // Edge vectors
-    float dx1 = tri.vertex2.x - tri.vertex1.x;
-    float dy1 = tri.vertex2.y - tri.vertex1.y;
-    float dz1 = tri.vertex2.z - tri.vertex1.z;
+    NormalProcessingResult result;
+
+    if (mesh.triangles.empty())
+    {
+        result.success = false;
+        return result;
+    }
+
+    const IndexedMesh indexed = IndexedMesh::fromMesh(mesh);
+    const uint32_t count = static_cast<uint32_t>(indexed.triangleCount());
+
+    // 1. Kenar komşuluğu: tam iki triangle'ın paylaştığı kenarlar
+    std::vector<EdgeUse> edges(3 * static_cast<size_t>(count));
+    for (uint32_t t = 0; t < count; ++t)
+    {
+        for (uint8_t k = 0; k < 3; ++k)
+        {
+            const uint32_t a = indexed.indices[3 * t + k];
+            const uint32_t b = indexed.indices[3 * t + (k + 1) % 3];
+            const uint32_t lo = std::min(a, b);
+            const uint32_t hi = std::max(a, b);
+            edges[3 * t + k] = EdgeUse{(static_cast<uint64_t>(lo) << 32) | hi, t, k, a < b};
+        }
+    }
+    std::sort(edges.begin(), edges.end(),
+              [](const EdgeUse& x, const EdgeUse& y) { return x.key < y.key; });
+
+    std::vector<uint32_t> neighbors(edges.size(), NO_NEIGHBOR);
+    std::vector<uint8_t> sameDirection(edges.size(), 0);   // Aynı yönde = biri ters
+    std::vector<uint32_t> parent(count);
+    for (uint32_t t = 0; t < count; ++t)
+    {
+        parent[t] = t;
+    }
+
+    for (size_t i = 0; i < edges.size();)
+    {
+        size_t j = i + 1;
+        while (j < edges.size() && edges[j].key == edges[i].key)
+        {
+            ++j;
+        }
+
+        // Non-manifold (3+) kenarlar üzerinden yön yayılmaz
+        if (j - i == 2)
+        {
+            const EdgeUse& x = edges[i];
+            const EdgeUse& y = edges[i + 1];
+            const uint8_t same = x.forward == y.forward ? 1 : 0;
+            neighbors[3 * x.triangle + x.corner] = y.triangle;
+            neighbors[3 * y.triangle + y.corner] = x.triangle;
+            sameDirection[3 * x.triangle + x.corner] = same;
+            sameDirection[3 * y.triangle + y.corner] = same;
+
+            const uint32_t rx = findRoot(parent, x.triangle);
+            const uint32_t ry = findRoot(parent, y.triangle);
+            if (rx != ry)
+            {
+                parent[std::max(rx, ry)] = std::min(rx, ry);
+            }
+        }
+        i = j;
+    }
 
-    float dx2 = tri.vertex3.x - tri.vertex1.x;
-    float dy2 = tri.vertex3.y - tri.vertex1.y;
-    float dz2 = tri.vertex3.z - tri.vertex1.z;
+    // 2. Bileşenler (CSR: ilk triangle sırasıyla)
+    std::vector<uint32_t> label(count);
+    std::vector<uint32_t> componentOf(count, NO_NEIGHBOR);
+    uint32_t components = 0;
+    for (uint32_t t = 0; t < count; ++t)
+    {
+        const uint32_t root = findRoot(parent, t);
+        if (componentOf[root] == NO_NEIGHBOR)
+        {
+            componentOf[root] = components++;
+        }
+        label[t] = componentOf[root];
+    }
 
-    // Cross product
-    float nx = dy1 * dz2 - dz1 * dy2;
-    float ny = dz1 * dx2 - dx1 * dz2;
-    float nz = dx1 * dy2 - dy1 * dx2;
+    std::vector<uint32_t> start(components + 1, 0);
+    for (uint32_t t = 0; t < count; ++t)
+    {
+        start[label[t] + 1]++;
+    }
+    for (uint32_t c = 0; c < components; ++c)
+    {
+        start[c + 1] += start[c];
+    }
+    std::vector<uint32_t> members(count);
+    {
+        std::vector<uint32_t> cursor(start.begin(), start.end() - 1);
+        for (uint32_t t = 0; t < count; ++t)
+        {
+            members[cursor[label[t]]++] = t;
+        }
+    }
+
+    // 3. Bileşen başına flood fill + işaretli hacim (bileşenler paralel)
+    std::vector<uint8_t> flip(count, 0);
+    std::vector<uint8_t> visited(count, 0);
+    std::vector<uint8_t> inverted(components, 0);
+    std::vector<int> conflicts(components, 0);
 
-    return normalize(geometry::Vec3(nx, ny, nz));
+    parallel::ThreadPool::shared().parallelFor(0, components, 1, [&](size_t begin, size_t end) {
+        std::vector<uint32_t> queue;
+
+        for (size_t c = begin; c < end; ++c)
+        {
+            // İlk triangle referans: diğerleri ona uyar
+            const uint32_t seed = members[start[c]];
+            visited[seed] = 1;
+            queue.assign(1, seed);
+
+            for (size_t head = 0; head < queue.size(); ++head)
+            {
+                const uint32_t t = queue[head];
+                for (int k = 0; k < 3; ++k)
+                {
+                    const uint32_t neighbor = neighbors[3 * t + k];
+                    if (neighbor == NO_NEIGHBOR)
+                    {
+                        continue;
+                    }
+                    const uint8_t wanted = flip[t] ^ sameDirection[3 * t + k];
+                    if (!visited[neighbor])
+                    {
+                        visited[neighbor] = 1;
+                        flip[neighbor] = wanted;
+                        queue.push_back(neighbor);
+                    }
+                    else if (flip[neighbor] != wanted)
+                    {
+                        conflicts[c]++;
+                    }
+                }
+            }
+
+            // Bileşen merkezine göre işaretli hacim (açık kabukta da kararlı)
+            double cx = 0.0, cy = 0.0, cz = 0.0;
+            for (uint32_t i = start[c]; i < start[c + 1]; ++i)
+            {
+                for (int k = 0; k < 3; ++k)
+                {
+                    const geometry::Vec3& v = indexed.vertices[indexed.indices[3 * members[i] + k]];
+                    cx += v.x;
+                    cy += v.y;
+                    cz += v.z;
+                }
+            }
+            const double corners = 3.0 * (start[c + 1] - start[c]);
+            cx /= corners;
+            cy /= corners;
+            cz /= corners;
+
+            double volume = 0.0;
+            for (uint32_t i = start[c]; i < start[c + 1]; ++i)
+            {
+                const uint32_t t = members[i];
+                const geometry::Vec3& a = indexed.vertices[indexed.indices[3 * t]];
+                const geometry::Vec3& b = indexed.vertices[indexed.indices[3 * t + (flip[t] ? 2 : 1)]];
+                const geometry::Vec3& d = indexed.vertices[indexed.indices[3 * t + (flip[t] ? 1 : 2)]];
+
+                const double ax = a.x - cx, ay = a.y - cy, az = a.z - cz;
+                const double bx = b.x - cx, by = b.y - cy, bz = b.z - cz;
+                const double dx = d.x - cx, dy = d.y - cy, dz = d.z - cz;
+                volume += ax * (by * dz - bz * dy) - ay * (bx * dz - bz * dx) + az * (bx * dy - by * dx);
+            }
+
+            if (volume < 0.0)
+            {
+                inverted[c] = 1;
+                for (uint32_t i = start[c]; i < start[c + 1]; ++i)
+                {
+                    flip[members[i]] ^= 1;
+                }
+            }
+        }
+    });
+
+    // 4. Ters triangle'ları çevir, normallerini yeniden hesapla
+    for (uint32_t t = 0; t < count; ++t)
+    {
+        if (!flip[t])
+        {
+            continue;
+        }
+        geometry::Triangle& tri = mesh.triangles[t];
+        std::swap(tri.vertex2, tri.vertex3);
+
+        const geometry::Vec3 e1(tri.vertex2.x - tri.vertex1.x, tri.vertex2.y - tri.vertex1.y,
+                                tri.vertex2.z - tri.vertex1.z);
+        const geometry::Vec3 e2(tri.vertex3.x - tri.vertex1.x, tri.vertex3.y - tri.vertex1.y,
+                                tri.vertex3.z - tri.vertex1.z);
+        tri.normal = normalize(geometry::Vec3(e1.y * e2.z - e1.z * e2.y,
+                                              e1.z * e2.x - e1.x * e2.z,
+                                              e1.x * e2.y - e1.y * e2.x));
+        result.trianglesReoriented++;
+    }
+
+    result.components = static_cast<int>(components);
+    for (uint32_t c = 0; c < components; ++c)
+    {
+        result.componentsInverted += inverted[c];
+        result.orientationConflicts += conflicts[c];
+    }
+    // Her çelişkili kenar iki uçtan da sayılır
+    result.orientationConflicts /= 2;
+
+    return result;
 }
 
 geometry::Vec3 NormalProcessor::normalize(const geometry::Vec3& v) const
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "mesh.h"
+#include <vector>
 
 namespace core {
 namespace mesh {
@@ -13,6 +14,13 @@ struct NormalProcessingResult
     int normalsRecalculated = 0;
     int normalsSmoothed = 0;
     int normalsFlipped = 0;
+
+    // Winding orientation
+    int trianglesReoriented = 0;
+    int components = 0;                 // Kenar komşuluğuyla bağlı parçalar
+    int componentsInverted = 0;         // İçe dönük olup ters çevrilenler
+    int orientationConflicts = 0;       // Yönlendirilemeyen kenarlar (Möbius vb.)
+
     bool success = true;
 };
 
@@ -32,21 +40,41 @@ public:
 
     /**
      * @brief Smooth normals by averaging neighbors
-     * Creates smoother shading (but changes geometry slightly)
+     * Each face normal becomes the mean of its three vertex normals
+     * (see computeVertexNormals); still one normal per face.
      * @param angleThreshold Only smooth if angle < threshold (degrees)
      */
     NormalProcessingResult smoothNormals(Mesh& mesh, float angleThreshold = 30.0f) const;
 
+    /**
+     * @brief Per-corner vertex normals for smooth shading
+     * Welded vertex → face adjacency is built once (CSR). Each corner sums
+     * the angle-weighted normals of the faces around its vertex whose
+     * normal is within creaseAngle of its own face; sharper edges keep a
+     * hard crease. Corners are computed in parallel (gather, no atomics).
+     * @param cornerNormals Output, 3 per triangle (vertex1, vertex2, vertex3)
+     * @param creaseAngle Degrees
+     */
+    NormalProcessingResult computeVertexNormals(const Mesh& mesh,
+                                                std::vector<geometry::Vec3>& cornerNormals,
+                                                float creaseAngle = 30.0f) const;
+
     /**
      * @brief Flip all normals (reverse direction)
      * Useful for inside-out meshes
      */
     NormalProcessingResult flipNormals(Mesh& mesh) const;
 
-private:
-    // Helper: compute normal for a triangle
-    geometry::Vec3 computeNormal(const geometry::Triangle& tri) const;
+    /**
+     * @brief Make triangle winding consistent and outward
+     * Flood-fills winding across shared (manifold) edges of each connected
+     * component, then inverts components whose signed volume is negative.
+     * Components are processed concurrently. Flipped triangles get their
+     * vertex order reversed and their normal recomputed.
+     */
+    NormalProcessingResult orientWinding(Mesh& mesh) const;
 
+private:
     // Helper: normalize vector
     geometry::Vec3 normalize(const geometry::Vec3& v) const;
 
@@ -0,0 +1,213 @@
+#include "SelfIntersectionDetector.h"
+#include "core/geometry/BVH.h"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+namespace core {
+namespace mesh {
+
+namespace {
+
+constexpr size_t TRIANGLE_CHUNK = 2048;
+
+struct Point
+{
+    double x, y, z;
+};
+
+Point toPoint(const geometry::Vec3& v)
+{
+    return Point{v.x, v.y, v.z};
+}
+
+/**
+ * @brief d noktası (a, b, c) düzleminin hangi tarafında (işaretli hacim * 6)
+ */
+double orient(const Point& a, const Point& b, const Point& c, const Point& d)
+{
+    const double bx = b.x - a.x, by = b.y - a.y, bz = b.z - a.z;
+    const double cx = c.x - a.x, cy = c.y - a.y, cz = c.z - a.z;
+    const double dx = d.x - a.x, dy = d.y - a.y, dz = d.z - a.z;
+    return bx * (cy * dz - cz * dy) - by * (cx * dz - cz * dx) + bz * (cx * dy - cy * dx);
+}
+
+/**
+ * @brief pq kenarı triangle'ı deliyor mu (uçlar düzlemin kesin iki yanında)
+ */
+bool segmentPierces(const Point& p, const Point& q, const Point tri[3])
+{
+    const double sp = orient(tri[0], tri[1], tri[2], p);
+    const double sq = orient(tri[0], tri[1], tri[2], q);
+    if (sp == 0.0 || sq == 0.0 || (sp > 0.0) == (sq > 0.0))
+    {
+        return false;
+    }
+
+    // Düzlemi geçiş noktası triangle içinde mi (kenar üstü dahil)
+    const double o1 = orient(p, q, tri[0], tri[1]);
+    const double o2 = orient(p, q, tri[1], tri[2]);
+    const double o3 = orient(p, q, tri[2], tri[0]);
+    return (o1 >= 0.0 && o2 >= 0.0 && o3 >= 0.0) || (o1 <= 0.0 && o2 <= 0.0 && o3 <= 0.0);
+}
+
+/**
+ * @brief Tüm köşeler düzlemin kesin aynı tarafındaysa ayrıktır
+ */
+bool separatedByPlane(const Point plane[3], const Point other[3])
+{
+    const double s0 = orient(plane[0], plane[1], plane[2], other[0]);
+    const double s1 = orient(plane[0], plane[1], plane[2], other[1]);
+    const double s2 = orient(plane[0], plane[1], plane[2], other[2]);
+    return (s0 > 0.0 && s1 > 0.0 && s2 > 0.0) || (s0 < 0.0 && s1 < 0.0 && s2 < 0.0);
+}
+
+bool samePosition(const geometry::Vec3& a, const geometry::Vec3& b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+bool trianglesIntersect(const geometry::Triangle& first, const geometry::Triangle& second)
+{
+    const geometry::Vec3* a[3] = {&first.vertex1, &first.vertex2, &first.vertex3};
+    const geometry::Vec3* b[3] = {&second.vertex1, &second.vertex2, &second.vertex3};
+
+    // Ortak köşeler (konum eşitliği)
+    int shared = 0;
+    int sharedA = -1;
+    int sharedB = -1;
+    for (int i = 0; i < 3; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            if (samePosition(*a[i], *b[j]))
+            {
+                shared++;
+                sharedA = i;
+                sharedB = j;
+            }
+        }
+    }
+
+    if (shared >= 2)
+    {
+        return false;   // Kenar komşusu (ya da kopya triangle)
+    }
+
+    const Point pa[3] = {toPoint(*a[0]), toPoint(*a[1]), toPoint(*a[2])};
+    const Point pb[3] = {toPoint(*b[0]), toPoint(*b[1]), toPoint(*b[2])};
+
+    if (separatedByPlane(pa, pb) || separatedByPlane(pb, pa))
+    {
+        return false;
+    }
+
+    if (shared == 1)
+    {
+        // Düzlemsel olmayan kesişim ortak köşeden karşı kenarlardan birine uzanır
+        return segmentPierces(pa[(sharedA + 1) % 3], pa[(sharedA + 2) % 3], pb) ||
+               segmentPierces(pb[(sharedB + 1) % 3], pb[(sharedB + 2) % 3], pa);
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        if (segmentPierces(pa[i], pa[(i + 1) % 3], pb) ||
+            segmentPierces(pb[i], pb[(i + 1) % 3], pa))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+geometry::AABB triangleBounds(const geometry::Triangle& tri)
+{
+    geometry::AABB box;
+    box.min.x = std::min({tri.vertex1.x, tri.vertex2.x, tri.vertex3.x});
+    box.min.y = std::min({tri.vertex1.y, tri.vertex2.y, tri.vertex3.y});
+    box.min.z = std::min({tri.vertex1.z, tri.vertex2.z, tri.vertex3.z});
+    box.max.x = std::max({tri.vertex1.x, tri.vertex2.x, tri.vertex3.x});
+    box.max.y = std::max({tri.vertex1.y, tri.vertex2.y, tri.vertex3.y});
+    box.max.z = std::max({tri.vertex1.z, tri.vertex2.z, tri.vertex3.z});
+    return box;
+}
+
+} // namespace
+
+SelfIntersectionDetector::SelfIntersectionDetector(size_t maxPairs, parallel::ThreadPool& pool)
+    : maxPairs_(maxPairs)
+    , pool_(pool)
+{
+}
+
+SelfIntersectionResult SelfIntersectionDetector::detect(const Mesh& mesh) const
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    SelfIntersectionResult result;
+    const std::vector<geometry::Triangle>& triangles = mesh.triangles;
+
+    if (triangles.size() >= 2)
+    {
+        geometry::BVH bvh;
+        bvh.build(triangles.data(), triangles.size(), pool_);
+
+        std::mutex mutex;
+        std::vector<std::pair<uint32_t, uint32_t>> found;
+
+        pool_.parallelFor(0, triangles.size(), TRIANGLE_CHUNK, [&](size_t begin, size_t end) {
+            std::vector<uint32_t> candidates;
+            std::vector<std::pair<uint32_t, uint32_t>> local;
+            size_t tested = 0;
+
+            for (size_t i = begin; i < end; ++i)
+            {
+                candidates.clear();
+                bvh.overlapping(triangleBounds(triangles[i]), candidates);
+
+                for (uint32_t j : candidates)
+                {
+                    // Her çift bir kez, küçük index'ten
+                    if (j <= i)
+                    {
+                        continue;
+                    }
+                    tested++;
+                    if (trianglesIntersect(triangles[i], triangles[j]))
+                    {
+                        local.emplace_back(static_cast<uint32_t>(i), j);
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            result.candidatePairs += tested;
+            found.insert(found.end(), local.begin(), local.end());
+        });
+
+        std::sort(found.begin(), found.end());
+        result.intersectingPairs = found.size();
+        if (found.size() > maxPairs_)
+        {
+            found.resize(maxPairs_);
+        }
+        result.pairs = std::move(found);
+
+        result.triangles.reserve(2 * result.pairs.size());
+        for (const auto& pair : result.pairs)
+        {
+            result.triangles.push_back(pair.first);
+            result.triangles.push_back(pair.second);
+        }
+        std::sort(result.triangles.begin(), result.triangles.end());
+        result.triangles.erase(std::unique(result.triangles.begin(), result.triangles.end()),
+                               result.triangles.end());
+    }
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+} // namespace mesh
+} // namespace core
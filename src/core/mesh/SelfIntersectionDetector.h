@@ -0,0 +1,59 @@
+#pragma once
+
+#include "mesh.h"
+#include "core/parallel/ThreadPool.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace core {
+namespace mesh {
+
+struct SelfIntersectionResult
+{
+    // Kesişen triangle çiftleri (first < second, sıralı); maxPairs ile sınırlı
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+
+    // Çiftlerde geçen triangle'lar (sıralı, tekil) - vurgulama için
+    std::vector<uint32_t> triangles;
+
+    size_t intersectingPairs = 0;       // Toplam (pairs kırpılmış olabilir)
+    size_t candidatePairs = 0;          // Broad-phase'den geçen çiftler
+    double elapsedMs = 0.0;
+
+    bool hasIntersections() const { return intersectingPairs > 0; }
+    bool truncated() const { return intersectingPairs > pairs.size(); }
+};
+
+/**
+ * @brief Kendi kendini kesen yüzey (self-intersection) tespiti
+ *
+ * Broad-phase: triangle'lar üzerinde BVH; her triangle kendi kutusuyla
+ * örtüşen ve daha büyük index'li adaylarla eşlenir. Triangle aralıkları
+ * thread pool'da paralel işlenir.
+ *
+ * Narrow-phase: kesin triangle-triangle testi (double orient3d). Düzlemsel
+ * olmayan iki triangle ancak birinin bir kenarı diğerini deliyorsa kesişir;
+ * altı kenar-triangle testi yeterlidir.
+ *
+ * Komşuluk konum eşitliğiyle belirlenir:
+ *  - Ortak kenarlı (2 ortak köşe) çiftler normal komşudur, atlanır.
+ *  - Tek ortak köşeli çiftlerde sadece karşı kenarlar test edilir.
+ *  - Sadece dokunma (köşe diğer yüzeyin üstünde) ve tam düzlemsel
+ *    örtüşmeler kesişim sayılmaz.
+ */
+class SelfIntersectionDetector
+{
+public:
+    explicit SelfIntersectionDetector(size_t maxPairs = 100000,
+                                      parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    SelfIntersectionResult detect(const Mesh& mesh) const;
+
+private:
+    size_t maxPairs_;
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace mesh
+} // namespace core
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "mesh.h"
+#include <memory>
+
+namespace core {
+namespace mesh {
+
+/**
+ * @brief Paylaşımlı, copy-on-write mesh sahipliği
+ *
+ * Yükleyici, UI, slicing oturumu ve arka plan işleri aynı triangle
+ * verisini tek kopya olarak paylaşır; handle kopyalamak sadece referans
+ * sayacını artırır. Okuma const erişimle yapılır. Değiştiren işlemler
+ * (onarım, normaller, yerleşim) mutate() ile yazılabilir referans alır:
+ * veri başka bir sahiple paylaşılıyorsa önce kopyalanır, o sırada mesh'i
+ * okuyan iş eski haliyle devam eder.
+ *
+ * Handle'ın kendisi thread-safe değildir (tek thread'de tutulur);
+ * share() ile alınan pointer herhangi bir thread'de okunabilir.
+ * mutate() dönüşü bir sonraki kopyalama/share() çağrısına kadar geçerlidir.
+ */
+class SharedMesh
+{
+public:
+    SharedMesh()
+        : data_(std::make_shared<Mesh>())
+    {
+    }
+
+    SharedMesh(Mesh&& mesh)
+        : data_(std::make_shared<Mesh>(std::move(mesh)))
+    {
+    }
+
+    const Mesh& operator*() const noexcept { return *data_; }
+    const Mesh* operator->() const noexcept { return data_.get(); }
+
+    /**
+     * @brief Salt okunur paylaşım (arka plan işleri için)
+     */
+    std::shared_ptr<const Mesh> share() const noexcept { return data_; }
+
+    /**
+     * @brief Yazılabilir erişim; paylaşılıyorsa önce kopyala
+     */
+    Mesh& mutate()
+    {
+        if (data_.use_count() > 1)
+        {
+            data_ = std::make_shared<Mesh>(*data_);
+        }
+        return *data_;
+    }
+
+    /**
+     * @brief Veri başka bir handle/iş tarafından da tutuluyor mu?
+     */
+    bool isShared() const noexcept { return data_.use_count() > 1; }
+
+private:
+    std::shared_ptr<Mesh> data_;
+};
+
+} // namespace mesh
+} // namespace core
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ThreadPool.h"
+#include <cstddef>
+#include <utility>
+
+namespace core {
+namespace parallel {
+
+/**
+ * @brief [begin, end) aralığını parçalara bölüp paralel çalıştır
+ *
+ * fn(chunkBegin, chunkEnd) her parça için bir kez çağrılır; çağıran
+ * thread de parça işler. Paylaşılan ThreadPool kullanılır, her çağrıda
+ * thread açılmaz. Aralık minChunk'tan küçükse doğrudan çağıran thread'de
+ * çalışır. fn exception fırlatmamalıdır.
+ *
+ * @param minChunk Bir parçaya verilecek minimum eleman sayısı
+ */
+template <typename Fn>
+void parallelFor(size_t begin, size_t end, size_t minChunk, Fn&& fn)
+{
+    ThreadPool::shared().parallelFor(begin, end, minChunk, std::forward<Fn>(fn));
+}
+
+} // namespace parallel
+} // namespace core
@@ -0,0 +1,75 @@
+#include "ThreadPool.h"
+
+namespace core {
+namespace parallel {
+
+ThreadPool::ThreadPool(unsigned threadCount)
+{
+    workers_.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i)
+    {
+        workers_.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wakeup_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared()
+{
+    static ThreadPool pool(std::max(1u, workerCount() - 1));
+    return pool;
+}
+
+void ThreadPool::enqueue(std::function<void()> task)
+{
+    if (workers_.empty())
+    {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    wakeup_.notify_one();
+}
+
+void ThreadPool::workerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeup_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+
+            // Kapanışta kuyruktaki görevler yine de bitirilir (future'lar asılı kalmasın)
+            if (tasks_.empty())
+            {
+                return;
+            }
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        task();
+    }
+}
+
+} // namespace parallel
+} // namespace core
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace core {
+namespace parallel {
+
+/**
+ * @brief Kullanılabilir worker sayısı (en az 1)
+ */
+inline unsigned workerCount() noexcept
+{
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 0 ? hw : 1;
+}
+
+/**
+ * @brief Sabit sayıda worker thread'li görev havuzu
+ *
+ * Thread'ler bir kez açılır ve tekrar kullanılır; kısa süren paralel
+ * döngülerde her çağrıda thread açma maliyeti ödenmez.
+ * Thread sayısı 0 ise görevler çağıran thread'de hemen çalışır.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(unsigned threadCount = workerCount());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Worker thread sayısı (çağıran thread hariç)
+     */
+    unsigned size() const { return static_cast<unsigned>(workers_.size()); }
+
+    /**
+     * @brief Uygulama genelinde paylaşılan havuz
+     *
+     * Çağıran thread de parallelFor'da çalıştığı için workerCount() - 1
+     * thread açılır (en az 1).
+     */
+    static ThreadPool& shared();
+
+    /**
+     * @brief Görevi kuyruğa ekle, sonucu future ile al
+     */
+    template <typename Fn>
+    std::future<std::invoke_result_t<Fn>> submit(Fn&& fn)
+    {
+        using Result = std::invoke_result_t<Fn>;
+
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+        std::future<Result> future = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief [begin, end) aralığını parçalara bölüp havuzda çalıştır
+     *
+     * fn(chunkBegin, chunkEnd) her parça için bir kez çağrılır. Parçalar
+     * worker'lar arasında dinamik dağıtılır (iş yükü dengesiz döngüler,
+     * ör. layer başına değişen kontur sayısı, için). Çağıran thread de
+     * çalışır ve tüm parçalar bitince döner; havuz thread'inden iç içe
+     * çağrılabilir. fn exception fırlatmamalıdır.
+     *
+     * @param minChunk Bir parçadaki minimum eleman sayısı
+     */
+    template <typename Fn>
+    void parallelFor(size_t begin, size_t end, size_t minChunk, Fn&& fn);
+
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    bool stop_ = false;
+
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+};
+
+template <typename Fn>
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t minChunk, Fn&& fn)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+
+    // Thread başına ~4 parça: yavaş parçalar diğer worker'ları bekletmez
+    const size_t count = end - begin;
+    const size_t threads = size() + 1;
+    const size_t chunk = std::max<size_t>({1, minChunk, (count + threads * 4 - 1) / (threads * 4)});
+    const size_t chunks = (count + chunk - 1) / chunk;
+
+    if (chunks <= 1 || workers_.empty())
+    {
+        fn(begin, end);
+        return;
+    }
+
+    // Geç başlayan yardımcılar çağrı döndükten sonra da çalışabilir:
+    // paylaşılan durum onlar bitene kadar yaşar, fn'e ise sadece parça
+    // alabilen (yani çağrı henüz dönmemişken çalışan) yardımcı dokunur
+    struct State
+    {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto state = std::make_shared<State>();
+
+    auto run = [state, &fn, begin, end, chunk, chunks]() {
+        for (;;)
+        {
+            const size_t c = state->next.fetch_add(1);
+            if (c >= chunks)
+            {
+                return;
+            }
+
+            const size_t b = begin + c * chunk;
+            fn(b, std::min(end, b + chunk));
+
+            if (state->done.fetch_add(1) + 1 == chunks)
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->finished.notify_all();
+            }
+        }
+    };
+
+    const size_t helpers = std::min<size_t>(size(), chunks - 1);
+    for (size_t h = 0; h < helpers; ++h)
+    {
+        enqueue(run);
+    }
+
+    run();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&]() { return state->done.load() == chunks; });
+}
+
+} // namespace parallel
+} // namespace core
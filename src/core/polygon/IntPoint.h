@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+namespace polygon {
+
+/**
+ * @brief Fixed-point ölçek: 1 birim = 1 mikron
+ *
+ * Float slicing çıktısı bu ölçekte int64'e yuvarlanır; tüm polygon
+ * işlemleri tam sayı ile yapılır, epsilon karşılaştırması gerekmez.
+ */
+constexpr double UNITS_PER_MM = 1000.0;
+
+/**
+ * @brief Güvenli koordinat aralığı (|x|, |y| < 2^28 µm ≈ 268 m)
+ *
+ * Kesişim ve winding testleri koordinatları iki katına çıkarıp çarpar;
+ * bu sınırın altında hiçbir int64 ara sonucu taşmaz.
+ */
+constexpr int64_t MAX_COORD = int64_t(1) << 28;
+
+/**
+ * @brief Mikron ölçekli 2D tam sayı nokta
+ */
+struct IntPoint
+{
+    int64_t x = 0;
+    int64_t y = 0;
+
+    IntPoint() = default;
+    IntPoint(int64_t x_, int64_t y_) : x(x_), y(y_) {}
+
+    bool operator==(const IntPoint& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const IntPoint& other) const { return !(*this == other); }
+    bool operator<(const IntPoint& other) const { return x < other.x || (x == other.x && y < other.y); }
+};
+
+/**
+ * @brief Kapalı polygon (son nokta ilk noktaya bağlanır, tekrar edilmez)
+ *
+ * Yön kuralı: dış kontur CCW (pozitif alan), delik CW.
+ */
+using Polygon = std::vector<IntPoint>;
+using Polygons = std::vector<Polygon>;
+
+inline int64_t toFixed(float mm)
+{
+    return static_cast<int64_t>(std::llround(static_cast<double>(mm) * UNITS_PER_MM));
+}
+
+inline float toMillimeters(int64_t units)
+{
+    return static_cast<float>(static_cast<double>(units) / UNITS_PER_MM);
+}
+
+/**
+ * @brief (b - a) × (c - a): >0 sola dönüş, <0 sağa, 0 doğrusal
+ */
+inline int64_t cross(const IntPoint& a, const IntPoint& b, const IntPoint& c)
+{
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+/**
+ * @brief İki katı işaretli alan (µm², CCW pozitif)
+ */
+inline int64_t signedArea2(const Polygon& poly)
+{
+    int64_t area = 0;
+    const size_t n = poly.size();
+    for (size_t i = 0, j = n - 1; i < n; j = i++)
+    {
+        area += poly[j].x * poly[i].y - poly[i].x * poly[j].y;
+    }
+    return area;
+}
+
+/**
+ * @brief Toplam nokta sayısı
+ */
+inline size_t pointCount(const Polygons& polys)
+{
+    size_t count = 0;
+    for (const auto& poly : polys)
+    {
+        count += poly.size();
+    }
+    return count;
+}
+
+} // namespace polygon
+} // namespace core
@@ -0,0 +1,132 @@
+#include "PolygonOffset.h"
+#include <cmath>
+
+namespace core {
+namespace polygon {
+
+namespace {
+
+// Bu açıdan (~8°) küçük içe dönüşlerde orijinal nokta eklenmez
+constexpr double GENTLE_COS = 0.99;
+
+struct Normal
+{
+    double x = 0.0;
+    double y = 0.0;
+};
+
+/**
+ * @brief a → b kenarının sağ (dış) birim normali
+ */
+Normal rightNormal(const IntPoint& a, const IntPoint& b)
+{
+    const double dx = static_cast<double>(b.x - a.x);
+    const double dy = static_cast<double>(b.y - a.y);
+    const double length = std::sqrt(dx * dx + dy * dy);
+    return {dy / length, -dx / length};
+}
+
+IntPoint shifted(const IntPoint& p, double dx, double dy)
+{
+    return {p.x + std::llround(dx), p.y + std::llround(dy)};
+}
+
+} // namespace
+
+PolygonOffset::PolygonOffset(double miterLimit)
+    : miterLimit_(std::max(1.0, miterLimit))
+{
+}
+
+Polygons PolygonOffset::offset(const Polygons& input, int64_t delta)
+{
+    if (delta == 0)
+    {
+        return union_.unite(input, FillRule::Positive);
+    }
+
+    const double d = static_cast<double>(delta);
+
+    // 1 + cos(θ) bu değerin altındaysa miter limiti aşılır
+    const double miterThreshold = 2.0 / (miterLimit_ * miterLimit_);
+
+    Polygons raw;
+    raw.reserve(input.size());
+
+    std::vector<IntPoint> points;
+    std::vector<Normal> normals;
+
+    for (const auto& poly : input)
+    {
+        // Ardışık tekrar eden noktaları at
+        points.clear();
+        for (const auto& p : poly)
+        {
+            if (points.empty() || points.back() != p)
+            {
+                points.push_back(p);
+            }
+        }
+        while (points.size() > 1 && points.back() == points.front())
+        {
+            points.pop_back();
+        }
+
+        const size_t n = points.size();
+        if (n < 3)
+        {
+            continue;
+        }
+
+        // normals[i]: points[i] → points[i + 1] kenarı
+        normals.resize(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            normals[i] = rightNormal(points[i], points[(i + 1) % n]);
+        }
+
+        Polygon out;
+        out.reserve(n * 2);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const IntPoint& p = points[i];
+            const Normal& n1 = normals[(i + n - 1) % n];   // Gelen kenar
+            const Normal& n2 = normals[i];                 // Giden kenar
+
+            const double sinA = n1.x * n2.y - n1.y * n2.x;
+            const double cosA = n1.x * n2.x + n1.y * n2.y;
+
+            // Eğri yüzeylerde olduğu gibi hafif açılı köşelerde kaydırılmış
+            // kenarlar köşeye çok yakın kesişir: tek miter noktası yeterli
+            const bool concave = sinA * d < 0.0 || (std::abs(sinA) < 1e-9 && cosA < 0.0);
+
+            if (concave && cosA < GENTLE_COS)
+            {
+                // İçe kapanan köşe: ters döngü union'da düşer
+                out.push_back(shifted(p, n1.x * d, n1.y * d));
+                out.push_back(p);
+                out.push_back(shifted(p, n2.x * d, n2.y * d));
+            }
+            else if (1.0 + cosA >= miterThreshold)
+            {
+                // Miter: iki kaydırılmış kenarın kesişimi
+                const double scale = d / (1.0 + cosA);
+                out.push_back(shifted(p, (n1.x + n2.x) * scale, (n1.y + n2.y) * scale));
+            }
+            else
+            {
+                // Miter çok uzun: bevel
+                out.push_back(shifted(p, n1.x * d, n1.y * d));
+                out.push_back(shifted(p, n2.x * d, n2.y * d));
+            }
+        }
+
+        raw.push_back(std::move(out));
+    }
+
+    return union_.unite(raw, FillRule::Positive);
+}
+
+} // namespace polygon
+} // namespace core
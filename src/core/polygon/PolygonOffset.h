@@ -0,0 +1,42 @@
+#pragma once
+
+#include "IntPoint.h"
+#include "PolygonUnion.h"
+
+namespace core {
+namespace polygon {
+
+/**
+ * @brief Tam sayı polygon offset (Minkowski tarzı, miter köşeli)
+ *
+ * Her kenar normali yönünde delta kadar kaydırılır:
+ *  - delta > 0 dışa büyütür, delta < 0 içe daraltır (inset).
+ *  - Dışa açılan köşeler miter ile birleştirilir; miter limiti aşılınca
+ *    köşe düz kesilir (bevel).
+ *  - İçe kapanan keskin köşelere orijinal nokta eklenir; oluşan ters
+ *    döngüler PolygonUnion (FillRule::Positive) ile temizlenir.
+ *
+ * Girdi yönü Slicer ile aynıdır: dış kontur CCW, delik CW. Çıktı da
+ * aynı kurala uyar; çok ince bölgeler inset'te kaybolur. Girdi halkaları
+ * birbiriyle çakışmamalıdır (gerekirse önce PolygonUnion), yoksa bir
+ * halkanın köşe döngüleri diğerinin içinde delik bırakır.
+ */
+class PolygonOffset
+{
+public:
+    /**
+     * @param miterLimit Miter uzunluğu / |delta| üst sınırı
+     */
+    explicit PolygonOffset(double miterLimit = 2.0);
+
+    Polygons offset(const Polygons& input, int64_t delta);
+
+    const PolygonUnion::Stats& unionStats() const { return union_.stats(); }
+
+private:
+    double miterLimit_;
+    PolygonUnion union_;
+};
+
+} // namespace polygon
+} // namespace core
@@ -0,0 +1,145 @@
+#include "PolygonSimplifier.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace core {
+namespace polygon {
+
+namespace {
+
+/**
+ * @brief p'nin [a, b] doğru parçasına uzaklığının karesi
+ */
+double distanceToSegment2(const IntPoint& p, const IntPoint& a, const IntPoint& b)
+{
+    const double abx = static_cast<double>(b.x - a.x);
+    const double aby = static_cast<double>(b.y - a.y);
+    const double apx = static_cast<double>(p.x - a.x);
+    const double apy = static_cast<double>(p.y - a.y);
+
+    const double length2 = abx * abx + aby * aby;
+    double t = length2 > 0.0 ? (apx * abx + apy * aby) / length2 : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+
+    const double dx = apx - t * abx;
+    const double dy = apy - t * aby;
+    return dx * dx + dy * dy;
+}
+
+} // namespace
+
+PolygonSimplifier::PolygonSimplifier(int64_t tolerance)
+    : tolerance2_(static_cast<double>(tolerance) * static_cast<double>(tolerance))
+{
+}
+
+Polygons PolygonSimplifier::simplify(const Polygons& input)
+{
+    stats_ = Stats{};
+
+    Polygons result;
+    result.reserve(input.size());
+
+    for (const Polygon& ring : input)
+    {
+        stats_.inputPoints += ring.size();
+
+        Polygon simplified = simplifyRing(ring);
+        if (simplified.empty())
+        {
+            stats_.droppedRings++;
+            continue;
+        }
+
+        stats_.outputPoints += simplified.size();
+        result.push_back(std::move(simplified));
+    }
+
+    return result;
+}
+
+Polygon PolygonSimplifier::simplifyRing(const Polygon& ring) const
+{
+    const size_t n = ring.size();
+    if (n < 3)
+    {
+        return {};
+    }
+    if (n == 3 || tolerance2_ <= 0.0)
+    {
+        return ring;
+    }
+
+    // Halkayı başlangıca en uzak noktadan ikiye böl
+    size_t far = 0;
+    int64_t farDistance2 = -1;
+    for (size_t i = 1; i < n; ++i)
+    {
+        const int64_t dx = ring[i].x - ring[0].x;
+        const int64_t dy = ring[i].y - ring[0].y;
+        const int64_t d2 = dx * dx + dy * dy;
+        if (d2 > farDistance2)
+        {
+            farDistance2 = d2;
+            far = i;
+        }
+    }
+
+    std::vector<char> keep(n, 0);
+    keep[0] = 1;
+    keep[far] = 1;
+
+    // Aralık (a, b): b == n halkanın başlangıcına döner
+    std::vector<std::pair<size_t, size_t>> stack;
+    stack.push_back({0, far});
+    stack.push_back({far, n});
+
+    while (!stack.empty())
+    {
+        const auto [a, b] = stack.back();
+        stack.pop_back();
+
+        const IntPoint& pa = ring[a];
+        const IntPoint& pb = ring[b % n];
+
+        double maxDistance2 = 0.0;
+        size_t index = a;
+        for (size_t i = a + 1; i < b; ++i)
+        {
+            const double d2 = distanceToSegment2(ring[i], pa, pb);
+            if (d2 > maxDistance2)
+            {
+                maxDistance2 = d2;
+                index = i;
+            }
+        }
+
+        if (maxDistance2 > tolerance2_)
+        {
+            keep[index] = 1;
+            stack.push_back({a, index});
+            stack.push_back({index, b});
+        }
+    }
+
+    Polygon result;
+    result.reserve(static_cast<size_t>(std::count(keep.begin(), keep.end(), 1)));
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (keep[i])
+        {
+            result.push_back(ring[i]);
+        }
+    }
+
+    // İki noktaya inen halka tolerance'tan ince: alanı yok sayılır
+    if (result.size() < 3)
+    {
+        return {};
+    }
+    return result;
+}
+
+} // namespace polygon
+} // namespace core
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "IntPoint.h"
+
+namespace core {
+namespace polygon {
+
+/**
+ * @brief Sapma sınırlı kapalı kontur sadeleştirme (Douglas-Peucker)
+ *
+ * Yüksek çözünürlüklü taramalar layer başına yüz binlerce mikro segment
+ * üretir. Her halka, kalan kenarlardan hiçbir orijinal noktanın
+ * tolerance'tan fazla uzaklaşmayacağı şekilde inceltilir:
+ *
+ *  1. Başlangıç noktası ve ona en uzak nokta sabitlenir (halka ikiye bölünür).
+ *  2. Her yarıda kirişe en uzak nokta tolerance'ı aşıyorsa tutulur ve
+ *     iki alt aralık işlenir (özyinelemesiz, yığınla).
+ *
+ * Yön korunur (CCW dış, CW delik). 3 noktadan aza inen halkalar
+ * (tolerance'tan küçük detaylar) atılır. Tolerance çizgi genişliğinin
+ * çok altında tutulmalıdır; büyük değerlerde komşu halkalar kesişebilir.
+ */
+class PolygonSimplifier
+{
+public:
+    struct Stats
+    {
+        size_t inputPoints = 0;
+        size_t outputPoints = 0;
+        size_t droppedRings = 0;
+    };
+
+    /**
+     * @param tolerance Max sapma (µm)
+     */
+    explicit PolygonSimplifier(int64_t tolerance);
+
+    Polygons simplify(const Polygons& input);
+
+    /**
+     * @brief Tek halka (boş dönerse halka atılmalı)
+     */
+    Polygon simplifyRing(const Polygon& ring) const;
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    double tolerance2_;
+    Stats stats_;
+};
+
+} // namespace polygon
+} // namespace core
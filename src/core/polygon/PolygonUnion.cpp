@@ -0,0 +1,656 @@
+#include "PolygonUnion.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace core {
+namespace polygon {
+
+namespace {
+
+struct Edge
+{
+    IntPoint a;
+    IntPoint b;
+    int winding;            // a → b yönündeki akış (+1 / -1 / toplam)
+};
+
+// Parça: lo < hi, akış lo → hi yönünde
+struct Piece
+{
+    IntPoint lo;
+    IntPoint hi;
+    int winding;
+};
+
+int sign(int64_t v)
+{
+    return (v > 0) - (v < 0);
+}
+
+/**
+ * @brief Doğrusal p, [a, b] kenarının iç noktası mı (uçlar hariç)
+ */
+bool touches(const IntPoint& p, const IntPoint& a, const IntPoint& b)
+{
+    return p != a && p != b &&
+           p.x >= std::min(a.x, b.x) && p.x <= std::max(a.x, b.x) &&
+           p.y >= std::min(a.y, b.y) && p.y <= std::max(a.y, b.y);
+}
+
+/**
+ * @brief Düzgün grid: her kenar bbox'ının kapsadığı hücrelere girer
+ *
+ * Hücreler CSR düzeninde tek dizide tutulur (say → prefix sum → doldur).
+ */
+class EdgeGrid
+{
+public:
+    explicit EdgeGrid(const std::vector<Edge>& edges)
+    {
+        IntPoint lo(MAX_COORD, MAX_COORD), hi(-MAX_COORD, -MAX_COORD);
+        for (const auto& e : edges)
+        {
+            lo.x = std::min({lo.x, e.a.x, e.b.x});
+            lo.y = std::min({lo.y, e.a.y, e.b.y});
+            hi.x = std::max({hi.x, e.a.x, e.b.x});
+            hi.y = std::max({hi.y, e.a.y, e.b.y});
+        }
+
+        origin_ = lo;
+        const int64_t extent = std::max<int64_t>({hi.x - lo.x, hi.y - lo.y, 1});
+        const int64_t cellsPerSide = std::clamp<int64_t>(
+            static_cast<int64_t>(std::sqrt(static_cast<double>(edges.size()))), 1, 1024);
+
+        cellSize_ = std::max<int64_t>(1, extent / cellsPerSide + 1);
+        nx_ = static_cast<int>((hi.x - lo.x) / cellSize_ + 1);
+        ny_ = static_cast<int>((hi.y - lo.y) / cellSize_ + 1);
+        cellStart_.assign(static_cast<size_t>(nx_) * ny_ + 1, 0);
+
+        forEachCell(edges, [&](size_t cell, uint32_t) { cellStart_[cell + 1]++; });
+        for (size_t c = 1; c < cellStart_.size(); ++c)
+        {
+            cellStart_[c] += cellStart_[c - 1];
+        }
+
+        items_.resize(cellStart_.back());
+        std::vector<uint32_t> fill(cellStart_.begin(), cellStart_.end() - 1);
+        forEachCell(edges, [&](size_t cell, uint32_t edge) { items_[fill[cell]++] = edge; });
+    }
+
+    int cellX(int64_t x) const { return static_cast<int>((x - origin_.x) / cellSize_); }
+    int cellY(int64_t y) const { return static_cast<int>((y - origin_.y) / cellSize_); }
+    int width() const { return nx_; }
+
+    size_t cellCount() const { return cellStart_.size() - 1; }
+    const uint32_t* cellBegin(size_t cell) const { return items_.data() + cellStart_[cell]; }
+    size_t cellSize(size_t cell) const { return cellStart_[cell + 1] - cellStart_[cell]; }
+
+private:
+    IntPoint origin_;
+    int64_t cellSize_ = 1;
+    int nx_ = 1;
+    int ny_ = 1;
+    std::vector<uint32_t> cellStart_;
+    std::vector<uint32_t> items_;
+
+    template <typename Fn>
+    void forEachCell(const std::vector<Edge>& edges, Fn&& fn) const
+    {
+        for (size_t i = 0; i < edges.size(); ++i)
+        {
+            const auto& e = edges[i];
+            const int x0 = cellX(std::min(e.a.x, e.b.x)), x1 = cellX(std::max(e.a.x, e.b.x));
+            const int y0 = cellY(std::min(e.a.y, e.b.y)), y1 = cellY(std::max(e.a.y, e.b.y));
+            for (int cy = y0; cy <= y1; ++cy)
+            {
+                for (int cx = x0; cx <= x1; ++cx)
+                {
+                    fn(static_cast<size_t>(cy) * nx_ + cx, static_cast<uint32_t>(i));
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief Tüm kesişim/temas noktalarını kenar başına topla
+ */
+size_t findSplitPoints(const std::vector<Edge>& edges, std::vector<std::vector<IntPoint>>& splits)
+{
+    EdgeGrid grid(edges);
+    size_t found = 0;
+
+    for (size_t c = 0; c < grid.cellCount(); ++c)
+    {
+        const uint32_t* bucket = grid.cellBegin(c);
+        const size_t bucketSize = grid.cellSize(c);
+        const int cx = static_cast<int>(c % grid.width());
+        const int cy = static_cast<int>(c / grid.width());
+
+        for (size_t i = 0; i < bucketSize; ++i)
+        {
+            const Edge& e1 = edges[bucket[i]];
+
+            for (size_t j = i + 1; j < bucketSize; ++j)
+            {
+                const Edge& e2 = edges[bucket[j]];
+
+                // Aynı çift birden fazla hücrede olabilir: sadece bbox
+                // kesişiminin ilk hücresinde test et
+                const int64_t ox = std::max(std::min(e1.a.x, e1.b.x), std::min(e2.a.x, e2.b.x));
+                const int64_t oy = std::max(std::min(e1.a.y, e1.b.y), std::min(e2.a.y, e2.b.y));
+                if (grid.cellX(ox) != cx || grid.cellY(oy) != cy)
+                {
+                    continue;
+                }
+
+                const IntPoint& a = e1.a;
+                const IntPoint& b = e1.b;
+                const IntPoint& p = e2.a;
+                const IntPoint& q = e2.b;
+
+                const int64_t d1 = cross(p, q, a);
+                const int64_t d2 = cross(p, q, b);
+                const int64_t d3 = cross(a, b, p);
+                const int64_t d4 = cross(a, b, q);
+
+                if (sign(d1) * sign(d2) < 0 && sign(d3) * sign(d4) < 0)
+                {
+                    // Gerçek kesişim: nokta mikrona yuvarlanır
+                    const double t = static_cast<double>(d1) / static_cast<double>(d1 - d2);
+                    const IntPoint hit(a.x + static_cast<int64_t>(std::llround((b.x - a.x) * t)),
+                                       a.y + static_cast<int64_t>(std::llround((b.y - a.y) * t)));
+                    splits[bucket[i]].push_back(hit);
+                    splits[bucket[j]].push_back(hit);
+                    ++found;
+                    continue;
+                }
+
+                // Temas (T-bağlantı) ve doğrusal çakışma: uç noktalar diğer kenarı böler
+                // (ortak uç noktası olan komşu kenarlar bölme üretmez)
+                if (d1 == 0 && touches(a, p, q)) { splits[bucket[j]].push_back(a); ++found; }
+                if (d2 == 0 && touches(b, p, q)) { splits[bucket[j]].push_back(b); ++found; }
+                if (d3 == 0 && touches(p, a, b)) { splits[bucket[i]].push_back(p); ++found; }
+                if (d4 == 0 && touches(q, a, b)) { splits[bucket[i]].push_back(q); ++found; }
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief Kenarları bölme noktalarından parçala, çakışan parçaları birleştir
+ */
+std::vector<Piece> splitAndMerge(const std::vector<Edge>& edges,
+                                 std::vector<std::vector<IntPoint>>& splits)
+{
+    std::vector<Piece> pieces;
+    pieces.reserve(edges.size() * 2);
+
+    auto addPiece = [&](const IntPoint& from, const IntPoint& to, int winding) {
+        if (from == to)
+        {
+            return;
+        }
+        if (from < to)
+        {
+            pieces.push_back({from, to, winding});
+        }
+        else
+        {
+            pieces.push_back({to, from, -winding});
+        }
+    };
+
+    for (size_t i = 0; i < edges.size(); ++i)
+    {
+        const Edge& e = edges[i];
+        auto& points = splits[i];
+
+        if (points.empty())
+        {
+            addPiece(e.a, e.b, e.winding);
+            continue;
+        }
+
+        // Kenar boyunca sırala
+        const int64_t dx = e.b.x - e.a.x;
+        const int64_t dy = e.b.y - e.a.y;
+        std::sort(points.begin(), points.end(), [&](const IntPoint& p1, const IntPoint& p2) {
+            return (p1.x - e.a.x) * dx + (p1.y - e.a.y) * dy <
+                   (p2.x - e.a.x) * dx + (p2.y - e.a.y) * dy;
+        });
+        points.erase(std::unique(points.begin(), points.end()), points.end());
+
+        IntPoint prev = e.a;
+        for (const auto& p : points)
+        {
+            addPiece(prev, p, e.winding);
+            prev = p;
+        }
+        addPiece(prev, e.b, e.winding);
+    }
+
+    // Aynı uçlara sahip parçaların akışını topla
+    std::sort(pieces.begin(), pieces.end(), [](const Piece& p1, const Piece& p2) {
+        return p1.lo < p2.lo || (p1.lo == p2.lo && p1.hi < p2.hi);
+    });
+
+    std::vector<Piece> merged;
+    merged.reserve(pieces.size());
+    for (const auto& piece : pieces)
+    {
+        if (!merged.empty() && merged.back().lo == piece.lo && merged.back().hi == piece.hi)
+        {
+            merged.back().winding += piece.winding;
+        }
+        else
+        {
+            merged.push_back(piece);
+        }
+    }
+
+    merged.erase(std::remove_if(merged.begin(), merged.end(),
+                                [](const Piece& p) { return p.winding == 0; }),
+                 merged.end());
+    return merged;
+}
+
+/**
+ * @brief Yatay bantlar: y'de kesişen parçaların listesi (CSR)
+ */
+class BandIndex
+{
+public:
+    explicit BandIndex(const std::vector<Piece>& pieces)
+    {
+        minY_ = MAX_COORD;
+        int64_t maxY = -MAX_COORD;
+        for (const auto& p : pieces)
+        {
+            minY_ = std::min({minY_, p.lo.y, p.hi.y});
+            maxY = std::max({maxY, p.lo.y, p.hi.y});
+        }
+
+        const int64_t bandCount = std::clamp<int64_t>(static_cast<int64_t>(pieces.size() / 8), 1, 4096);
+        bandHeight_ = std::max<int64_t>(1, (maxY - minY_) / bandCount + 1);
+        bandStart_.assign(static_cast<size_t>((maxY - minY_) / bandHeight_ + 2), 0);
+
+        forEachBand(pieces, [&](size_t band, uint32_t) { bandStart_[band + 1]++; });
+        for (size_t b = 1; b < bandStart_.size(); ++b)
+        {
+            bandStart_[b] += bandStart_[b - 1];
+        }
+
+        items_.resize(bandStart_.back());
+        std::vector<uint32_t> fill(bandStart_.begin(), bandStart_.end() - 1);
+        forEachBand(pieces, [&](size_t band, uint32_t piece) { items_[fill[band]++] = piece; });
+    }
+
+    /**
+     * @brief y'yi içeren bandın parçaları [begin, end)
+     */
+    std::pair<const uint32_t*, const uint32_t*> at(int64_t y) const
+    {
+        if (y < minY_ || band(y) + 1 >= bandStart_.size())
+        {
+            return {nullptr, nullptr};
+        }
+        const size_t b = band(y);
+        return {items_.data() + bandStart_[b], items_.data() + bandStart_[b + 1]};
+    }
+
+private:
+    int64_t minY_ = 0;
+    int64_t bandHeight_ = 1;
+    std::vector<uint32_t> bandStart_;
+    std::vector<uint32_t> items_;
+
+    size_t band(int64_t y) const { return static_cast<size_t>((y - minY_) / bandHeight_); }
+
+    template <typename Fn>
+    void forEachBand(const std::vector<Piece>& pieces, Fn&& fn) const
+    {
+        for (size_t i = 0; i < pieces.size(); ++i)
+        {
+            const auto& p = pieces[i];
+            if (p.lo.y == p.hi.y)
+            {
+                continue;   // Yatay parçalar ışını kesmez
+            }
+            const size_t b0 = band(std::min(p.lo.y, p.hi.y));
+            const size_t b1 = band(std::max(p.lo.y, p.hi.y));
+            for (size_t b = b0; b <= b1; ++b)
+            {
+                fn(b, static_cast<uint32_t>(i));
+            }
+        }
+    }
+};
+
+/**
+ * @brief Parçanın orta noktasından +x yönüne ışın: winding sayısı
+ *
+ * Koordinatlar iki katına çıkarılır, orta nokta tam sayı kalır.
+ * Yarı açık kural ışını y + ε'ye koyar.
+ */
+int windingRightOf(const std::vector<Piece>& pieces, const BandIndex& bands, size_t self)
+{
+    const Piece& e = pieces[self];
+    const IntPoint m2(e.lo.x + e.hi.x, e.lo.y + e.hi.y);
+
+    int winding = 0;
+
+    // Orta nokta y'si bant seçimi için aşağı yuvarlanır; kenar her iki bantta da var
+    const auto range = bands.at(m2.y / 2);
+    for (const uint32_t* it = range.first; it != range.second; ++it)
+    {
+        const uint32_t idx = *it;
+        if (idx == self)
+        {
+            continue;
+        }
+
+        const Piece& f = pieces[idx];
+        const IntPoint p2(f.lo.x * 2, f.lo.y * 2);
+        const IntPoint q2(f.hi.x * 2, f.hi.y * 2);
+
+        if ((p2.y <= m2.y) == (q2.y <= m2.y))
+        {
+            continue;
+        }
+
+        const int64_t side = cross(p2, q2, m2);
+        const bool upward = p2.y < q2.y;
+
+        if ((upward && side > 0) || (!upward && side < 0))
+        {
+            winding += upward ? f.winding : -f.winding;
+        }
+    }
+
+    return winding;
+}
+
+double turnAngle(const IntPoint& u, const IntPoint& v, const IntPoint& w)
+{
+    const double ix = static_cast<double>(v.x - u.x), iy = static_cast<double>(v.y - u.y);
+    const double ox = static_cast<double>(w.x - v.x), oy = static_cast<double>(w.y - v.y);
+    return std::atan2(ix * oy - iy * ox, ix * ox + iy * oy);
+}
+
+void removeCollinear(Polygon& poly)
+{
+    bool changed = true;
+    while (changed && poly.size() >= 3)
+    {
+        changed = false;
+        Polygon cleaned;
+        cleaned.reserve(poly.size());
+
+        const size_t n = poly.size();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const IntPoint& prev = cleaned.empty() ? poly[(i + n - 1) % n] : cleaned.back();
+            const IntPoint& next = poly[(i + 1) % n];
+            if (cross(prev, poly[i], next) == 0)
+            {
+                changed = true;
+                continue;
+            }
+            cleaned.push_back(poly[i]);
+        }
+        poly.swap(cleaned);
+    }
+}
+
+/**
+ * @brief Parça uçlarından köşe grafiği (CSR): köşe → bağlı parçalar
+ */
+struct VertexGraph
+{
+    std::vector<uint32_t> loVertex;     // Parça → lo köşesi
+    std::vector<uint32_t> hiVertex;     // Parça → hi köşesi
+    std::vector<uint32_t> start;        // Köşe → incident dizisindeki ilk kayıt
+    std::vector<uint32_t> incident;     // Parça indeksleri
+
+    explicit VertexGraph(const std::vector<Piece>& pieces)
+    {
+        std::vector<std::pair<IntPoint, uint32_t>> ends;
+        ends.reserve(pieces.size() * 2);
+        for (size_t i = 0; i < pieces.size(); ++i)
+        {
+            ends.emplace_back(pieces[i].lo, static_cast<uint32_t>(2 * i));
+            ends.emplace_back(pieces[i].hi, static_cast<uint32_t>(2 * i + 1));
+        }
+        std::sort(ends.begin(), ends.end(), [](const auto& e1, const auto& e2) {
+            return e1.first < e2.first;
+        });
+
+        loVertex.resize(pieces.size());
+        hiVertex.resize(pieces.size());
+        incident.reserve(ends.size());
+
+        for (size_t i = 0; i < ends.size(); ++i)
+        {
+            if (i == 0 || ends[i].first != ends[i - 1].first)
+            {
+                start.push_back(static_cast<uint32_t>(incident.size()));
+            }
+            const uint32_t vertex = static_cast<uint32_t>(start.size() - 1);
+            const uint32_t piece = ends[i].second / 2;
+            (ends[i].second % 2 ? hiVertex : loVertex)[piece] = vertex;
+            incident.push_back(piece);
+        }
+        start.push_back(static_cast<uint32_t>(incident.size()));
+    }
+
+    size_t degree(uint32_t vertex) const { return start[vertex + 1] - start[vertex]; }
+
+    uint32_t otherPiece(uint32_t vertex, uint32_t piece) const
+    {
+        return incident[start[vertex]] == piece ? incident[start[vertex] + 1] : incident[start[vertex]];
+    }
+};
+
+} // namespace
+
+Polygons PolygonUnion::unite(const Polygons& input, FillRule fillRule)
+{
+    stats_ = Stats{};
+
+    // 1. Kenarlar
+    std::vector<Edge> edges;
+    edges.reserve(pointCount(input));
+    for (const auto& poly : input)
+    {
+        const size_t n = poly.size();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const IntPoint& a = poly[i];
+            const IntPoint& b = poly[(i + 1) % n];
+            if (a != b)
+            {
+                edges.push_back({a, b, 1});
+            }
+        }
+    }
+    stats_.inputEdges = edges.size();
+
+    if (edges.empty())
+    {
+        return {};
+    }
+
+    // 2-3. Kesişimler, bölme ve çakışan parçaların birleştirilmesi
+    std::vector<std::vector<IntPoint>> splits(edges.size());
+    stats_.intersections = findSplitPoints(edges, splits);
+
+    const std::vector<Piece> pieces = splitAndMerge(edges, splits);
+    stats_.splitEdges = pieces.size();
+
+    // 4. Winding: derecesi 2 olan köşelerde iki yandaki bölge değişmez, bu
+    // yüzden ışın testi zincir başına bir kez yapılır, sonuç zincir boyunca taşınır
+    const BandIndex bands(pieces);
+    const VertexGraph graph(pieces);
+
+    std::vector<int> leftWinding(pieces.size(), 0);     // lo → hi yönüne göre
+    std::vector<int> rightWinding(pieces.size(), 0);
+    std::vector<bool> visited(pieces.size(), false);
+
+    for (size_t i = 0; i < pieces.size(); ++i)
+    {
+        if (visited[i])
+        {
+            continue;
+        }
+
+        const Piece& e = pieces[i];
+        const int ray = windingRightOf(pieces, bands, i);
+
+        // Işın noktası yatay parçada üstte, yukarı giden parçada sağda,
+        // aşağı giden parçada solda kalır (lo → hi yönüne göre)
+        const bool rayOnLeft = (e.lo.y == e.hi.y) || (e.lo.y > e.hi.y);
+        leftWinding[i] = rayOnLeft ? ray : ray + e.winding;
+        rightWinding[i] = rayOnLeft ? ray - e.winding : ray;
+        visited[i] = true;
+
+        // İleri (hi ucundan) ve geri (lo ucundan) yürü
+        for (int forward = 0; forward < 2; ++forward)
+        {
+            uint32_t piece = static_cast<uint32_t>(i);
+            uint32_t vertex = forward ? graph.hiVertex[i] : graph.loVertex[i];
+            const int pathLeft = forward ? leftWinding[i] : rightWinding[i];
+            const int pathRight = forward ? rightWinding[i] : leftWinding[i];
+
+            while (graph.degree(vertex) == 2)
+            {
+                piece = graph.otherPiece(vertex, piece);
+                if (visited[piece])
+                {
+                    break;
+                }
+                visited[piece] = true;
+
+                const bool aligned = graph.loVertex[piece] == vertex;
+                leftWinding[piece] = aligned ? pathLeft : pathRight;
+                rightWinding[piece] = aligned ? pathRight : pathLeft;
+                vertex = aligned ? graph.hiVertex[piece] : graph.loVertex[piece];
+            }
+        }
+    }
+
+    // 5. Sınır parçalarını seç, dolu taraf solda kalacak şekilde yönlendir
+    std::vector<Edge> boundary;
+    boundary.reserve(pieces.size());
+
+    auto filled = [fillRule](int winding) {
+        return fillRule == FillRule::Positive ? winding > 0 : winding != 0;
+    };
+
+    for (size_t i = 0; i < pieces.size(); ++i)
+    {
+        const bool leftFilled = filled(leftWinding[i]);
+        const bool rightFilled = filled(rightWinding[i]);
+        if (leftFilled == rightFilled)
+        {
+            continue;
+        }
+
+        const Piece& e = pieces[i];
+        boundary.push_back(leftFilled ? Edge{e.lo, e.hi, 1} : Edge{e.hi, e.lo, 1});
+    }
+    stats_.outputEdges = boundary.size();
+
+    // 6. Halkalara bağla (başlangıç noktasına göre sıralı çıkış listesi)
+    std::vector<std::pair<IntPoint, size_t>> outgoing;
+    outgoing.reserve(boundary.size());
+    for (size_t i = 0; i < boundary.size(); ++i)
+    {
+        outgoing.emplace_back(boundary[i].a, i);
+    }
+    std::sort(outgoing.begin(), outgoing.end());
+
+    std::vector<bool> used(boundary.size(), false);
+    Polygons result;
+
+    for (size_t start = 0; start < boundary.size(); ++start)
+    {
+        if (used[start])
+        {
+            continue;
+        }
+
+        Polygon ring;
+        size_t current = start;
+        used[current] = true;
+        ring.push_back(boundary[current].a);
+
+        while (boundary[current].b != boundary[start].a)
+        {
+            const IntPoint& u = boundary[current].a;
+            const IntPoint& v = boundary[current].b;
+
+            // Birden fazla çıkış varsa en sağa dönüşü seç: değen halkalar ayrı kalır
+            size_t next = boundary.size();
+            double bestTurn = 0.0;
+            auto it = std::lower_bound(outgoing.begin(), outgoing.end(),
+                                       std::make_pair(v, size_t(0)));
+            for (; it != outgoing.end() && it->first == v; ++it)
+            {
+                if (used[it->second])
+                {
+                    continue;
+                }
+                const double turn = turnAngle(u, v, boundary[it->second].b);
+                if (next == boundary.size() || turn < bestTurn)
+                {
+                    next = it->second;
+                    bestTurn = turn;
+                }
+            }
+
+            if (next == boundary.size())
+            {
+                ring.clear();   // Kapanmayan zincir (yuvarlama artığı), at
+                break;
+            }
+
+            used[next] = true;
+            ring.push_back(boundary[next].a);
+            current = next;
+        }
+
+        removeCollinear(ring);
+        if (ring.size() >= 3 && signedArea2(ring) != 0)
+        {
+            result.push_back(std::move(ring));
+        }
+    }
+
+    stats_.outputPolygons = result.size();
+    return result;
+}
+
+Polygons PolygonUnion::difference(const Polygons& subject, const Polygons& clip)
+{
+    if (subject.empty() || clip.empty())
+    {
+        return clip.empty() ? unite(subject, FillRule::Positive) : Polygons{};
+    }
+
+    Polygons input;
+    input.reserve(subject.size() + clip.size());
+    input.insert(input.end(), subject.begin(), subject.end());
+    for (const Polygon& ring : clip)
+    {
+        input.emplace_back(ring.rbegin(), ring.rend());
+    }
+
+    return unite(input, FillRule::Positive);
+}
+
+} // namespace polygon
+} // namespace core
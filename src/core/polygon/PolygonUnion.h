@@ -0,0 +1,69 @@
+#pragma once
+
+#include "IntPoint.h"
+
+namespace core {
+namespace polygon {
+
+/**
+ * @brief Dolu bölge kuralı (winding sayısına göre)
+ */
+enum class FillRule
+{
+    NonZero,    // w != 0: üst üste binen kabukların birleşimi
+    Positive    // w > 0: offset sonrası ters dönen (negatif) döngüleri atar
+};
+
+/**
+ * @brief Tam sayı koordinatlı polygon birleşimi
+ *
+ * Çok parçalı (multi-body) STL'lerde üst üste binen kabukların aynı
+ * layer'daki konturlarını tek, temiz bir sınıra indirger.
+ *
+ * Yöntem (arrangement):
+ *  1. Tüm kenarlar grid üzerinde tam sayı testleriyle kesiştirilir,
+ *     kesişim noktaları en yakın mikrona yuvarlanır.
+ *  2. Kenarlar kesişimlerden bölünür; çakışan parçaların yönleri
+ *     toplanır (birbirine değen iki gövdenin ortak kenarı sıfırlanır).
+ *  3. Her parçanın iki yanındaki winding sayısı Y-bantlı ışın testiyle
+ *     bulunur; sadece dolu/boş sınırı (FillRule'a göre) olan parçalar kalır.
+ *  4. Kalan parçalar halkalara bağlanır, doğrusal noktalar atılır.
+ *
+ * Girdi yönü önemlidir: dış kontur CCW, delik CW (Slicer bu şekilde üretir).
+ * Koordinatlar |c| < MAX_COORD olmalıdır.
+ */
+class PolygonUnion
+{
+public:
+    struct Stats
+    {
+        size_t inputEdges = 0;
+        size_t intersections = 0;       // Bulunan kesişim/temas noktası
+        size_t splitEdges = 0;          // Bölme + birleştirme sonrası parça
+        size_t outputEdges = 0;
+        size_t outputPolygons = 0;
+    };
+
+    /**
+     * @brief Polygon'ların birleşimi
+     * @return Dış konturlar CCW, delikler CW
+     */
+    Polygons unite(const Polygons& input, FillRule fillRule = FillRule::NonZero);
+
+    /**
+     * @brief subject - clip (fark)
+     *
+     * clip halkaları ters çevrilip subject ile FillRule::Positive altında
+     * birleştirilir: winding = w(subject) - w(clip) > 0. subject ve clip
+     * kendi içlerinde çakışmasız olmalıdır (unite/offset çıktısı gibi).
+     */
+    Polygons difference(const Polygons& subject, const Polygons& clip);
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    Stats stats_;
+};
+
+} // namespace polygon
+} // namespace core
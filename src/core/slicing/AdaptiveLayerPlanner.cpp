@@ -0,0 +1,124 @@
+#include "AdaptiveLayerPlanner.h"
+#include "SlicingConstants.h"
+#include "core/geometry/kernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+namespace slicing {
+
+namespace {
+
+// Küçülen aralıkta eğim tekrar ölçülür; birkaç tur yeterli yakınsar
+constexpr int MAX_REFINE_ITERATIONS = 4;
+
+} // namespace
+
+AdaptiveLayerPlanner::AdaptiveLayerPlanner(const mesh::Mesh& mesh, const ZIndexedMesh& index)
+    : m_bucketHeight(index.bucketHeight())
+    , m_indexMinZ(index.minZ())
+{
+    const size_t count = mesh.triangles.size();
+    if (count == 0 || index.bucketCount() <= 0)
+    {
+        return;
+    }
+
+    // Kayıtlı normaller bozuk olabilir, geometrik normal kullan (SIMD kernel)
+    std::vector<geometry::Vec3> normals(count);
+    std::vector<float> areas(count);
+    geometry::kernels::computeNormalsAndAreas(mesh.triangles.data(), count,
+                                              normals.data(), areas.data());
+
+    const geometry::Triangle* base = mesh.triangles.data();
+    m_slopeProfile.assign(static_cast<size_t>(index.bucketCount()), 0.0f);
+
+    for (int b = 0; b < index.bucketCount(); ++b)
+    {
+        float slope = 0.0f;
+
+        for (const geometry::Triangle* tri : index.getBucket(b))
+        {
+            const size_t i = static_cast<size_t>(tri - base);
+
+            // Dejenere triangle yüzey oluşturmaz
+            if (areas[i] <= EPSILON_SQ)
+            {
+                continue;
+            }
+
+            // Tam yatay yüzey basamak oluşturmaz, tek düzlemde kesilir
+            const float triMinZ = std::min({tri->vertex1.z, tri->vertex2.z, tri->vertex3.z});
+            const float triMaxZ = std::max({tri->vertex1.z, tri->vertex2.z, tri->vertex3.z});
+            if (triMaxZ - triMinZ <= EPSILON)
+            {
+                continue;
+            }
+
+            slope = std::max(slope, std::fabs(normals[i].z));
+        }
+
+        m_slopeProfile[static_cast<size_t>(b)] = slope;
+    }
+}
+
+std::vector<LayerPlane> AdaptiveLayerPlanner::plan(float minZ, float maxZ,
+                                                   float minHeight, float maxHeight,
+                                                   float maxCusp) const
+{
+    std::vector<LayerPlane> planes;
+
+    if (maxZ <= minZ + EPSILON || minHeight <= 0.0f || maxHeight < minHeight)
+    {
+        return planes;
+    }
+
+    planes.reserve(static_cast<size_t>(std::ceil((maxZ - minZ) / maxHeight)) + 1);
+
+    float z = minZ;
+    while (z < maxZ - EPSILON && planes.size() <= static_cast<size_t>(MAX_LAYER_COUNT))
+    {
+        float h = maxHeight;
+
+        for (int iter = 0; iter < MAX_REFINE_ITERATIONS; ++iter)
+        {
+            const float slope = maxSlopeInRange(z, z + h);
+            const float allowed = slope > EPSILON
+                ? std::clamp(maxCusp / slope, minHeight, maxHeight)
+                : maxHeight;
+
+            if (allowed >= h - EPSILON)
+            {
+                break;
+            }
+            h = allowed;
+        }
+
+        planes.push_back({z, h});
+        z += h;
+    }
+
+    return planes;
+}
+
+float AdaptiveLayerPlanner::maxSlopeInRange(float z0, float z1) const
+{
+    if (m_slopeProfile.empty() || m_bucketHeight <= EPSILON)
+    {
+        return 0.0f;
+    }
+
+    const int last = static_cast<int>(m_slopeProfile.size()) - 1;
+    const int b0 = std::max(0, static_cast<int>(std::floor((z0 - m_indexMinZ) / m_bucketHeight)));
+    const int b1 = std::min(last, static_cast<int>(std::floor((z1 - m_indexMinZ) / m_bucketHeight)));
+
+    float slope = 0.0f;
+    for (int b = b0; b <= b1; ++b)
+    {
+        slope = std::max(slope, m_slopeProfile[static_cast<size_t>(b)]);
+    }
+    return slope;
+}
+
+} // namespace slicing
+} // namespace core
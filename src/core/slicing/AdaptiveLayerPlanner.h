@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Layer.h"
+#include "ZIndexedMesh.h"
+#include "core/mesh/mesh.h"
+#include <vector>
+
+namespace core {
+namespace slicing {
+
+/**
+ * @brief Yüzey eğimine göre değişken layer yüksekliği planlayıcısı
+ *
+ * Basamak (cusp) sapması h * |nz| ile tahmin edilir; her layer için
+ * [z, z + h] aralığındaki en "yatık" yüzey h'yi sınırlar:
+ *
+ *   h = clamp(maxCusp / max|nz|, minHeight, maxHeight)
+ *
+ * - Dik duvarlar (|nz| ≈ 0) → maxHeight
+ * - Sığ kubbeler (|nz| → 1) → minHeight'e doğru incelir
+ *
+ * Aralığın tamamı kontrol edildiği için eğrilik de hesaba katılır:
+ * kubbe tepesine yaklaşan layer, tepeye girmeden önce incelir.
+ *
+ * Eğim profili ZIndexedMesh bucket'larından çıkarılır (bucket başına max |nz|),
+ * bu yüzden index'in bucket yüksekliği minHeight kadar ince olmalıdır.
+ */
+class AdaptiveLayerPlanner
+{
+public:
+    /**
+     * @param mesh  Index'in kurulduğu mesh (triangle pointer'ları buna ait)
+     * @param index mesh üzerindeki Z index
+     */
+    AdaptiveLayerPlanner(const mesh::Mesh& mesh, const ZIndexedMesh& index);
+
+    /**
+     * @brief [minZ, maxZ) aralığı için layer düzlemlerini planla
+     *
+     * @param maxCusp İzin verilen max basamak sapması (mm)
+     * @return Alttan üste sıralı düzlemler (en fazla MAX_LAYER_COUNT + 1)
+     */
+    std::vector<LayerPlane> plan(float minZ, float maxZ,
+                                 float minHeight, float maxHeight,
+                                 float maxCusp) const;
+
+private:
+    float m_bucketHeight;
+    float m_indexMinZ;
+
+    // Bucket index → o bucket'taki max |nz| (0 = sadece dik/yatay düz yüzey)
+    std::vector<float> m_slopeProfile;
+
+    float maxSlopeInRange(float z0, float z1) const;
+};
+
+} // namespace slicing
+} // namespace core
@@ -0,0 +1,179 @@
+#include "ContourBuilder.h"
+#include <cstdlib>
+#include <unordered_map>
+
+namespace core {
+namespace slicing {
+
+namespace {
+
+// Tam eşleşmeyen uçlar için arama yarıçapı (µm)
+constexpr int64_t JOIN_TOLERANCE = 2;
+
+struct FixedSegment
+{
+    polygon::IntPoint start;
+    polygon::IntPoint end;
+};
+
+int64_t pointKey(const polygon::IntPoint& p)
+{
+    // MAX_COORD = 2^28: iki koordinat tek 64-bit anahtara sığar
+    return ((p.x + polygon::MAX_COORD) << 30) ^ (p.y + polygon::MAX_COORD);
+}
+
+} // namespace
+
+polygon::Polygons ContourBuilder::build(const Segment2D* data, size_t count)
+{
+    return build(SegmentView(data, count, 0.0f, 0.0f));
+}
+
+polygon::Polygons ContourBuilder::build(const SegmentView& view)
+{
+    stats_ = Stats{};
+    stats_.segments = view.size();
+
+    std::vector<FixedSegment> segments;
+    segments.reserve(view.size());
+    for (const Segment2D& segment : view)
+    {
+        FixedSegment s{{polygon::toFixed(segment.start.x), polygon::toFixed(segment.start.y)},
+                       {polygon::toFixed(segment.end.x), polygon::toFixed(segment.end.y)}};
+        if (s.start != s.end)
+        {
+            segments.push_back(s);
+        }
+    }
+
+    // Başlangıç noktası → segment
+    std::unordered_multimap<int64_t, size_t> byStart;
+    byStart.reserve(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i)
+    {
+        byStart.emplace(pointKey(segments[i].start), i);
+    }
+
+    std::vector<bool> used(segments.size(), false);
+
+    auto takeNext = [&](const polygon::IntPoint& from) -> size_t {
+        auto range = byStart.equal_range(pointKey(from));
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (!used[it->second])
+            {
+                return it->second;
+            }
+        }
+
+        // Yuvarlama farkı: komşu mikron hücrelerinde ara
+        for (int64_t dy = -JOIN_TOLERANCE; dy <= JOIN_TOLERANCE; ++dy)
+        {
+            for (int64_t dx = -JOIN_TOLERANCE; dx <= JOIN_TOLERANCE; ++dx)
+            {
+                range = byStart.equal_range(pointKey({from.x + dx, from.y + dy}));
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (!used[it->second])
+                    {
+                        stats_.toleranceJoins++;
+                        return it->second;
+                    }
+                }
+            }
+        }
+
+        return segments.size();
+    };
+
+    // Bitiş noktası sayısı: başlangıcına hiçbir segment bitmeyen segment
+    // açık zincirin başıdır
+    std::unordered_map<int64_t, size_t> endCount;
+    endCount.reserve(segments.size());
+    for (const FixedSegment& segment : segments)
+    {
+        endCount[pointKey(segment.end)]++;
+    }
+
+    auto hasIncoming = [&](const polygon::IntPoint& at) {
+        for (int64_t dy = -JOIN_TOLERANCE; dy <= JOIN_TOLERANCE; ++dy)
+        {
+            for (int64_t dx = -JOIN_TOLERANCE; dx <= JOIN_TOLERANCE; ++dx)
+            {
+                if (endCount.count(pointKey({at.x + dx, at.y + dy})) > 0)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    polygon::Polygons contours;
+
+    auto walk = [&](size_t first) {
+        polygon::Polygon contour;
+        size_t current = first;
+        used[current] = true;
+        contour.push_back(segments[current].start);
+
+        for (;;)
+        {
+            const polygon::IntPoint& end = segments[current].end;
+            if (end == segments[first].start)
+            {
+                break;
+            }
+
+            const size_t next = takeNext(end);
+            if (next == segments.size())
+            {
+                const polygon::IntPoint& start = segments[first].start;
+                if (std::abs(end.x - start.x) <= JOIN_TOLERANCE &&
+                    std::abs(end.y - start.y) <= JOIN_TOLERANCE)
+                {
+                    stats_.toleranceJoins++;
+                    break;
+                }
+
+                // Açık zincir: son noktayı ekle, polygon kapanışı bağlar
+                contour.push_back(end);
+                stats_.openChains++;
+                break;
+            }
+
+            used[next] = true;
+            contour.push_back(segments[next].start);
+            current = next;
+        }
+
+        if (contour.size() >= 3)
+        {
+            contours.push_back(std::move(contour));
+        }
+    };
+
+    // Önce açık zincirler baştan yürünür (ortadan başlamak zinciri böler),
+    // kalan segmentler kapalı döngülerdir
+    for (size_t first = 0; first < segments.size(); ++first)
+    {
+        if (!used[first] && !hasIncoming(segments[first].start))
+        {
+            walk(first);
+        }
+    }
+
+    for (size_t first = 0; first < segments.size(); ++first)
+    {
+        if (!used[first])
+        {
+            walk(first);
+        }
+    }
+
+    stats_.contours = contours.size();
+    return contours;
+}
+
+} // namespace slicing
+} // namespace core
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "SegmentArena.h"
+#include "core/polygon/IntPoint.h"
+
+namespace core {
+namespace slicing {
+
+/**
+ * @brief Layer segmentlerini kapalı fixed-point konturlara zincirler
+ *
+ * Uç noktalar mikrona yuvarlanır ve hash ile eşleştirilir; float
+ * farkından dolayı tam eşleşmeyen uçlar küçük bir tolerans içinde
+ * en yakın başlangıca bağlanır. Kapanmayan zincirler (açık mesh)
+ * yine de kapatılır ve istatistikte sayılır.
+ *
+ * Segment yönü korunur: Slicer malzemeyi segmentin soluna koyar,
+ * böylece dış konturlar CCW, delikler CW çıkar.
+ */
+class ContourBuilder
+{
+public:
+    struct Stats
+    {
+        size_t segments = 0;
+        size_t contours = 0;
+        size_t openChains = 0;      // Kapanmadan biten zincir
+        size_t toleranceJoins = 0;  // Tam eşleşme olmadan bağlanan uç
+    };
+
+    /**
+     * @param count Zincirlenecek segment sayısı (data'dan itibaren)
+     */
+    polygon::Polygons build(const Segment2D* data, size_t count);
+
+    /**
+     * @brief Layer görünümünden (yerleşim kaydırması uygulanmış) konturlar
+     */
+    polygon::Polygons build(const SegmentView& segments);
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    Stats stats_;
+};
+
+} // namespace slicing
+} // namespace core
@@ -1,13 +1,27 @@
 #pragma once
 
-#include "LineSegment.h"
-#include <vector>
+#include "SegmentArena.h"
+#include "core/geometry/vec3.h"
+#include <memory>
 
 namespace core {
 namespace slicing {
 
+/**
+ * @brief Slice düzlemi ve o düzlemden başlayan layer'ın kalınlığı
+ */
+struct LayerPlane
+{
+    float z = 0.0f;
+    float thickness = 0.0f;
+};
+
 /**
  * @brief Tek bir slice layer (Z seviyesinde)
+ *
+ * Segmentleri kendisi tutmaz: paylaşılan bir SegmentArena'daki
+ * [offset, offset + count) aralığına bakar. Kopyalamak ucuzdur
+ * (segmentler kopyalanmaz), arena son layer ile birlikte serbest kalır.
  */
 class Layer
 {
@@ -16,71 +30,77 @@ public:
     explicit Layer(float zHeight) : zHeight_(zHeight) {}
 
     /**
-     * @brief Z yüksekliği
+     * @param arena  Segmentlerin bulunduğu arena
+     * @param offset Layer'ın arena'daki ilk segmenti
+     * @param count  Segment sayısı
      */
-    float zHeight() const { return zHeight_; }
-    void setZHeight(float z) { zHeight_ = z; }
+    Layer(float zHeight, std::shared_ptr<const SegmentArena> arena, size_t offset, size_t count)
+        : zHeight_(zHeight)
+        , arena_(std::move(arena))
+        , offset_(offset)
+        , count_(count)
+        , rawCount_(count)
+    {}
 
     /**
-     * @brief Segment kapasitesi ayarla (performance optimization)
-     *
-     * Segment eklemeden önce tahmini segment sayısını reserve etmek
-     * reallocation'ları önler ve performansı artırır.
-     *
-     * @param capacity Tahmini segment sayısı
+     * @brief Z yüksekliği
      */
-    void reserve(size_t capacity)
-    {
-        segments_.reserve(capacity);
-    }
+    float zHeight() const { return zHeight_; }
+    void setZHeight(float z) { zHeight_ = z; }
 
     /**
-     * @brief Şu anki kapasite
+     * @brief Layer kalınlığı (adaptive modda layer'dan layer'a değişir)
      */
-    size_t capacity() const { return segments_.capacity(); }
+    float thickness() const { return thickness_; }
+    void setThickness(float thickness) { thickness_ = thickness; }
 
     /**
-     * @brief Line segment ekle
+     * @brief Segmentleri ve Z'yi kaydır (yerleşim offset'i)
+     *
+     * Arena değişmez; XY kayması okuma sırasında uygulanır.
      */
-    void addSegment(const LineSegment& segment)
+    void translate(const geometry::Vec3& offset)
     {
-        segments_.push_back(segment);
+        offsetX_ += offset.x;
+        offsetY_ += offset.y;
+        zHeight_ += offset.z;
     }
 
     /**
-     * @brief Tüm segmentler
+     * @brief Tüm segmentler (kaydırma uygulanmış, değer olarak)
      */
-    const std::vector<LineSegment>& segments() const { return segments_; }
+    SegmentView segments() const
+    {
+        return arena_ ? SegmentView(arena_->data() + offset_, count_, offsetX_, offsetY_)
+                      : SegmentView();
+    }
 
     /**
      * @brief Segment sayısı
      */
-    size_t segmentCount() const { return segments_.size(); }
-
-    /**
-     * @brief Layer boş mu?
-     */
-    bool isEmpty() const { return segments_.empty(); }
+    size_t segmentCount() const { return count_; }
 
     /**
-     * @brief Temizle
+     * @brief Kontur işlemlerinden (birleştirme, sadeleştirme) önceki segment sayısı
      */
-    void clear()
-    {
-        segments_.clear();
-    }
+    size_t rawSegmentCount() const { return rawCount_; }
+    void setRawSegmentCount(size_t count) { rawCount_ = count; }
 
     /**
-     * @brief Belleği serbest bırak
+     * @brief Layer boş mu?
      */
-    void shrink_to_fit()
-    {
-        segments_.shrink_to_fit();
-    }
+    bool isEmpty() const { return count_ == 0; }
 
 private:
     float zHeight_ = 0.0f;
-    std::vector<LineSegment> segments_;
+    float thickness_ = 0.0f;
+    float offsetX_ = 0.0f;
+    float offsetY_ = 0.0f;
+
+    std::shared_ptr<const SegmentArena> arena_;
+    size_t offset_ = 0;
+    size_t count_ = 0;
+    size_t rawCount_ = 0;
 };
 
 } // namespace slicing
@@ -0,0 +1,265 @@
+#include "LayerProvider.h"
+#include "SlicingConstants.h"
+#include <algorithm>
+
+namespace core {
+namespace slicing {
+
+LayerProvider::LayerProvider(std::shared_ptr<const ZIndexedMesh> index,
+                             std::shared_ptr<const mesh::Mesh> meshOwner,
+                             std::vector<LayerPlane> planes,
+                             const geometry::Vec3& offset,
+                             const SlicingSettings& settings,
+                             const Options& options,
+                             CompletionCallback onComplete)
+    : m_index(std::move(index))
+    , m_meshOwner(std::move(meshOwner))
+    , m_planes(std::move(planes))
+    , m_offset(offset)
+    , m_contourOptions(settings)
+    , m_options(options)
+    , m_onComplete(std::move(onComplete))
+{
+    m_options.cacheCapacity = std::max<size_t>(1, m_options.cacheCapacity);
+
+    m_fullResult.layerHeight = settings.layerHeight;
+    m_fullResult.adaptiveLayers = settings.adaptiveLayers;
+    if (!m_planes.empty())
+    {
+        m_fullResult.totalHeight = m_planes.back().z + m_planes.back().thickness - m_planes.front().z;
+    }
+    m_fullResult.layers.reserve(m_options.backgroundFullSlice ? m_planes.size() : 0);
+    m_complete = m_planes.empty();
+
+    m_worker = std::thread(&LayerProvider::workerLoop, this);
+}
+
+LayerProvider::~LayerProvider()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeup.notify_all();
+
+    if (m_worker.joinable())
+    {
+        m_worker.join();
+    }
+}
+
+float LayerProvider::zHeight(size_t layerIndex) const
+{
+    return layerIndex < m_planes.size() ? m_planes[layerIndex].z + m_offset.z : 0.0f;
+}
+
+std::shared_ptr<const Layer> LayerProvider::layer(size_t layerIndex)
+{
+    if (layerIndex >= m_planes.size())
+    {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        schedulePrefetchLocked(layerIndex);
+
+        if (LayerPtr cached = findCachedLocked(layerIndex))
+        {
+            m_stats.hits++;
+            m_wakeup.notify_one();
+            return cached;
+        }
+        m_stats.misses++;
+    }
+    m_wakeup.notify_one();
+
+    // Kilit dışında kes, UI thread worker'ı beklemesin
+    LayerPtr fresh = sliceLayer(layerIndex);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    insertCachedLocked(layerIndex, fresh);
+    return fresh;
+}
+
+bool LayerProvider::isComplete() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_complete;
+}
+
+LayerProvider::Stats LayerProvider::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+LayerProvider::LayerPtr LayerProvider::sliceLayer(size_t layerIndex) const
+{
+    const LayerPlane& plane = m_planes[layerIndex];
+
+    // Slicer state tutmaz, index salt okunur: thread'ler arası güvenli
+    Slicer slicer;
+    auto result = std::make_shared<Layer>(slicer.sliceLayerAtZ(*m_index, plane.z, m_contourOptions));
+    result->setThickness(plane.thickness);
+    result->translate(m_offset);
+    return result;
+}
+
+LayerProvider::LayerPtr LayerProvider::findCachedLocked(size_t layerIndex)
+{
+    auto it = m_cache.find(layerIndex);
+    if (it == m_cache.end())
+    {
+        return nullptr;
+    }
+
+    // En yeni olarak işaretle
+    m_lruOrder.splice(m_lruOrder.begin(), m_lruOrder, it->second.second);
+    return it->second.first;
+}
+
+void LayerProvider::insertCachedLocked(size_t layerIndex, const LayerPtr& layer)
+{
+    auto it = m_cache.find(layerIndex);
+    if (it != m_cache.end())
+    {
+        m_lruOrder.splice(m_lruOrder.begin(), m_lruOrder, it->second.second);
+        return;
+    }
+
+    m_lruOrder.push_front(layerIndex);
+    m_cache.emplace(layerIndex, std::make_pair(layer, m_lruOrder.begin()));
+
+    while (m_cache.size() > m_options.cacheCapacity)
+    {
+        m_cache.erase(m_lruOrder.back());
+        m_lruOrder.pop_back();
+    }
+}
+
+void LayerProvider::schedulePrefetchLocked(size_t center)
+{
+    // Yeni istek eski komşuluktan önemli: kuyruğu baştan kur, yakından uzağa
+    m_prefetchQueue.clear();
+
+    const size_t radius = std::min(m_options.prefetchRadius, m_options.cacheCapacity / 2);
+    for (size_t d = 1; d <= radius; ++d)
+    {
+        if (center + d < m_planes.size())
+        {
+            m_prefetchQueue.push_back(center + d);
+        }
+        if (center >= d)
+        {
+            m_prefetchQueue.push_back(center - d);
+        }
+    }
+}
+
+void LayerProvider::workerLoop()
+{
+    for (;;)
+    {
+        size_t target = 0;
+        bool prefetch = false;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            // Önce cache'te olmayan ilk prefetch isteğini bul
+            for (;;)
+            {
+                m_wakeup.wait(lock, [this]() {
+                    const bool fullPending = m_options.backgroundFullSlice && !m_complete;
+                    return m_stop || !m_prefetchQueue.empty() || fullPending;
+                });
+
+                if (m_stop)
+                {
+                    return;
+                }
+
+                if (m_prefetchQueue.empty())
+                {
+                    break;
+                }
+
+                target = m_prefetchQueue.front();
+                m_prefetchQueue.pop_front();
+                if (m_cache.find(target) == m_cache.end())
+                {
+                    prefetch = true;
+                    break;
+                }
+            }
+
+            if (!prefetch)
+            {
+                target = m_nextFullSlice;
+            }
+        }
+
+        if (prefetch)
+        {
+            LayerPtr fresh = sliceLayer(target);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            insertCachedLocked(target, fresh);
+            m_stats.prefetched++;
+            continue;
+        }
+
+        // Tam slicing adımı: LRU'da varsa tekrar kesme
+        LayerPtr layer;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_cache.find(target);
+            if (it != m_cache.end())
+            {
+                layer = it->second.first;
+            }
+        }
+        if (!layer)
+        {
+            layer = sliceLayer(target);
+        }
+
+        if (!layer->isEmpty())
+        {
+            m_fullResult.totalSegments += static_cast<int>(layer->segmentCount());
+            m_fullResult.rawSegments += static_cast<int>(layer->rawSegmentCount());
+            m_fullResult.layers.push_back(*layer);
+        }
+
+        bool finished = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_nextFullSlice++;
+            m_stats.fullSliced = m_nextFullSlice;
+            finished = m_nextFullSlice >= m_planes.size();
+            m_complete = finished;
+        }
+
+        if (finished)
+        {
+            if (m_fullResult.layers.empty())
+            {
+                m_fullResult.error = SlicingError::NoIntersections;
+                m_fullResult.errorMessage = "No intersections found";
+            }
+            else
+            {
+                m_fullResult.error = SlicingError::Success;
+            }
+
+            if (m_onComplete)
+            {
+                m_onComplete(std::move(m_fullResult));
+            }
+        }
+    }
+}
+
+} // namespace slicing
+} // namespace core
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Slicer.h"
+#include "ZIndexedMesh.h"
+#include "core/mesh/mesh.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+namespace slicing {
+
+/**
+ * @brief Hazır Z index üzerinden layer'ları talep edildikçe kesen sağlayıcı
+ *
+ * SlicingResult tüm layer'ları baştan üretir; UI ise çoğu zaman tek layer
+ * gösterir. Bu sınıf:
+ *
+ * - layer(i) çağrısında layer'ı cache'ten verir ya da o an keser,
+ * - son kullanılan layer'ları sınırlı bir LRU'da tutar,
+ * - istenen layer'ın komşularını arka plan thread'inde önceden keser,
+ * - boşta kaldığında (opsiyonel) tam slicing'i arka planda tamamlayıp
+ *   sonucu callback ile bildirir.
+ *
+ * Index layer 0..layerCount()-1 düzlem sırasıdır; kesişimi olmayan
+ * düzlemler boş layer döner (SlicingResult'taki gibi atlanmaz).
+ *
+ * Index ve oriented mesh paylaşımlı tutulur. Rotasyon yoksa index kaynak
+ * mesh'e işaret eder: kaynak, sağlayıcı yok edilene kadar değişmemelidir.
+ */
+class LayerProvider
+{
+public:
+    /**
+     * @brief Tam slicing bittiğinde arka plan thread'inden çağrılır
+     */
+    using CompletionCallback = std::function<void(SlicingResult)>;
+
+    struct Options
+    {
+        size_t cacheCapacity = 64;          // LRU'daki max layer
+        size_t prefetchRadius = 4;          // İstenen layer'ın iki yanında
+        bool backgroundFullSlice = true;    // Boşta tüm layer'ları kes
+    };
+
+    /**
+     * @param index     Lokal koordinatta Z index
+     * @param meshOwner Index'in işaret ettiği mesh (referansla verilen kaynak ise nullptr)
+     * @param planes    Lokal koordinatta düzlemler (alttan üste)
+     * @param offset    Dünya koordinatına geçiş (yerleşim translation'ı)
+     */
+    LayerProvider(std::shared_ptr<const ZIndexedMesh> index,
+                  std::shared_ptr<const mesh::Mesh> meshOwner,
+                  std::vector<LayerPlane> planes,
+                  const geometry::Vec3& offset,
+                  const SlicingSettings& settings,
+                  const Options& options,
+                  CompletionCallback onComplete = nullptr);
+
+    /**
+     * @brief Arka plan thread'ini durdurur ve bekler
+     */
+    ~LayerProvider();
+
+    LayerProvider(const LayerProvider&) = delete;
+    LayerProvider& operator=(const LayerProvider&) = delete;
+
+    size_t layerCount() const { return m_planes.size(); }
+
+    /**
+     * @brief Layer'ın dünya Z'si (kesmeden)
+     */
+    float zHeight(size_t layerIndex) const;
+
+    /**
+     * @brief Layer'ı getir (dünya koordinatında)
+     *
+     * Cache'te yoksa çağıran thread'de kesilir. Her çağrı komşuların
+     * arka planda önceden kesilmesini tetikler.
+     *
+     * @return layerIndex aralık dışıysa nullptr
+     */
+    std::shared_ptr<const Layer> layer(size_t layerIndex);
+
+    /**
+     * @brief Tam slicing bitti mi?
+     */
+    bool isComplete() const;
+
+    struct Stats
+    {
+        size_t hits = 0;            // layer() cache'ten döndü
+        size_t misses = 0;          // layer() o an kesti
+        size_t prefetched = 0;      // Arka planda komşu kesildi
+        size_t fullSliced = 0;      // Tam slicing ilerlemesi (düzlem)
+    };
+
+    Stats stats() const;
+
+private:
+    using LayerPtr = std::shared_ptr<const Layer>;
+
+    std::shared_ptr<const ZIndexedMesh> m_index;
+    std::shared_ptr<const mesh::Mesh> m_meshOwner;
+    std::vector<LayerPlane> m_planes;
+    geometry::Vec3 m_offset;
+    ContourOptions m_contourOptions;
+    Options m_options;
+    CompletionCallback m_onComplete;
+
+    SlicingResult m_fullResult;     // Sadece worker thread yazar
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+
+    // LRU: öndeki en yeni
+    std::list<size_t> m_lruOrder;
+    std::unordered_map<size_t, std::pair<LayerPtr, std::list<size_t>::iterator>> m_cache;
+
+    std::deque<size_t> m_prefetchQueue;
+    size_t m_nextFullSlice = 0;
+    bool m_complete = false;
+    bool m_stop = false;
+    Stats m_stats;
+
+    std::thread m_worker;
+
+    LayerPtr sliceLayer(size_t layerIndex) const;
+
+    // m_mutex tutulurken çağrılır
+    LayerPtr findCachedLocked(size_t layerIndex);
+    void insertCachedLocked(size_t layerIndex, const LayerPtr& layer);
+    void schedulePrefetchLocked(size_t center);
+
+    void workerLoop();
+};
+
+} // namespace slicing
+} // namespace core
@@ -0,0 +1,154 @@
+#include "PlacedMesh.h"
+#include "core/geometry/kernels.h"
+#include <algorithm>
+#include <cfloat>
+
+namespace core {
+namespace slicing {
+
+PlacedMesh::PlacedMesh(const mesh::Mesh& source)
+    : source_(&source)
+{
+}
+
+PlacedMesh::PlacedMesh(std::shared_ptr<const mesh::Mesh> source)
+    : source_(source.get())
+    , sourceOwner_(std::move(source))
+{
+}
+
+void PlacedMesh::setTransform(const mesh::ModelTransform& transform)
+{
+    const bool rotationChanged = transform.rotation.x != transform_.rotation.x ||
+                                 transform.rotation.y != transform_.rotation.y ||
+                                 transform.rotation.z != transform_.rotation.z;
+
+    transform_ = transform;
+
+    if (rotationChanged)
+    {
+        invalidateOrientation();
+    }
+}
+
+const mesh::Mesh& PlacedMesh::orientedMesh()
+{
+    if (orientationDirty_)
+    {
+        if (transform_.hasRotation())
+        {
+            oriented_ = std::make_shared<const mesh::Mesh>(
+                mesh::MeshTransform::transformed(*source_, transform_.rotationMatrix()));
+            stats_.rotationBakes++;
+        }
+        else
+        {
+            oriented_.reset();
+        }
+        orientationDirty_ = false;
+    }
+
+    return oriented_ ? *oriented_ : *source_;
+}
+
+const mesh::MeshSoA& PlacedMesh::orientedSoA()
+{
+    const mesh::Mesh& oriented = orientedMesh();
+
+    if (!soa_)
+    {
+        if (!oriented_ && sourceSoA_ && sourceSoA_->triangleCount() == oriented.triangles.size())
+        {
+            soa_ = sourceSoA_;
+        }
+        else
+        {
+            soa_ = std::make_shared<const mesh::MeshSoA>(oriented);
+            stats_.soaBuilds++;
+        }
+    }
+
+    return *soa_;
+}
+
+void PlacedMesh::setSourceSoA(std::shared_ptr<const mesh::MeshSoA> soa)
+{
+    sourceSoA_ = std::move(soa);
+    invalidateOrientation();
+}
+
+const ZIndexedMesh& PlacedMesh::index(float bucketHeight)
+{
+    return *sharedIndex(bucketHeight);
+}
+
+std::shared_ptr<const ZIndexedMesh> PlacedMesh::sharedIndex(float bucketHeight)
+{
+    const mesh::Mesh& oriented = orientedMesh();
+
+    if (!index_ || indexBucketHeight_ != bucketHeight)
+    {
+        index_ = soa_ ? std::make_shared<const ZIndexedMesh>(oriented, *soa_, bucketHeight)
+                      : std::make_shared<const ZIndexedMesh>(oriented, bucketHeight);
+        indexBucketHeight_ = bucketHeight;
+        stats_.indexBuilds++;
+    }
+    else
+    {
+        stats_.indexReuses++;
+    }
+
+    return index_;
+}
+
+std::shared_ptr<const mesh::Mesh> PlacedMesh::sharedOrientedMesh()
+{
+    orientedMesh();
+    return oriented_ ? oriented_ : sourceOwner_;
+}
+
+void PlacedMesh::localBoundsZ(float& minZ, float& maxZ)
+{
+    const mesh::Mesh& oriented = orientedMesh();
+
+    if (!boundsValid_)
+    {
+        if (soa_)
+        {
+            // Sadece z dizileri taranır
+            localMinZ_ = FLT_MAX;
+            localMaxZ_ = -FLT_MAX;
+
+            for (int corner = 0; corner < 3; ++corner)
+            {
+                float lo, hi;
+                geometry::kernels::minMax(soa_->z(corner), soa_->triangleCount(), lo, hi);
+                localMinZ_ = std::min(localMinZ_, lo);
+                localMaxZ_ = std::max(localMaxZ_, hi);
+            }
+        }
+        else
+        {
+            const geometry::AABB bounds = geometry::kernels::computeBounds(oriented.triangles.data(),
+                                                                           oriented.triangles.size());
+            localMinZ_ = bounds.min.z;
+            localMaxZ_ = bounds.max.z;
+        }
+        boundsValid_ = true;
+    }
+
+    minZ = localMinZ_;
+    maxZ = localMaxZ_;
+}
+
+void PlacedMesh::invalidateOrientation()
+{
+    // Index oriented mesh'teki triangle'lara pointer tutar, önce o gitmeli
+    index_.reset();
+    soa_.reset();
+    boundsValid_ = false;
+    orientationDirty_ = true;
+}
+
+} // namespace slicing
+} // namespace core
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "ZIndexedMesh.h"
+#include "core/mesh/mesh.h"
+#include "core/mesh/MeshSoA.h"
+#include "core/mesh/MeshTransform.h"
+#include <memory>
+
+namespace core {
+namespace slicing {
+
+/**
+ * @brief Yerleşimi (placement) bilinen slicing girdisi
+ *
+ * Ekranda görülen transform ile slice edilen geometri aynı olsun diye
+ * Slicer'a ham mesh yerine bu sınıf verilir.
+ *
+ * - Rotasyon: lazy olarak, paralel şekilde kopyaya "bake" edilir.
+ *   Rotasyon yoksa kaynak mesh doğrudan kullanılır (kopya yok).
+ * - Translation: geometriye hiç uygulanmaz. Z kayması index sorgusunda
+ *   offset olarak, XY kayması segmentlere kaydırma olarak uygulanır.
+ *   Yani parçayı plate üzerinde oynatmak index'i yeniden kurmaz.
+ *
+ * Kaynak referansla verildiyse bu nesneden uzun yaşamalı ve değişmemelidir;
+ * shared_ptr ile verildiyse sahiplik paylaşılır.
+ */
+class PlacedMesh
+{
+public:
+    explicit PlacedMesh(const mesh::Mesh& source);
+
+    /**
+     * @brief Paylaşımlı kaynak: mesh bu nesne (ve dağıttığı index'ler) kadar yaşar
+     */
+    explicit PlacedMesh(std::shared_ptr<const mesh::Mesh> source);
+
+    /**
+     * @brief Yerleşimi güncelle
+     * Sadece rotasyon değiştiyse oriented kopya ve index geçersiz olur.
+     */
+    void setTransform(const mesh::ModelTransform& transform);
+
+    const mesh::ModelTransform& transform() const { return transform_; }
+
+    /**
+     * @brief Dünya koordinatına geçiş için offset (translation)
+     */
+    const geometry::Vec3& offset() const { return transform_.translation; }
+
+    /**
+     * @brief Rotasyonu uygulanmış (translation'sız) mesh
+     */
+    const mesh::Mesh& orientedMesh();
+
+    /**
+     * @brief Oriented mesh'in SoA görünümü (lazy, rotasyon değişene kadar saklanır)
+     *
+     * Bir kez kurulduktan sonra index ve Z sınırları da bunu kullanır.
+     * Rotasyon yoksa setSourceSoA() ile verilen görünüm kopyasız kullanılır.
+     */
+    const mesh::MeshSoA& orientedSoA();
+
+    /**
+     * @brief Kaynak mesh'in önceden kurulmuş SoA görünümü (ör. yükleme analizinden)
+     *
+     * Kaynakla aynı triangle sırasında olmalıdır; sayı tutmazsa yok sayılır.
+     */
+    void setSourceSoA(std::shared_ptr<const mesh::MeshSoA> soa);
+
+    /**
+     * @brief Oriented mesh üzerindeki Z index
+     *
+     * Rotasyon ve bucket yüksekliği aynı kaldıkça tekrar kullanılır.
+     */
+    const ZIndexedMesh& index(float bucketHeight);
+
+    /**
+     * @brief index() ile aynı, arka plan işleri için paylaşımlı sahiplik
+     *
+     * Rotasyon değişse de dönen index (ve oriented kopya) yaşamaya devam eder.
+     * Rotasyon yoksa index kaynak mesh'e işaret eder; kaynağı canlı tutmak
+     * için sharedOrientedMesh() da alınmalıdır.
+     */
+    std::shared_ptr<const ZIndexedMesh> sharedIndex(float bucketHeight);
+
+    /**
+     * @brief Index'in işaret ettiği mesh'in sahipliği
+     *
+     * Rotasyon varsa oriented kopya, yoksa paylaşımlı kaynak; kaynak
+     * referansla verildiyse ve rotasyon yoksa nullptr.
+     */
+    std::shared_ptr<const mesh::Mesh> sharedOrientedMesh();
+
+    /**
+     * @brief Oriented mesh'in lokal Z sınırları
+     */
+    void localBoundsZ(float& minZ, float& maxZ);
+
+    /**
+     * @brief Yeniden kullanım istatistikleri
+     */
+    struct Stats
+    {
+        int rotationBakes = 0;      // Kaç kez rotasyon kopyaya uygulandı
+        int indexBuilds = 0;        // Kaç kez ZIndexedMesh kuruldu
+        int indexReuses = 0;        // Kaç kez mevcut index kullanıldı
+        int soaBuilds = 0;          // Kaç kez SoA görünümü kuruldu
+    };
+
+    const Stats& stats() const { return stats_; }
+
+private:
+    const mesh::Mesh* source_;
+    std::shared_ptr<const mesh::Mesh> sourceOwner_;    // Referansla kurulduysa nullptr
+    mesh::ModelTransform transform_;
+
+    std::shared_ptr<const mesh::Mesh> oriented_;    // nullptr = kaynak mesh kullanılır
+    bool orientationDirty_ = true;
+
+    std::shared_ptr<const mesh::MeshSoA> soa_;         // nullptr = henüz kurulmadı
+    std::shared_ptr<const mesh::MeshSoA> sourceSoA_;   // Rotasyonsuz durumda soa_ olarak kullanılır
+
+    std::shared_ptr<const ZIndexedMesh> index_;
+    float indexBucketHeight_ = 0.0f;
+
+    float localMinZ_ = 0.0f;
+    float localMaxZ_ = 0.0f;
+    bool boundsValid_ = false;
+
+    Stats stats_;
+
+    void invalidateOrientation();
+};
+
+} // namespace slicing
+} // namespace core
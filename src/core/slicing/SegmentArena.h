@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace core {
+namespace slicing {
+
+/**
+ * @brief Layer düzleminde 2D nokta (z layer'da tutulur)
+ */
+struct Point2D
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+/**
+ * @brief Kompakt 2D segment: 16 byte (LineSegment 24 byte)
+ */
+struct Segment2D
+{
+    Point2D start;
+    Point2D end;
+
+    float length() const
+    {
+        float dx = end.x - start.x;
+        float dy = end.y - start.y;
+        return std::sqrt(dx*dx + dy*dy);
+    }
+};
+
+static_assert(sizeof(Segment2D) == 4 * sizeof(float), "Segment2D must stay tightly packed");
+
+/**
+ * @brief Bir slicing sonucunun tüm segmentlerini tutan tek blok
+ *
+ * Layer'lar buraya offset/uzunluk görünümü olarak bakar; layer başına
+ * ayrı allocation yapılmaz. Sadece sona ekleme yapılır, bu yüzden arena
+ * büyüse de mevcut layer'ların offset'leri geçerli kalır.
+ */
+class SegmentArena
+{
+public:
+    void reserve(size_t capacity) { segments_.reserve(capacity); }
+
+    void push_back(const Segment2D& segment) { segments_.push_back(segment); }
+
+    void append(const Segment2D* data, size_t count) { segments_.insert(segments_.end(), data, data + count); }
+
+    /**
+     * @brief Sondaki segmentleri at (henüz layer'a verilmemiş aralık için)
+     */
+    void truncate(size_t size) { segments_.resize(std::min(size, segments_.size())); }
+
+    size_t size() const { return segments_.size(); }
+    bool empty() const { return segments_.empty(); }
+    const Segment2D* data() const { return segments_.data(); }
+
+    /**
+     * @brief Ayrılmış bellek (byte)
+     */
+    size_t memoryBytes() const { return segments_.capacity() * sizeof(Segment2D); }
+
+private:
+    std::vector<Segment2D> segments_;
+};
+
+/**
+ * @brief Arena'daki bir layer'ın segmentlerine salt okunur görünüm
+ *
+ * Yerleşim kaydırması (dx, dy) okuma sırasında uygulanır; paylaşılan arena
+ * hiç değiştirilmez. Elemanlar değer olarak döner:
+ *
+ *   for (const auto& segment : layer.segments()) { ... }
+ */
+class SegmentView
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Segment2D;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Segment2D;
+
+        Iterator(const Segment2D* pos, float dx, float dy)
+            : pos_(pos), dx_(dx), dy_(dy)
+        {}
+
+        Segment2D operator*() const
+        {
+            return {{pos_->start.x + dx_, pos_->start.y + dy_},
+                    {pos_->end.x + dx_, pos_->end.y + dy_}};
+        }
+
+        Iterator& operator++()
+        {
+            ++pos_;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++pos_;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return pos_ == other.pos_; }
+        bool operator!=(const Iterator& other) const { return pos_ != other.pos_; }
+
+    private:
+        const Segment2D* pos_;
+        float dx_;
+        float dy_;
+    };
+
+    SegmentView() = default;
+
+    SegmentView(const Segment2D* data, size_t count, float dx, float dy)
+        : data_(data), count_(count), dx_(dx), dy_(dy)
+    {}
+
+    Iterator begin() const { return Iterator(data_, dx_, dy_); }
+    Iterator end() const { return Iterator(data_ + count_, dx_, dy_); }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    Segment2D operator[](size_t i) const { return *Iterator(data_ + i, dx_, dy_); }
+
+private:
+    const Segment2D* data_ = nullptr;
+    size_t count_ = 0;
+    float dx_ = 0.0f;
+    float dy_ = 0.0f;
+};
+
+} // namespace slicing
+} // namespace core
@@ -4,6 +4,9 @@
 #include "LineSegment.h"
 #include "SlicingConstants.h"
 #include "core/mesh/mesh.h"
+#include "core/mesh/MeshSoA.h"
+#include <cstdint>
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -12,6 +15,7 @@ namespace slicing {
 
 // ⭐ Forward declaration
 class ZIndexedMesh;
+class PlacedMesh;
 
 enum class SlicingError
 {
@@ -36,6 +40,48 @@ struct SlicingSettings
     float minZ = 0.0f;
     float maxZ = 0.0f;
     bool useSpatialIndex = true;
+
+    // Adaptive layer height: yüzey eğimine göre [min, max] aralığında
+    bool adaptiveLayers = false;
+    float minLayerHeight = 0.05f;
+    float maxLayerHeight = 0.3f;
+    float maxCuspHeight = 0.0f;     // İzin verilen basamak sapması (mm), 0 = layerHeight
+
+    // Çok gövdeli mesh'lerde üst üste binen kabukları layer başına birleştir
+    // (kesişen iç segmentler atılır, sınır mikron ızgarasına yuvarlanır)
+    bool unionOverlappingShells = false;
+
+    // Konturları Douglas-Peucker ile sadeleştir: max sapma (mm), 0 = kapalı.
+    // Tarama verisindeki mikro segmentleri export ve layer görünümünden atar
+    float simplifyTolerance = 0.0f;
+};
+
+/**
+ * @brief Kesit sonrası kontur işlemleri (SlicingSettings'in ilgili kısmı)
+ *
+ * İkisi de kapalıysa ham segmentler olduğu gibi kalır. Plane bazlı
+ * cache'ler bu değer değişince temizlenmelidir.
+ */
+struct ContourOptions
+{
+    bool unionShells = false;
+    float simplifyTolerance = 0.0f;     // mm
+
+    ContourOptions() = default;
+
+    explicit ContourOptions(const SlicingSettings& settings)
+        : unionShells(settings.unionOverlappingShells)
+        , simplifyTolerance(std::max(0.0f, settings.simplifyTolerance))
+    {}
+
+    bool active() const { return unionShells || simplifyTolerance > 0.0f; }
+
+    bool operator==(const ContourOptions& other) const
+    {
+        return unionShells == other.unionShells && simplifyTolerance == other.simplifyTolerance;
+    }
+
+    bool operator!=(const ContourOptions& other) const { return !(*this == other); }
 };
 
 struct SlicingResult
@@ -43,13 +89,23 @@ struct SlicingResult
     std::vector<Layer> layers;
 
     int totalSegments = 0;
+    int rawSegments = 0;            // Kontur işlemlerinden önce (işlem yoksa totalSegments)
     float totalHeight = 0.0f;
-    float layerHeight = 0.0f;
+    float layerHeight = 0.0f;       // Adaptive modda nominal değer, gerçek kalınlık Layer'da
+    bool adaptiveLayers = false;
 
     SlicingError error = SlicingError::Success;
     std::string errorMessage;
 
     bool success() const { return error == SlicingError::Success; }
+
+    /**
+     * @brief Kontur işlemlerinin segment azaltma oranı (ham / sonuç, 1 = değişmedi)
+     */
+    double segmentReduction() const
+    {
+        return totalSegments > 0 ? static_cast<double>(rawSegments) / totalSegments : 1.0;
+    }
 };
 
 class Slicer
@@ -59,16 +115,103 @@ public:
 
     SlicingResult slice(const mesh::Mesh& mesh, const SlicingSettings& settings);
 
+    /**
+     * @brief SoA görünümü hazır olan mesh'i slice et
+     *
+     * Z sınırları, index kurulumu ve naive kesimin aday seçimi sadece
+     * z dizilerini tarar; segmentler yine mesh.triangles'tan hesaplanır.
+     * @param soa mesh'ten oluşturulmuş görünüm (aynı triangle sırası)
+     */
+    SlicingResult slice(const mesh::Mesh& mesh, const mesh::MeshSoA& soa,
+                        const SlicingSettings& settings);
+
+    /**
+     * @brief Yerleşimi uygulanmış mesh'i slice et
+     *
+     * Layer'lar dünya (build plate) koordinatında döner; minZ/maxZ de
+     * dünya koordinatında yorumlanır. Z index yalnızca rotasyon veya
+     * layer yüksekliği değişince yeniden kurulur.
+     */
+    SlicingResult slice(PlacedMesh& placed, const SlicingSettings& settings);
+
 private:
+    // Oturum, plane bazlı cache için düşük seviye adımları kullanır
+    friend class SlicingSession;
+    friend class LayerProvider;
+
     // ⭐ İKİ AYRI OVERLOAD (açıkça belirt!)
-    Layer sliceAtZ(const mesh::Mesh& mesh, float z);
-    Layer sliceAtZ(const ZIndexedMesh& indexedMesh, float z);  // ← Forward declaration yeterli
+    // Segmentleri arena'nın sonuna ekler, eklenen segment sayısını döner
+    size_t sliceAtZ(const mesh::Mesh& mesh, float z, SegmentArena& arena);
+    size_t sliceAtZ(const ZIndexedMesh& indexedMesh, float z, SegmentArena& arena);  // ← Forward declaration yeterli
+
+    /**
+     * @brief Naive kesim, adaylar SoA z dizilerinden seçilir
+     * @param candidates En az triangleCount() elemanlık geçici index tamponu
+     */
+    size_t sliceAtZ(const mesh::Mesh& mesh, const mesh::MeshSoA& soa, float z,
+                    uint32_t* candidates, SegmentArena& arena);
+
+    /**
+     * @brief Kendi arena'sı olan tek layer (plane bazlı cache'ler için)
+     */
+    Layer sliceLayerAtZ(const ZIndexedMesh& indexedMesh, float z,
+                        const ContourOptions& options = ContourOptions());
+
+    /**
+     * @brief Planlanan düzlemleri tek arena'ya kes, boş olmayanları result'a ekle
+     * @param indexedMesh nullptr ise naive kesim
+     * @param soa Naive kesimde verilirse aday seçimi z dizilerinden yapılır
+     */
+    void slicePlanes(const mesh::Mesh& mesh,
+                     const ZIndexedMesh* indexedMesh,
+                     const std::vector<LayerPlane>& planes,
+                     const geometry::Vec3& offset,
+                     const ContourOptions& options,
+                     SlicingResult& result,
+                     const mesh::MeshSoA* soa = nullptr);
+
+    /**
+     * @brief Arena'nın [first, size) aralığındaki layer'ı işlenmiş konturla değiştir
+     *
+     * Segment → kontur → (birleşim) → (sadeleştirme) → segment.
+     * State tutmaz, farklı arena'larla paralel çağrılabilir.
+     *
+     * @return Yeni segment sayısı
+     */
+    static size_t rebuildContours(SegmentArena& arena, size_t first, const ContourOptions& options);
 
     bool intersectTriangleWithPlane(const geometry::Triangle& tri,
                                     float z,
                                     LineSegment& outSegment);
 
     void getBoundsZ(const mesh::Mesh& mesh, float& minZ, float& maxZ);
+    void getBoundsZ(const mesh::MeshSoA& soa, float& minZ, float& maxZ);
+
+    /**
+     * @brief slice() ortak gövdesi; soa nullptr ise AoS yolları
+     */
+    SlicingResult sliceMesh(const mesh::Mesh& mesh, const mesh::MeshSoA* soa,
+                            const SlicingSettings& settings);
+
+    bool validateLayerHeight(const SlicingSettings& settings, SlicingResult& result) const;
+    int computeLayerCount(float minZ, float maxZ, float layerHeight, SlicingResult& result) const;
+
+    /**
+     * @brief Z index bucket yüksekliği (adaptive modda en ince layer)
+     */
+    static float indexBucketHeight(const SlicingSettings& settings);
+
+    /**
+     * @brief Slice düzlemlerini planla (uniform veya adaptive)
+     *
+     * Düzlemler mesh'in lokal koordinatındadır. Adaptive mod index ister.
+     */
+    bool planLayers(const mesh::Mesh& mesh,
+                    const ZIndexedMesh* indexedMesh,
+                    float minZ, float maxZ,
+                    const SlicingSettings& settings,
+                    SlicingResult& result,
+                    std::vector<LayerPlane>& planes) const;
 
     VertexPosition classifyVertex(float vz, float planeZ) const;
 
@@ -0,0 +1,290 @@
+#include "SlicingSession.h"
+#include "ZIndexedMesh.h"
+#include "SlicingConstants.h"
+#include "core/parallel/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace core {
+namespace slicing {
+
+namespace {
+
+// Cache anahtarı çözünürlüğü (mm); farklı layer height'lardan gelen
+// aynı düzlemin float hatasını yutar
+constexpr double PLANE_KEY_QUANTUM = 1e-4;
+
+// Bu kadar slice çağrısı boyunca kullanılmayan düzlemler atılır;
+// iki ayar arasında gidip gelmek cache'i korur
+constexpr uint32_t KEEP_GENERATIONS = 4;
+
+// Paralel kesimde thread başına min düzlem sayısı
+constexpr size_t MIN_PLANES_PER_THREAD = 8;
+
+} // namespace
+
+SlicingSession::SlicingSession(const mesh::Mesh& source, float bucketHeight)
+    : placed_(source)
+    , bucketHeight_(bucketHeight)
+{
+}
+
+SlicingSession::SlicingSession(std::shared_ptr<const mesh::Mesh> source, float bucketHeight)
+    : placed_(std::move(source))
+    , bucketHeight_(bucketHeight)
+{
+}
+
+SlicingSession::SlicingSession(std::shared_ptr<const mesh::Mesh> source,
+                               std::shared_ptr<const mesh::MeshSoA> sourceSoA,
+                               float bucketHeight)
+    : placed_(std::move(source))
+    , bucketHeight_(bucketHeight)
+{
+    placed_.setSourceSoA(std::move(sourceSoA));
+}
+
+void SlicingSession::setTransform(const mesh::ModelTransform& transform)
+{
+    const geometry::Vec3& old = placed_.transform().rotation;
+    const bool rotationChanged = transform.rotation.x != old.x ||
+                                 transform.rotation.y != old.y ||
+                                 transform.rotation.z != old.z;
+
+    placed_.setTransform(transform);
+
+    if (rotationChanged)
+    {
+        clearCache();
+    }
+}
+
+SlicingResult SlicingSession::slice(const SlicingSettings& settings)
+{
+    SlicingResult result;
+    lastStats_ = Stats{};
+    ++generation_;
+
+    std::vector<LayerPlane> planes;
+    if (!planPlanes(settings, result, planes))
+    {
+        return result;
+    }
+
+    // Farklı işlenmiş (birleşik, sadeleşmiş, ham) kesitler aynı cache'te karışmasın
+    const ContourOptions contourOptions(settings);
+    if (contourOptions != contourOptions_)
+    {
+        clearCache();
+        contourOptions_ = contourOptions;
+    }
+
+    const geometry::Vec3 offset = placed_.offset();
+    const ZIndexedMesh& indexedMesh = placed_.index(bucketHeight_);
+
+    // 1. Cache'te olmayan düzlemleri bul
+    std::vector<size_t> missing;
+    for (size_t i = 0; i < planes.size(); ++i)
+    {
+        auto it = cache_.find(planeKey(planes[i].z));
+        if (it != cache_.end())
+        {
+            it->second.lastUsed = generation_;
+        }
+        else
+        {
+            missing.push_back(i);
+        }
+    }
+
+    // 2. Eksikleri paralel kes (Slicer state tutmaz, index salt okunur)
+    std::vector<Layer> fresh(missing.size());
+    parallel::parallelFor(0, missing.size(), MIN_PLANES_PER_THREAD,
+                          [&](size_t begin, size_t end) {
+                              Slicer slicer;
+                              for (size_t m = begin; m < end; ++m)
+                              {
+                                  fresh[m] = slicer.sliceLayerAtZ(indexedMesh, planes[missing[m]].z,
+                                                                 contourOptions);
+                              }
+                          });
+
+    for (size_t m = 0; m < missing.size(); ++m)
+    {
+        // Boş kesitler de cache'lenir, tekrar denenmesin
+        CachedLayer& entry = cache_[planeKey(planes[missing[m]].z)];
+        entry.layer = std::move(fresh[m]);
+        entry.lastUsed = generation_;
+    }
+
+    // 3. Boş olmayan kesitleri sırayla dünya koordinatına taşı.
+    // Layer'lar arena görünümü: segmentler kopyalanmaz, cache ile paylaşılır
+    result.layers.reserve(planes.size());
+    for (const auto& plane : planes)
+    {
+        const Layer& cached = cache_.find(planeKey(plane.z))->second.layer;
+        if (cached.isEmpty())
+        {
+            continue;
+        }
+
+        Layer layer = cached;
+        layer.setZHeight(plane.z);
+        layer.setThickness(plane.thickness);
+        layer.translate(offset);
+        result.totalSegments += static_cast<int>(layer.segmentCount());
+        result.rawSegments += static_cast<int>(layer.rawSegmentCount());
+        result.layers.push_back(std::move(layer));
+    }
+
+    lastStats_.planesTotal = planes.size();
+    lastStats_.planesSliced = missing.size();
+    lastStats_.planesReused = planes.size() - missing.size();
+
+    evictStale();
+    lastStats_.cachedPlanes = cache_.size();
+
+    if (result.layers.empty())
+    {
+        result.error = SlicingError::NoIntersections;
+        result.errorMessage = "No intersections found";
+    }
+    else
+    {
+        result.error = SlicingError::Success;
+    }
+
+    return result;
+}
+
+bool SlicingSession::planPlanes(const SlicingSettings& settings,
+                                SlicingResult& result,
+                                std::vector<LayerPlane>& planes)
+{
+    const mesh::Mesh& oriented = placed_.orientedMesh();
+
+    if (oriented.triangles.empty())
+    {
+        result.error = SlicingError::EmptyMesh;
+        result.errorMessage = "Mesh contains no triangles";
+        return false;
+    }
+
+    if (!slicer_.validateLayerHeight(settings, result))
+    {
+        return false;
+    }
+
+    const geometry::Vec3 offset = placed_.offset();
+
+    // SoA görünümü rotasyon değişene kadar saklanır: Z sınırları ve index
+    // kurulumu sadece z dizilerini tarar
+    placed_.orientedSoA();
+
+    // Düzlem ızgarası her zaman mesh tabanından başlar (lokal)
+    float baseMinZ, baseMaxZ;
+    placed_.localBoundsZ(baseMinZ, baseMaxZ);
+
+    if (baseMaxZ <= baseMinZ + EPSILON)
+    {
+        result.error = SlicingError::InvalidBounds;
+        result.errorMessage = "Mesh has zero or negative height";
+        return false;
+    }
+
+    // Kırpma aralığı (dünya → lokal)
+    float clipMinZ = baseMinZ;
+    float clipMaxZ = baseMaxZ;
+    if (settings.maxZ > settings.minZ + EPSILON)
+    {
+        clipMinZ = std::max(baseMinZ, settings.minZ - offset.z);
+        clipMaxZ = std::min(baseMaxZ, settings.maxZ - offset.z);
+
+        if (clipMaxZ <= clipMinZ + EPSILON)
+        {
+            result.error = SlicingError::InvalidBounds;
+            result.errorMessage = "Slicing range does not overlap the mesh";
+            return false;
+        }
+    }
+
+    result.layerHeight = settings.layerHeight;
+    result.adaptiveLayers = settings.adaptiveLayers;
+    result.totalHeight = clipMaxZ - clipMinZ;
+
+    const ZIndexedMesh& indexedMesh = placed_.index(bucketHeight_);
+
+    if (!slicer_.planLayers(oriented, &indexedMesh, baseMinZ, baseMaxZ, settings, result, planes))
+    {
+        return false;
+    }
+
+    // Kırpılan aralık dışındaki düzlemleri at
+    planes.erase(std::remove_if(planes.begin(), planes.end(),
+                                [&](const LayerPlane& plane) {
+                                    return plane.z < clipMinZ - EPSILON ||
+                                           plane.z >= clipMaxZ - EPSILON;
+                                }),
+                 planes.end());
+
+    if (planes.empty())
+    {
+        result.error = SlicingError::InvalidBounds;
+        result.errorMessage = "No layer planes in slicing range";
+        return false;
+    }
+
+    return true;
+}
+
+std::unique_ptr<LayerProvider> SlicingSession::createLayerProvider(const SlicingSettings& settings,
+                                                                  SlicingResult& status,
+                                                                  const LayerProvider::Options& options,
+                                                                  LayerProvider::CompletionCallback onComplete)
+{
+    std::vector<LayerPlane> planes;
+    if (!planPlanes(settings, status, planes))
+    {
+        return nullptr;
+    }
+
+    status.error = SlicingError::Success;
+
+    // Sağlayıcı index'i ve rotasyonlu kopyayı paylaşır; oturum sonra
+    // rotasyonu değiştirse de sağlayıcının gördüğü geometri sabit kalır
+    return std::make_unique<LayerProvider>(placed_.sharedIndex(bucketHeight_),
+                                           placed_.sharedOrientedMesh(),
+                                           std::move(planes),
+                                           placed_.offset(),
+                                           settings,
+                                           options,
+                                           std::move(onComplete));
+}
+
+void SlicingSession::clearCache()
+{
+    cache_.clear();
+}
+
+int64_t SlicingSession::planeKey(float z)
+{
+    return static_cast<int64_t>(std::llround(static_cast<double>(z) / PLANE_KEY_QUANTUM));
+}
+
+void SlicingSession::evictStale()
+{
+    for (auto it = cache_.begin(); it != cache_.end();)
+    {
+        if (it->second.lastUsed + KEEP_GENERATIONS <= generation_)
+        {
+            it = cache_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+} // namespace slicing
+} // namespace core
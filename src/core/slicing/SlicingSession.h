@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Slicer.h"
+#include "PlacedMesh.h"
+#include "LayerProvider.h"
+#include "core/mesh/MeshTransform.h"
+#include <cstdint>
+#include <unordered_map>
+
+namespace core {
+namespace slicing {
+
+/**
+ * @brief Ayar değişikliklerinde sadece değişen düzlemleri yeniden kesen oturum
+ *
+ * Mesh yüklendikten sonra bir kez oluşturulur ve index ile kesilmiş
+ * düzlemleri tutar:
+ *
+ * - Z index sabit bucket yüksekliği ile kurulur, layer height değişince
+ *   yeniden kurulmaz (sadece rotasyon değişince).
+ * - Kesitler lokal Z'ye göre cache'lenir. Layer height değişince sadece
+ *   yeni düzlemler kesilir (ör. 0.2 → 0.1'de her iki düzlemden biri hazır).
+ * - Düzlemler mesh tabanına hizalı bir ızgaradadır; minZ/maxZ kırpması
+ *   ızgarayı kaydırmaz, kırpılan aralıktaki düzlemler cache'ten gelir.
+ * - Translation cache'i bozmaz, çıktıda kaydırma olarak uygulanır.
+ *
+ * Referansla verilen kaynak mesh oturumdan uzun yaşamalı ve değişmemelidir
+ * (shared_ptr overload'ı sahipliği paylaşır).
+ */
+class SlicingSession
+{
+public:
+    static constexpr float DEFAULT_BUCKET_HEIGHT = 0.1f;   // mm
+
+    explicit SlicingSession(const mesh::Mesh& source,
+                            float bucketHeight = DEFAULT_BUCKET_HEIGHT);
+
+    /**
+     * @brief Paylaşımlı kaynak; lazy sağlayıcılar da mesh'i canlı tutar
+     */
+    explicit SlicingSession(std::shared_ptr<const mesh::Mesh> source,
+                            float bucketHeight = DEFAULT_BUCKET_HEIGHT);
+
+    /**
+     * @brief Paylaşımlı kaynak ve önceden kurulmuş SoA görünümü
+     *
+     * Rotasyon yokken index ve Z sınırları görünümden okunur, yeniden kurulmaz.
+     */
+    SlicingSession(std::shared_ptr<const mesh::Mesh> source,
+                   std::shared_ptr<const mesh::MeshSoA> sourceSoA,
+                   float bucketHeight = DEFAULT_BUCKET_HEIGHT);
+
+    /**
+     * @brief Yerleşimi güncelle, rotasyon değiştiyse cache temizlenir
+     */
+    void setTransform(const mesh::ModelTransform& transform);
+
+    /**
+     * @brief Ayarlara göre slice et, cache'teki düzlemleri tekrar kullan
+     *
+     * Layer'lar dünya koordinatında döner (Slicer::slice(PlacedMesh&) ile aynı).
+     * settings.useSpatialIndex yok sayılır, oturum her zaman index kullanır.
+     */
+    SlicingResult slice(const SlicingSettings& settings);
+
+    /**
+     * @brief Aynı düzlemler için lazy sağlayıcı oluştur
+     *
+     * Layer'lar talep edildikçe kesilir, tam slicing arka planda sürer.
+     * Oturumun plane cache'ini kullanmaz ve doldurmaz.
+     *
+     * @param status Hata durumunda doldurulur (başarıda Success)
+     * @return Planlama başarısızsa nullptr
+     */
+    std::unique_ptr<LayerProvider> createLayerProvider(const SlicingSettings& settings,
+                                                       SlicingResult& status,
+                                                       const LayerProvider::Options& options = {},
+                                                       LayerProvider::CompletionCallback onComplete = nullptr);
+
+    /**
+     * @brief Son slice çağrısının istatistikleri
+     */
+    struct Stats
+    {
+        size_t planesTotal = 0;     // İstenen düzlem sayısı
+        size_t planesReused = 0;    // Cache'ten gelen
+        size_t planesSliced = 0;    // Yeni kesilen
+        size_t cachedPlanes = 0;    // Çağrı sonunda cache boyutu
+    };
+
+    const Stats& lastStats() const { return lastStats_; }
+
+    const PlacedMesh& placedMesh() const { return placed_; }
+
+    /**
+     * @brief Tüm kesit cache'ini boşalt (index korunur)
+     */
+    void clearCache();
+
+private:
+    struct CachedLayer
+    {
+        Layer layer;                // Lokal koordinatta kesit
+        uint32_t lastUsed = 0;      // Son kullanıldığı slice çağrısı
+    };
+
+    PlacedMesh placed_;
+    float bucketHeight_;
+    Slicer slicer_;
+
+    // Quantize edilmiş lokal Z → kesit
+    std::unordered_map<int64_t, CachedLayer> cache_;
+    uint32_t generation_ = 0;
+    ContourOptions contourOptions_;     // Cache'teki kesitlere uygulanan işlemler
+
+    Stats lastStats_;
+
+    /**
+     * @brief Doğrulama + lokal, kırpılmış düzlem planı (result alanlarını doldurur)
+     */
+    bool planPlanes(const SlicingSettings& settings,
+                    SlicingResult& result,
+                    std::vector<LayerPlane>& planes);
+
+    static int64_t planeKey(float z);
+    void evictStale();
+};
+
+} // namespace slicing
+} // namespace core
@@ -0,0 +1,225 @@
+#include "SupportAnalyzer.h"
+#include "ContourBuilder.h"
+#include "SlicingConstants.h"
+#include "core/geometry/kernels.h"
+#include "core/polygon/PolygonOffset.h"
+#include "core/polygon/PolygonUnion.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace core {
+namespace slicing {
+
+namespace {
+
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+constexpr size_t MIN_TRIANGLES_PER_CHUNK = 16384;
+
+// Sarkma açısı 90°'ye yaklaştıkça tan() patlar; pay bununla sınırlı
+constexpr float MAX_OVERHANG_ANGLE = 89.0f;
+
+// Düzlem aralığı layer kalınlığının bu katını aşarsa arada boş layer var
+constexpr float GAP_FACTOR = 1.5f;
+
+} // namespace
+
+double LayerSupport::areaMm2() const
+{
+    double area = 0.0;
+    for (const polygon::Polygon& ring : overhang)
+    {
+        area += static_cast<double>(polygon::signedArea2(ring));
+    }
+    return area / (2.0 * polygon::UNITS_PER_MM * polygon::UNITS_PER_MM);
+}
+
+SupportAnalyzer::SupportAnalyzer(const mesh::Mesh& mesh, const ZIndexedMesh& index,
+                                 const SupportSettings& settings,
+                                 parallel::ThreadPool& pool)
+    : m_base(mesh.triangles.data())
+    , m_index(index)
+    , m_settings(settings)
+    , m_pool(pool)
+{
+    const size_t count = mesh.triangles.size();
+    m_overhang.assign(count, 0);
+
+    const float angle = std::clamp(m_settings.overhangAngle, 0.0f, MAX_OVERHANG_ANGLE);
+    const float minDown = static_cast<float>(std::sin(angle * DEG_TO_RAD));
+
+    // Kayıtlı normaller bozuk olabilir, geometrik normal kullan (SIMD kernel)
+    std::vector<size_t> chunkCounts((count + MIN_TRIANGLES_PER_CHUNK - 1) / MIN_TRIANGLES_PER_CHUNK, 0);
+    m_pool.parallelFor(0, chunkCounts.size(), 1, [&](size_t begin, size_t end) {
+        std::vector<geometry::Vec3> normals(MIN_TRIANGLES_PER_CHUNK);
+        std::vector<float> areas(MIN_TRIANGLES_PER_CHUNK);
+
+        for (size_t c = begin; c < end; ++c)
+        {
+            const size_t first = c * MIN_TRIANGLES_PER_CHUNK;
+            const size_t n = std::min(MIN_TRIANGLES_PER_CHUNK, count - first);
+            geometry::kernels::computeNormalsAndAreas(m_base + first, n,
+                                                      normals.data(), areas.data());
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                // Dejenere triangle yüzey oluşturmaz
+                if (areas[i] > EPSILON_SQ && -normals[i].z > minDown)
+                {
+                    m_overhang[first + i] = 1;
+                    chunkCounts[c]++;
+                }
+            }
+        }
+    });
+
+    for (size_t n : chunkCounts)
+    {
+        m_overhangCount += n;
+    }
+}
+
+SupportResult SupportAnalyzer::analyze(const SlicingResult& slices, float offsetZ) const
+{
+    SupportResult result;
+    result.overhangTriangles = m_overhangCount;
+
+    if (m_settings.overhangAngle < 0.0f || m_settings.overhangAngle >= 90.0f)
+    {
+        result.errorMessage = "Overhang angle must be in [0, 90) degrees";
+        return result;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    const std::vector<Layer>& layers = slices.layers;
+    const size_t count = layers.size();
+    result.layers.resize(count);
+
+    // 1. Hangi layer'ların altında sarkan yüzey var (ucuz, triangle bazlı)
+    std::vector<char> check(count, 0);
+    std::vector<char> floating(count, 0);
+    std::vector<char> needArea(count, 0);
+
+    for (size_t i = 1; i < count; ++i)
+    {
+        const Layer& below = layers[i - 1];
+        const Layer& layer = layers[i];
+
+        result.layers[i].z = layer.zHeight();
+        result.layers[i].thickness = layer.thickness();
+
+        floating[i] = layer.zHeight() - below.zHeight() > below.thickness() * GAP_FACTOR;
+        check[i] = floating[i] || hasOverhangInBand(below.zHeight() - offsetZ,
+                                                    layer.zHeight() - offsetZ);
+        if (check[i])
+        {
+            needArea[i] = 1;
+            needArea[i - 1] |= !floating[i];
+            result.checkedLayers++;
+        }
+    }
+    if (count > 0)
+    {
+        result.layers[0].z = layers[0].zHeight();
+        result.layers[0].thickness = layers[0].thickness();
+    }
+
+    // 2. Gereken layer alanları (birleşik kontur)
+    std::vector<polygon::Polygons> areas(count);
+    m_pool.parallelFor(0, count, 1, [&](size_t begin, size_t end) {
+        ContourBuilder builder;
+        polygon::PolygonUnion polygonUnion;
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (needArea[i])
+            {
+                areas[i] = polygonUnion.unite(builder.build(layers[i].segments()));
+            }
+        }
+    });
+
+    // 3. Fark: alttaki alanın (kendini taşıyan payla büyütülmüş) dışında kalanlar
+    const double angle = std::min(m_settings.overhangAngle, MAX_OVERHANG_ANGLE) * DEG_TO_RAD;
+    const double minArea2 = 2.0 * m_settings.minAreaMm2 * polygon::UNITS_PER_MM * polygon::UNITS_PER_MM;
+
+    m_pool.parallelFor(1, std::max<size_t>(count, 1), 1, [&](size_t begin, size_t end) {
+        polygon::PolygonOffset offsetter;
+        polygon::PolygonUnion polygonUnion;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!check[i])
+            {
+                continue;
+            }
+
+            polygon::Polygons supported;
+            if (!floating[i])
+            {
+                const int64_t reach = polygon::toFixed(
+                    static_cast<float>(layers[i].thickness() * std::tan(angle)));
+                supported = offsetter.offset(areas[i - 1], reach);
+            }
+
+            polygon::Polygons overhang = polygonUnion.difference(areas[i], supported);
+
+            overhang.erase(std::remove_if(overhang.begin(), overhang.end(),
+                                          [minArea2](const polygon::Polygon& ring) {
+                                              return std::fabs(static_cast<double>(
+                                                         polygon::signedArea2(ring))) < minArea2;
+                                          }),
+                           overhang.end());
+
+            result.layers[i].overhang = std::move(overhang);
+        }
+    });
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    for (const LayerSupport& layer : result.layers)
+    {
+        if (!layer.overhang.empty())
+        {
+            result.supportedLayers++;
+            result.totalAreaMm2 += layer.areaMm2();
+        }
+    }
+
+    return result;
+}
+
+bool SupportAnalyzer::hasOverhangInBand(float z0, float z1) const
+{
+    if (m_overhangCount == 0 || m_index.bucketCount() <= 0)
+    {
+        return false;
+    }
+
+    const int b0 = std::max(0, m_index.getBucketIndex(z0));
+    const int b1 = std::min(m_index.bucketCount() - 1, m_index.getBucketIndex(z1));
+
+    for (int b = b0; b <= b1; ++b)
+    {
+        for (const geometry::Triangle* tri : m_index.getBucket(b))
+        {
+            if (!m_overhang[static_cast<size_t>(tri - m_base)])
+            {
+                continue;
+            }
+
+            const float triMinZ = std::min({tri->vertex1.z, tri->vertex2.z, tri->vertex3.z});
+            const float triMaxZ = std::max({tri->vertex1.z, tri->vertex2.z, tri->vertex3.z});
+            if (triMinZ <= z1 && triMaxZ >= z0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+} // namespace slicing
+} // namespace core
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Slicer.h"
+#include "ZIndexedMesh.h"
+#include "core/mesh/mesh.h"
+#include "core/polygon/IntPoint.h"
+#include "core/parallel/ThreadPool.h"
+#include <string>
+#include <vector>
+
+namespace core {
+namespace slicing {
+
+struct SupportSettings
+{
+    float overhangAngle = 45.0f;    // derece, dikeyden; daha yatık aşağı bakan yüzey desteklenir
+    float minAreaMm2 = 0.1f;        // Bundan küçük bölgeler (eğri yüzey kırıntıları) atılır
+};
+
+/**
+ * @brief Tek layer'ın altında destek gereken bölge (fixed-point, µm)
+ */
+struct LayerSupport
+{
+    float z = 0.0f;
+    float thickness = 0.0f;
+    polygon::Polygons overhang;     // Dış kontur CCW, delik CW
+
+    double areaMm2() const;
+};
+
+struct SupportResult
+{
+    std::vector<LayerSupport> layers;       // Slicing layer'ları ile aynı sıra
+
+    size_t overhangTriangles = 0;           // Eşiği aşan aşağı bakan triangle
+    size_t checkedLayers = 0;               // Altında overhang triangle olan (fark alınan)
+    size_t supportedLayers = 0;             // Destek bölgesi boş olmayan
+    double totalAreaMm2 = 0.0;
+    double elapsedMs = 0.0;
+
+    std::string errorMessage;
+
+    bool success() const { return errorMessage.empty(); }
+};
+
+/**
+ * @brief Overhang (sarkma) ve destek bölgesi analizi
+ *
+ * İki aşama:
+ *
+ * 1. Triangle'lar geometrik normalleriyle (SIMD kernel) işaretlenir:
+ *    aşağı bakan ve dikeyle açısı overhangAngle'ı aşan yüzeyler
+ *    (-nz > sin(açı)). Yatay tavanlar da dahildir.
+ *
+ * 2. Layer i ile i-1 arasındaki bantta, ZIndexedMesh bucket'larına göre
+ *    işaretli triangle varsa layer alanı alttakine göre farklanır:
+ *
+ *      destek(i) = alan(i) - offset(alan(i-1), h * tan(açı))
+ *
+ *    Offset, eşik açısından dik yamaçların kendi kendini taşıdığı payı
+ *    verir. İşaretli triangle olmayan layer'lar polygon işlemine hiç
+ *    girmez; fark sadece gereken layer'larda ve paralel hesaplanır.
+ *
+ * İlk layer tablaya oturur, desteklenmez. Aradaki düzlemler boşsa
+ * (havada başlayan parça) alttaki alan boş kabul edilir.
+ * Destek yapısının kendisi (sütunlar, arayüz katmanı) bu sınıfın işi değildir.
+ */
+class SupportAnalyzer
+{
+public:
+    /**
+     * @param mesh  Index'in kurulduğu mesh (triangle pointer'ları buna ait)
+     * @param index mesh üzerindeki Z index (lokal koordinat)
+     */
+    SupportAnalyzer(const mesh::Mesh& mesh, const ZIndexedMesh& index,
+                    const SupportSettings& settings,
+                    parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    /**
+     * @brief Layer'lar için destek bölgeleri
+     * @param offsetZ Layer Z'si ile index Z'si arasındaki fark (yerleşim translation'ı)
+     */
+    SupportResult analyze(const SlicingResult& slices, float offsetZ = 0.0f) const;
+
+    /**
+     * @brief Eşiği aşan triangle sayısı
+     */
+    size_t overhangTriangleCount() const { return m_overhangCount; }
+
+private:
+    const geometry::Triangle* m_base;
+    const ZIndexedMesh& m_index;
+    SupportSettings m_settings;
+    parallel::ThreadPool& m_pool;
+
+    std::vector<char> m_overhang;           // Triangle index → eşiği aşıyor mu
+    size_t m_overhangCount = 0;
+
+    /**
+     * @brief (z0, z1] bandını kesen işaretli triangle var mı (lokal Z)
+     */
+    bool hasOverhangInBand(float z0, float z1) const;
+};
+
+} // namespace slicing
+} // namespace core
@@ -1,5 +1,6 @@
 #include "ZIndexedMesh.h"
 #include "SlicingConstants.h"
+#include "core/geometry/kernels.h"
 #include <algorithm>
 #include <limits>
 
@@ -16,12 +17,11 @@ ZIndexedMesh::ZIndexedMesh(const mesh::Mesh& mesh, float bucketHeight)
         return;
     }
 
-    // 1. Z sınırlarını bul
-    for (const auto& tri : mesh.triangles)
-    {
-        m_minZ = std::min({m_minZ, tri.vertex1.z, tri.vertex2.z, tri.vertex3.z});
-        m_maxZ = std::max({m_maxZ, tri.vertex1.z, tri.vertex2.z, tri.vertex3.z});
-    }
+    // 1. Z sınırlarını bul (SIMD kernel)
+    const geometry::AABB bounds = geometry::kernels::computeBounds(mesh.triangles.data(),
+                                                                   mesh.triangles.size());
+    m_minZ = bounds.min.z;
+    m_maxZ = bounds.max.z;
 
     // 2. Her triangle'ı ilgili bucket'lara ekle
     for (const auto& tri : mesh.triangles)
@@ -43,22 +43,61 @@ ZIndexedMesh::ZIndexedMesh(const mesh::Mesh& mesh, float bucketHeight)
     }
 }
 
-std::vector<const geometry::Triangle*> ZIndexedMesh::getTrianglesAtZ(float z) const
+ZIndexedMesh::ZIndexedMesh(const mesh::Mesh& mesh, const mesh::MeshSoA& soa, float bucketHeight)
+    : m_bucketHeight(bucketHeight)
+    , m_minZ(std::numeric_limits<float>::max())
+    , m_maxZ(std::numeric_limits<float>::lowest())
 {
-    if (z < m_minZ - EPSILON || z > m_maxZ + EPSILON)
+    if (mesh.triangles.empty() || bucketHeight <= 0.0f || soa.triangleCount() != mesh.triangles.size())
     {
-        return {};
+        return;
     }
 
-    int bucketIdx = getBucketIndex(z);
+    // 1. Triangle başına Z aralığı (sadece z dizileri okunur)
+    const size_t count = soa.triangleCount();
+    std::vector<float> triMin(count), triMax(count);
+    geometry::kernels::triangleRangesZ(soa.arrays(), triMin.data(), triMax.data());
 
-    auto it = m_buckets.find(bucketIdx);
-    if (it != m_buckets.end())
+    // 2. Z sınırları aralıkların uçlarıdır
+    float unused;
+    geometry::kernels::minMax(triMin.data(), count, m_minZ, unused);
+    geometry::kernels::minMax(triMax.data(), count, unused, m_maxZ);
+
+    // 3. Her triangle'ı ilgili bucket'lara ekle
+    for (size_t i = 0; i < count; ++i)
+    {
+        insert(mesh.triangles[i], triMin[i], triMax[i]);
+    }
+
+    for (auto& [bucket, triangles] : m_buckets)
+    {
+        triangles.shrink_to_fit();
+    }
+}
+
+const std::vector<const geometry::Triangle*>& ZIndexedMesh::getTrianglesAtZ(float z) const
+{
+    static const std::vector<const geometry::Triangle*> empty;
+
+    if (z < m_minZ - EPSILON || z > m_maxZ + EPSILON)
     {
-        return it->second;
+        return empty;
     }
 
-    return {};
+    return getBucket(getBucketIndex(z));
+}
+
+int ZIndexedMesh::bucketCount() const
+{
+    return m_buckets.empty() ? 0 : m_buckets.rbegin()->first + 1;
+}
+
+const std::vector<const geometry::Triangle*>& ZIndexedMesh::getBucket(int bucketIdx) const
+{
+    static const std::vector<const geometry::Triangle*> empty;
+
+    auto it = m_buckets.find(bucketIdx);
+    return it != m_buckets.end() ? it->second : empty;
 }
 
 int ZIndexedMesh::getBucketIndex(float z) const
@@ -81,6 +120,17 @@ void ZIndexedMesh::getTriangleBucketRange(const geometry::Triangle& tri,
     maxBucket = getBucketIndex(triMaxZ);
 }
 
+void ZIndexedMesh::insert(const geometry::Triangle& tri, float triMinZ, float triMaxZ)
+{
+    const int minBucket = getBucketIndex(triMinZ);
+    const int maxBucket = getBucketIndex(triMaxZ);
+
+    for (int b = minBucket; b <= maxBucket; ++b)
+    {
+        m_buckets[b].push_back(&tri);
+    }
+}
+
 ZIndexedMesh::Stats ZIndexedMesh::getStats() const
 {
     Stats stats;
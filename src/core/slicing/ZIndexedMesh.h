@@ -2,6 +2,7 @@
 
 #include "core/geometry/triangle.h"
 #include "core/mesh/mesh.h"
+#include "core/mesh/MeshSoA.h"
 #include <vector>
 #include <map>
 #include <cmath>
@@ -30,12 +31,40 @@ public:
      */
     ZIndexedMesh(const mesh::Mesh& mesh, float bucketHeight);
 
+    /**
+     * @brief Constructor - Z sınırları ve triangle Z aralıkları SoA görünümden
+     *
+     * Sadece z dizileri okunur; bucket'lar yine mesh.triangles'a işaret eder.
+     * @param soa mesh'ten oluşturulmuş görünüm (aynı triangle sırası)
+     */
+    ZIndexedMesh(const mesh::Mesh& mesh, const mesh::MeshSoA& soa, float bucketHeight);
+
     /**
      * @brief Belirli bir Z seviyesindeki triangle'ları getir
      * @param z Z koordinatı
-     * @return İlgili triangle'lara pointer vector
+     * @return İlgili triangle'lara pointer vector (kopyasız, index yaşadıkça geçerli)
+     */
+    const std::vector<const geometry::Triangle*>& getTrianglesAtZ(float z) const;
+
+    /**
+     * @brief Bucket sayısı (0 .. bucketCount()-1)
      */
-    std::vector<const geometry::Triangle*> getTrianglesAtZ(float z) const;
+    int bucketCount() const;
+
+    /**
+     * @brief Tek bir bucket'taki triangle'lar (kopyasız)
+     * @param bucketIdx Bucket index, aralık dışıysa boş liste
+     */
+    const std::vector<const geometry::Triangle*>& getBucket(int bucketIdx) const;
+
+    float bucketHeight() const { return m_bucketHeight; }
+    float minZ() const { return m_minZ; }
+    float maxZ() const { return m_maxZ; }
+
+    /**
+     * @brief Z koordinatını bucket index'e çevir
+     */
+    int getBucketIndex(float z) const;
 
     /**
      * @brief İstatistikler
@@ -60,17 +89,17 @@ private:
     // Bucket index → Triangle pointers
     std::map<int, std::vector<const geometry::Triangle*>> m_buckets;
 
-    /**
-     * @brief Z koordinatını bucket index'e çevir
-     */
-    int getBucketIndex(float z) const;
-
     /**
      * @brief Triangle'ın kapsadığı bucket aralığını bul
      */
     void getTriangleBucketRange(const geometry::Triangle& tri,
                                 int& minBucket,
                                 int& maxBucket) const;
+
+    /**
+     * @brief Triangle'ı [triMinZ, triMaxZ] aralığının bucket'larına ekle
+     */
+    void insert(const geometry::Triangle& tri, float triMinZ, float triMaxZ);
 };
 
 } // namespace slicing
@@ -1,15 +1,37 @@
 #include "Slicer.h"
 #include "ZIndexedMesh.h"
+#include "PlacedMesh.h"
+#include "AdaptiveLayerPlanner.h"
+#include "ContourBuilder.h"
 #include "SlicingConstants.h"
+#include "core/geometry/kernels.h"
+#include "core/polygon/PolygonUnion.h"
+#include "core/polygon/PolygonSimplifier.h"
+#include "core/parallel/ParallelFor.h"
 #include <cmath>
 #include <algorithm>
 #include <array>
+#include <limits>
+#include <memory>
 
 
 namespace core {
 namespace slicing {
 
 SlicingResult Slicer::slice(const mesh::Mesh& mesh, const SlicingSettings& settings)
+{
+    return sliceMesh(mesh, nullptr, settings);
+}
+
+SlicingResult Slicer::slice(const mesh::Mesh& mesh, const mesh::MeshSoA& soa,
+                            const SlicingSettings& settings)
+{
+    // Farklı bir mesh'in görünümü verilirse AoS yoluna düş
+    return sliceMesh(mesh, soa.triangleCount() == mesh.triangles.size() ? &soa : nullptr, settings);
+}
+
+SlicingResult Slicer::sliceMesh(const mesh::Mesh& mesh, const mesh::MeshSoA* soa,
+                                const SlicingSettings& settings)
 {
     SlicingResult result;
 
@@ -21,13 +43,8 @@ SlicingResult Slicer::slice(const mesh::Mesh& mesh, const SlicingSettings& setti
         return result;
     }
 
-    if (settings.layerHeight < MIN_LAYER_HEIGHT ||
-        settings.layerHeight > MAX_LAYER_HEIGHT)
+    if (!validateLayerHeight(settings, result))
     {
-        result.error = SlicingError::InvalidLayerHeight;
-        result.errorMessage = "Layer height must be between " +
-                              std::to_string(MIN_LAYER_HEIGHT) + " and " +
-                              std::to_string(MAX_LAYER_HEIGHT) + " mm";
         return result;
     }
 
@@ -36,7 +53,14 @@ SlicingResult Slicer::slice(const mesh::Mesh& mesh, const SlicingSettings& setti
 
     if (maxZ <= minZ + EPSILON)
     {
-        getBoundsZ(mesh, minZ, maxZ);
+        if (soa)
+        {
+            getBoundsZ(*soa, minZ, maxZ);
+        }
+        else
+        {
+            getBoundsZ(mesh, minZ, maxZ);
+        }
 
         if (maxZ <= minZ + EPSILON)
         {
@@ -47,56 +71,186 @@ SlicingResult Slicer::slice(const mesh::Mesh& mesh, const SlicingSettings& setti
     }
 
     result.layerHeight = settings.layerHeight;
+    result.adaptiveLayers = settings.adaptiveLayers;
     result.totalHeight = maxZ - minZ;
 
-    int layerCount = static_cast<int>(std::ceil((maxZ - minZ) / settings.layerHeight));
+    // Adaptive planlama eğim profilini index'ten okur
+    std::unique_ptr<ZIndexedMesh> indexedMesh;
+    if (settings.useSpatialIndex || settings.adaptiveLayers)
+    {
+        indexedMesh = soa ? std::make_unique<ZIndexedMesh>(mesh, *soa, indexBucketHeight(settings))
+                          : std::make_unique<ZIndexedMesh>(mesh, indexBucketHeight(settings));
+    }
 
-    if (layerCount <= 0)
+    std::vector<LayerPlane> planes;
+    if (!planLayers(mesh, indexedMesh.get(), minZ, maxZ, settings, result, planes))
     {
-        result.error = SlicingError::InvalidBounds;
-        result.errorMessage = "Calculated layer count is zero or negative";
         return result;
     }
 
-    if (layerCount > MAX_LAYER_COUNT)
+    // Spatial indexing (SESLİ DEĞİL - SADECE ÇALIŞIR!)
+    slicePlanes(mesh, settings.useSpatialIndex ? indexedMesh.get() : nullptr,
+                planes, geometry::Vec3(0.0f, 0.0f, 0.0f), ContourOptions(settings), result, soa);
+
+    return result;
+}
+
+SlicingResult Slicer::slice(PlacedMesh& placed, const SlicingSettings& settings)
+{
+    SlicingResult result;
+
+    const mesh::Mesh& oriented = placed.orientedMesh();
+
+    if (oriented.triangles.empty())
     {
-        result.error = SlicingError::TooManyLayers;
-        result.errorMessage = "Layer count exceeds maximum";
+        result.error = SlicingError::EmptyMesh;
+        result.errorMessage = "Mesh contains no triangles";
         return result;
     }
 
-    result.layers.reserve(layerCount);
+    if (!validateLayerHeight(settings, result))
+    {
+        return result;
+    }
 
-    // Spatial indexing (SESLİ DEĞİL - SADECE ÇALIŞIR!)
-    if (settings.useSpatialIndex)
+    // Translation geometriye uygulanmaz: Z için plane offset'i,
+    // XY için segment kaydırması kullanılır (index yeniden kurulmaz)
+    const geometry::Vec3 offset = placed.offset();
+
+    float minZ = settings.minZ;
+    float maxZ = settings.maxZ;
+
+    if (maxZ <= minZ + EPSILON)
     {
-        ZIndexedMesh indexedMesh(mesh, settings.layerHeight);
+        placed.localBoundsZ(minZ, maxZ);
+        minZ += offset.z;
+        maxZ += offset.z;
 
-        for (int i = 0; i < layerCount; ++i)
+        if (maxZ <= minZ + EPSILON)
         {
-            float z = minZ + i * settings.layerHeight;
-            Layer layer = sliceAtZ(indexedMesh, z);
+            result.error = SlicingError::InvalidBounds;
+            result.errorMessage = "Mesh has zero or negative height";
+            return result;
+        }
+    }
 
-            if (!layer.isEmpty())
-            {
-                result.layers.push_back(layer);
-                result.totalSegments += static_cast<int>(layer.segmentCount());
-            }
+    result.layerHeight = settings.layerHeight;
+    result.adaptiveLayers = settings.adaptiveLayers;
+    result.totalHeight = maxZ - minZ;
+
+    const ZIndexedMesh* indexedMesh = (settings.useSpatialIndex || settings.adaptiveLayers)
+        ? &placed.index(indexBucketHeight(settings))
+        : nullptr;
+
+    // Düzlemler lokal koordinatta planlanır
+    std::vector<LayerPlane> planes;
+    if (!planLayers(oriented, indexedMesh, minZ - offset.z, maxZ - offset.z,
+                    settings, result, planes))
+    {
+        return result;
+    }
+
+    // Naive kesim tüm triangle'ları düzlem başına tarar: SoA görünümü ile
+    // aday seçimi sadece z dizilerini okur
+    slicePlanes(oriented, settings.useSpatialIndex ? indexedMesh : nullptr,
+                planes, offset, ContourOptions(settings), result,
+                settings.useSpatialIndex ? nullptr : &placed.orientedSoA());
+
+    return result;
+}
+
+void Slicer::slicePlanes(const mesh::Mesh& mesh,
+                         const ZIndexedMesh* indexedMesh,
+                         const std::vector<LayerPlane>& planes,
+                         const geometry::Vec3& offset,
+                         const ContourOptions& options,
+                         SlicingResult& result,
+                         const mesh::MeshSoA* soa)
+{
+    // Tüm layer'lar tek arena'ya yazılır, layer'lar sadece görünüm
+    auto arena = std::make_shared<SegmentArena>();
+
+    // Üst sınır: her triangle düzlem başına en fazla 1 segment üretir.
+    // Böylece arena büyürken yeniden kopyalanmaz.
+    if (indexedMesh)
+    {
+        size_t upperBound = 0;
+        for (const auto& plane : planes)
+        {
+            upperBound += indexedMesh->getTrianglesAtZ(plane.z).size();
         }
+        arena->reserve(upperBound);
     }
-    else
+
+    struct PlaneRange
     {
-        // Naive slicing
-        for (int i = 0; i < layerCount; ++i)
+        const LayerPlane* plane;
+        size_t first;
+        size_t count;
+        size_t rawCount;
+    };
+
+    std::vector<PlaneRange> ranges;
+    ranges.reserve(planes.size());
+
+    const bool useSoA = !indexedMesh && soa && soa->triangleCount() == mesh.triangles.size();
+    std::vector<uint32_t> candidates(useSoA ? soa->triangleCount() : 0);
+
+    for (const auto& plane : planes)
+    {
+        const size_t first = arena->size();
+        const size_t count = indexedMesh ? sliceAtZ(*indexedMesh, plane.z, *arena)
+                           : useSoA      ? sliceAtZ(mesh, *soa, plane.z, candidates.data(), *arena)
+                                         : sliceAtZ(mesh, plane.z, *arena);
+
+        if (count > 0)
         {
-            float z = minZ + i * settings.layerHeight;
-            Layer layer = sliceAtZ(mesh, z);
+            ranges.push_back({&plane, first, count, count});
+        }
+    }
 
-            if (!layer.isEmpty())
+    // Kontur işlemleri layer'lar arası bağımsız: paralel, sonra tek arena'da toplanır
+    if (options.active() && !ranges.empty())
+    {
+        std::vector<SegmentArena> rebuilt(ranges.size());
+        parallel::parallelFor(0, ranges.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t r = begin; r < end; ++r)
             {
-                result.layers.push_back(layer);
-                result.totalSegments += static_cast<int>(layer.segmentCount());
+                rebuilt[r].append(arena->data() + ranges[r].first, ranges[r].count);
+                rebuildContours(rebuilt[r], 0, options);
             }
+        });
+
+        size_t total = 0;
+        for (const auto& local : rebuilt)
+        {
+            total += local.size();
+        }
+
+        auto compact = std::make_shared<SegmentArena>();
+        compact->reserve(total);
+        for (size_t r = 0; r < ranges.size(); ++r)
+        {
+            ranges[r].first = compact->size();
+            ranges[r].count = rebuilt[r].size();
+            compact->append(rebuilt[r].data(), rebuilt[r].size());
+        }
+        arena = std::move(compact);
+    }
+
+    result.layers.reserve(ranges.size());
+
+    for (const auto& range : ranges)
+    {
+        if (range.count > 0)
+        {
+            Layer layer(range.plane->z, arena, range.first, range.count);
+            layer.setThickness(range.plane->thickness);
+            layer.setRawSegmentCount(range.rawCount);
+            layer.translate(offset);
+            result.totalSegments += static_cast<int>(range.count);
+            result.rawSegments += static_cast<int>(range.rawCount);
+            result.layers.push_back(std::move(layer));
         }
     }
 
@@ -109,20 +263,63 @@ SlicingResult Slicer::slice(const mesh::Mesh& mesh, const SlicingSettings& setti
     {
         result.error = SlicingError::Success;
     }
+}
 
-    return result;
+Layer Slicer::sliceLayerAtZ(const ZIndexedMesh& indexedMesh, float z, const ContourOptions& options)
+{
+    // Tek layer'lık arena: plane bazlı cache'ler için tek allocation
+    auto arena = std::make_shared<SegmentArena>();
+    const size_t rawCount = sliceAtZ(indexedMesh, z, *arena);
+    size_t count = rawCount;
+
+    if (options.active() && count > 0)
+    {
+        count = rebuildContours(*arena, 0, options);
+    }
+
+    Layer layer(z, std::move(arena), 0, count);
+    layer.setRawSegmentCount(rawCount);
+    return layer;
 }
 
-// İndexed mesh versiyonu
-Layer Slicer::sliceAtZ(const ZIndexedMesh& indexedMesh, float z)
+size_t Slicer::rebuildContours(SegmentArena& arena, size_t first, const ContourOptions& options)
 {
-    Layer layer(z);
+    // Segment → kontur → tam sayı birleşim → sadeleştirme → tekrar segment
+    ContourBuilder builder;
+    polygon::Polygons contours = builder.build(arena.data() + first, arena.size() - first);
 
-    auto triangles = indexedMesh.getTrianglesAtZ(z);
+    if (options.unionShells)
+    {
+        polygon::PolygonUnion polygonUnion;
+        contours = polygonUnion.unite(contours);
+    }
 
-    // ⭐ PERFORMANS: Kapasite ayarla
-    // Her triangle en fazla 1 segment üretebilir
-    layer.reserve(triangles.size());
+    if (options.simplifyTolerance > 0.0f)
+    {
+        polygon::PolygonSimplifier simplifier(polygon::toFixed(options.simplifyTolerance));
+        contours = simplifier.simplify(contours);
+    }
+
+    arena.truncate(first);
+    for (const auto& ring : contours)
+    {
+        for (size_t i = 0; i < ring.size(); ++i)
+        {
+            const polygon::IntPoint& a = ring[i];
+            const polygon::IntPoint& b = ring[(i + 1) % ring.size()];
+            arena.push_back({{polygon::toMillimeters(a.x), polygon::toMillimeters(a.y)},
+                             {polygon::toMillimeters(b.x), polygon::toMillimeters(b.y)}});
+        }
+    }
+
+    return arena.size() - first;
+}
+
+// İndexed mesh versiyonu
+size_t Slicer::sliceAtZ(const ZIndexedMesh& indexedMesh, float z, SegmentArena& arena)
+{
+    const auto& triangles = indexedMesh.getTrianglesAtZ(z);
+    size_t count = 0;
 
     for (const auto* tri : triangles)
     {
@@ -130,22 +327,19 @@ Layer Slicer::sliceAtZ(const ZIndexedMesh& indexedMesh, float z)
 
         if (intersectTriangleWithPlane(*tri, z, segment))
         {
-            layer.addSegment(segment);
+            arena.push_back({{segment.start.x, segment.start.y},
+                             {segment.end.x, segment.end.y}});
+            ++count;
         }
     }
 
-    return layer;
+    return count;
 }
 
 // Naive mesh versiyonu
-Layer Slicer::sliceAtZ(const mesh::Mesh& mesh, float z)
+size_t Slicer::sliceAtZ(const mesh::Mesh& mesh, float z, SegmentArena& arena)
 {
-    Layer layer(z);
-
-    // ⭐ PERFORMANS: Kapasite ayarla
-    // Worst case: tüm triangle'lar bu layer'ı keser
-    // Ortalama: ~%0.2 (1/500) triangle keser
-    layer.reserve(mesh.triangles.size() / 100);  // Tahmini %1
+    size_t count = 0;
 
     for (const auto& tri : mesh.triangles)
     {
@@ -153,13 +347,38 @@ Layer Slicer::sliceAtZ(const mesh::Mesh& mesh, float z)
 
         if (intersectTriangleWithPlane(tri, z, segment))
         {
-            layer.addSegment(segment);
+            arena.push_back({{segment.start.x, segment.start.y},
+                             {segment.end.x, segment.end.y}});
+            ++count;
         }
     }
 
-    return layer;
+    return count;
 }
 
+// SoA naive versiyonu
+size_t Slicer::sliceAtZ(const mesh::Mesh& mesh, const mesh::MeshSoA& soa, float z,
+                        uint32_t* candidates, SegmentArena& arena)
+{
+    // classifyVertex ile aynı eşik: en az bir köşe Above, en az biri değil
+    const size_t candidateCount =
+        geometry::kernels::selectPlaneCrossings(soa.arrays(), z + EPSILON, candidates);
+    size_t count = 0;
+
+    for (size_t c = 0; c < candidateCount; ++c)
+    {
+        LineSegment segment;
+
+        if (intersectTriangleWithPlane(mesh.triangles[candidates[c]], z, segment))
+        {
+            arena.push_back({{segment.start.x, segment.start.y},
+                             {segment.end.x, segment.end.y}});
+            ++count;
+        }
+    }
+
+    return count;
+}
 
 bool Slicer::intersectTriangleWithPlane(const geometry::Triangle& tri,
                                         float z,
@@ -214,6 +433,21 @@ bool Slicer::intersectTriangleWithPlane(const geometry::Triangle& tri,
 
     if (intersectionCount == 2)
     {
+        // Yön: malzeme segmentin solunda kalsın (dış kontur CCW, delik CW).
+        // Geometrik normalin XY bileşeni dışarıyı, yani sağ tarafı gösterir.
+        const float e1x = v2.x - v1.x, e1y = v2.y - v1.y, e1z = v2.z - v1.z;
+        const float e2x = v3.x - v1.x, e2y = v3.y - v1.y, e2z = v3.z - v1.z;
+        const float nx = e1y * e2z - e1z * e2y;
+        const float ny = e1z * e2x - e1x * e2z;
+
+        const float dx = intersections[1].x - intersections[0].x;
+        const float dy = intersections[1].y - intersections[0].y;
+
+        if (dx * ny - dy * nx > 0.0f)
+        {
+            std::swap(intersections[0], intersections[1]);
+        }
+
         outSegment = LineSegment(intersections[0], intersections[1]);
         return true;
     }
@@ -269,14 +503,129 @@ bool Slicer::interpolateEdge(const geometry::Vec3& p1,
 
 void Slicer::getBoundsZ(const mesh::Mesh& mesh, float& minZ, float& maxZ)
 {
+    const geometry::AABB bounds = geometry::kernels::computeBounds(mesh.triangles.data(),
+                                                                   mesh.triangles.size());
+    minZ = bounds.min.z;
+    maxZ = bounds.max.z;
+}
+
+void Slicer::getBoundsZ(const mesh::MeshSoA& soa, float& minZ, float& maxZ)
+{
+    // Sadece z dizileri: AoS sınır taramasının 1/4'ü kadar bellek
     minZ = std::numeric_limits<float>::max();
     maxZ = std::numeric_limits<float>::lowest();
 
-    for (const auto& tri : mesh.triangles)
+    for (int corner = 0; corner < 3; ++corner)
+    {
+        float lo, hi;
+        geometry::kernels::minMax(soa.z(corner), soa.triangleCount(), lo, hi);
+        minZ = std::min(minZ, lo);
+        maxZ = std::max(maxZ, hi);
+    }
+}
+
+bool Slicer::validateLayerHeight(const SlicingSettings& settings, SlicingResult& result) const
+{
+    if (settings.layerHeight < MIN_LAYER_HEIGHT ||
+        settings.layerHeight > MAX_LAYER_HEIGHT)
+    {
+        result.error = SlicingError::InvalidLayerHeight;
+        result.errorMessage = "Layer height must be between " +
+                              std::to_string(MIN_LAYER_HEIGHT) + " and " +
+                              std::to_string(MAX_LAYER_HEIGHT) + " mm";
+        return false;
+    }
+
+    if (settings.adaptiveLayers &&
+        (settings.minLayerHeight < MIN_LAYER_HEIGHT ||
+         settings.maxLayerHeight > MAX_LAYER_HEIGHT ||
+         settings.minLayerHeight > settings.maxLayerHeight))
+    {
+        result.error = SlicingError::InvalidLayerHeight;
+        result.errorMessage = "Adaptive layer heights must satisfy " +
+                              std::to_string(MIN_LAYER_HEIGHT) + " <= min <= max <= " +
+                              std::to_string(MAX_LAYER_HEIGHT) + " mm";
+        return false;
+    }
+
+    return true;
+}
+
+int Slicer::computeLayerCount(float minZ, float maxZ, float layerHeight, SlicingResult& result) const
+{
+    int layerCount = static_cast<int>(std::ceil((maxZ - minZ) / layerHeight));
+
+    if (layerCount <= 0)
+    {
+        result.error = SlicingError::InvalidBounds;
+        result.errorMessage = "Calculated layer count is zero or negative";
+        return 0;
+    }
+
+    if (layerCount > MAX_LAYER_COUNT)
     {
-        minZ = std::min({minZ, tri.vertex1.z, tri.vertex2.z, tri.vertex3.z});
-        maxZ = std::max({maxZ, tri.vertex1.z, tri.vertex2.z, tri.vertex3.z});
+        result.error = SlicingError::TooManyLayers;
+        result.errorMessage = "Layer count exceeds maximum";
+        return 0;
     }
+
+    return layerCount;
+}
+
+float Slicer::indexBucketHeight(const SlicingSettings& settings)
+{
+    return settings.adaptiveLayers ? settings.minLayerHeight : settings.layerHeight;
+}
+
+bool Slicer::planLayers(const mesh::Mesh& mesh,
+                        const ZIndexedMesh* indexedMesh,
+                        float minZ, float maxZ,
+                        const SlicingSettings& settings,
+                        SlicingResult& result,
+                        std::vector<LayerPlane>& planes) const
+{
+    planes.clear();
+
+    if (!settings.adaptiveLayers || !indexedMesh)
+    {
+        int layerCount = computeLayerCount(minZ, maxZ, settings.layerHeight, result);
+
+        if (layerCount <= 0)
+        {
+            return false;
+        }
+
+        planes.reserve(layerCount);
+        for (int i = 0; i < layerCount; ++i)
+        {
+            planes.push_back({minZ + i * settings.layerHeight, settings.layerHeight});
+        }
+        return true;
+    }
+
+    // Varsayılan kalite: sabit layerHeight ile en kötü durumdaki sapma
+    const float maxCusp = settings.maxCuspHeight > 0.0f ? settings.maxCuspHeight
+                                                        : settings.layerHeight;
+
+    AdaptiveLayerPlanner planner(mesh, *indexedMesh);
+    planes = planner.plan(minZ, maxZ, settings.minLayerHeight, settings.maxLayerHeight, maxCusp);
+
+    if (planes.empty())
+    {
+        result.error = SlicingError::InvalidBounds;
+        result.errorMessage = "Calculated layer count is zero or negative";
+        return false;
+    }
+
+    if (planes.size() > static_cast<size_t>(MAX_LAYER_COUNT))
+    {
+        result.error = SlicingError::TooManyLayers;
+        result.errorMessage = "Layer count exceeds maximum";
+        planes.clear();
+        return false;
+    }
+
+    return true;
 }
 
 } // namespace slicing
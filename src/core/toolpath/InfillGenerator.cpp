@@ -0,0 +1,247 @@
+#include "InfillGenerator.h"
+#include "core/geometry/kernels.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace core {
+namespace toolpath {
+
+namespace {
+
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+constexpr size_t MIN_LAYERS_PER_CHUNK = 2;
+
+/**
+ * @brief Döndürülmüş çerçevede kenar (alt uç → üst uç)
+ */
+struct ScanEdge
+{
+    int64_t firstLine;  // İlk kesilen tarama çizgisi
+    double x;           // Alt uç
+    double y;
+    double slope;       // dx / dy
+    double top;         // Üst uç y (yarı açık: [y, top))
+};
+
+} // namespace
+
+InfillGenerator::InfillGenerator(const InfillSettings& settings, parallel::ThreadPool& pool)
+    : settings_(settings)
+    , pool_(pool)
+{
+}
+
+InfillResult InfillGenerator::generate(const PerimeterResult& perimeters)
+{
+    InfillResult result;
+
+    if (settings_.density <= 0.0f || settings_.density > 1.0f)
+    {
+        result.errorMessage = "Infill density must be in (0, 1]";
+        return result;
+    }
+
+    if (polygon::toFixed(settings_.lineWidth) < 1)
+    {
+        result.errorMessage = "Infill line width is too small";
+        return result;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    result.layers.resize(perimeters.layers.size());
+    std::vector<size_t> scanlines(perimeters.layers.size(), 0);
+
+    pool_.parallelFor(0, perimeters.layers.size(), MIN_LAYERS_PER_CHUNK,
+                      [&](size_t begin, size_t end) {
+                          for (size_t i = begin; i < end; ++i)
+                          {
+                              LayerInfill& layer = result.layers[i];
+                              layer.z = perimeters.layers[i].z;
+                              layer.thickness = perimeters.layers[i].thickness;
+                              layer.lines = fill(perimeters.layers[i].infillArea, i, &scanlines[i]);
+                          }
+                      });
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    for (size_t i = 0; i < result.layers.size(); ++i)
+    {
+        const LayerInfill& layer = result.layers[i];
+        result.lines += layer.lines.size();
+        result.scanlines += scanlines[i];
+        for (const auto& line : layer.lines)
+        {
+            const double dx = static_cast<double>(line.end.x - line.start.x);
+            const double dy = static_cast<double>(line.end.y - line.start.y);
+            result.totalLengthMm += std::sqrt(dx * dx + dy * dy) / polygon::UNITS_PER_MM;
+        }
+    }
+
+    return result;
+}
+
+std::vector<InfillLine> InfillGenerator::fill(const polygon::Polygons& area, size_t layerIndex,
+                                              size_t* scanlineCount) const
+{
+    std::vector<InfillLine> lines;
+    if (area.empty())
+    {
+        return lines;
+    }
+
+    // Yoğunluk = çizgi genişliği / aralık; grid iki yöne bölüştürür
+    const double width = settings_.lineWidth * polygon::UNITS_PER_MM;
+    double spacing = width / settings_.density;
+    size_t scanlines = 0;
+
+    if (settings_.pattern == InfillPattern::Grid)
+    {
+        spacing *= 2.0;
+        fillDirection(area, settings_.angle, spacing, lines, scanlines);
+        fillDirection(area, settings_.angle + 90.0, spacing, lines, scanlines);
+    }
+    else
+    {
+        const double angle = settings_.angle + (layerIndex % 2 ? 90.0 : 0.0);
+        fillDirection(area, angle, spacing, lines, scanlines);
+    }
+
+    if (scanlineCount)
+    {
+        *scanlineCount = scanlines;
+    }
+    return lines;
+}
+
+void InfillGenerator::fillDirection(const polygon::Polygons& area, double angleDeg, double spacing,
+                                    std::vector<InfillLine>& lines, size_t& scanlines) const
+{
+    const double c = std::cos(angleDeg * DEG_TO_RAD);
+    const double s = std::sin(angleDeg * DEG_TO_RAD);
+
+    // 1. Kenar tablosu: çizgi yönü +x olacak şekilde -angle döndür
+    std::vector<ScanEdge> edges;
+    edges.reserve(polygon::pointCount(area));
+
+    for (const auto& ring : area)
+    {
+        const size_t n = ring.size();
+        for (size_t i = 0; i < n; ++i)
+        {
+            const polygon::IntPoint& p = ring[i];
+            const polygon::IntPoint& q = ring[(i + 1) % n];
+
+            double px = p.x * c + p.y * s, py = -p.x * s + p.y * c;
+            double qx = q.x * c + q.y * s, qy = -q.x * s + q.y * c;
+
+            if (py == qy)
+            {
+                continue;
+            }
+            if (py > qy)
+            {
+                std::swap(px, qx);
+                std::swap(py, qy);
+            }
+
+            const int64_t firstLine = static_cast<int64_t>(std::ceil(py / spacing));
+            if (firstLine * spacing >= qy)
+            {
+                continue;   // İki tarama çizgisi arasında kalıyor
+            }
+
+            edges.push_back({firstLine, px, py, (qx - px) / (qy - py), qy});
+        }
+    }
+
+    if (edges.empty())
+    {
+        return;
+    }
+
+    std::sort(edges.begin(), edges.end(), [](const ScanEdge& a, const ScanEdge& b) {
+        return a.firstLine < b.firstLine;
+    });
+
+    // 2. Aktif kenar tablosu (SoA: kernel doğrudan okur)
+    std::vector<double> activeX, activeY, activeSlope, activeTop, crossings;
+    size_t nextEdge = 0;
+    const double minSpan = settings_.lineWidth * polygon::UNITS_PER_MM * 0.5;
+
+    for (int64_t line = edges.front().firstLine; ; ++line)
+    {
+        const double y = line * spacing;
+
+        // Üstü geçilen kenarları çıkar (sıra önemsiz, swap-remove)
+        for (size_t i = 0; i < activeTop.size();)
+        {
+            if (activeTop[i] <= y)
+            {
+                activeX[i] = activeX.back();        activeX.pop_back();
+                activeY[i] = activeY.back();        activeY.pop_back();
+                activeSlope[i] = activeSlope.back(); activeSlope.pop_back();
+                activeTop[i] = activeTop.back();    activeTop.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        while (nextEdge < edges.size() && edges[nextEdge].firstLine == line)
+        {
+            const ScanEdge& e = edges[nextEdge++];
+            activeX.push_back(e.x);
+            activeY.push_back(e.y);
+            activeSlope.push_back(e.slope);
+            activeTop.push_back(e.top);
+        }
+
+        if (activeTop.empty())
+        {
+            if (nextEdge == edges.size())
+            {
+                break;
+            }
+            line = edges[nextEdge].firstLine - 1;   // Boş bandı atla
+            continue;
+        }
+
+        // 3. Kesişimler (vektörize), sırala, içerideki aralıkları çiz
+        crossings.resize(activeX.size());
+        geometry::kernels::evaluateLinesAtY(activeX.data(), activeY.data(), activeSlope.data(),
+                                            activeX.size(), y, crossings.data());
+        std::sort(crossings.begin(), crossings.end());
+        ++scanlines;
+
+        // Zikzak: her ikinci çizgi ters yönde, uçlar arası boş gidiş kısalır
+        const bool reverse = (line & 1) != 0;
+        const size_t firstNew = lines.size();
+
+        for (size_t i = 0; i + 1 < crossings.size(); i += 2)
+        {
+            const double x0 = crossings[i];
+            const double x1 = crossings[i + 1];
+            if (x1 - x0 < minSpan)
+            {
+                continue;
+            }
+
+            // Geri döndür (+angle)
+            const polygon::IntPoint a(std::llround(x0 * c - y * s), std::llround(x0 * s + y * c));
+            const polygon::IntPoint b(std::llround(x1 * c - y * s), std::llround(x1 * s + y * c));
+            lines.push_back(reverse ? InfillLine{b, a} : InfillLine{a, b});
+        }
+
+        if (reverse)
+        {
+            std::reverse(lines.begin() + firstNew, lines.end());
+        }
+    }
+}
+
+} // namespace toolpath
+} // namespace core
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "PerimeterGenerator.h"
+#include "core/polygon/IntPoint.h"
+#include "core/parallel/ThreadPool.h"
+#include <string>
+#include <vector>
+
+namespace core {
+namespace toolpath {
+
+enum class InfillPattern
+{
+    Rectilinear,    // Tek yön, layer'dan layer'a 90° döner
+    Grid            // Her layer'da iki dik yön
+};
+
+struct InfillSettings
+{
+    InfillPattern pattern = InfillPattern::Rectilinear;
+    float density = 0.2f;           // 0..1 (1 = tam dolu)
+    float lineWidth = 0.4f;         // mm
+    float angle = 45.0f;            // derece, ilk layer'ın çizgi yönü
+};
+
+/**
+ * @brief Tek infill çizgisi (µm, layer koordinatında)
+ */
+struct InfillLine
+{
+    polygon::IntPoint start;
+    polygon::IntPoint end;
+};
+
+struct LayerInfill
+{
+    float z = 0.0f;
+    float thickness = 0.0f;
+    std::vector<InfillLine> lines;
+};
+
+struct InfillResult
+{
+    std::vector<LayerInfill> layers;        // PerimeterResult layer'ları ile aynı sıra
+
+    size_t lines = 0;
+    size_t scanlines = 0;                   // Taranan toplam çizgi
+    double totalLengthMm = 0.0;
+    double elapsedMs = 0.0;
+
+    std::string errorMessage;
+
+    bool success() const { return errorMessage.empty(); }
+
+    double linesPerSecond() const
+    {
+        return elapsedMs > 0.0 ? lines / (elapsedMs / 1000.0) : 0.0;
+    }
+};
+
+/**
+ * @brief Tarama çizgisi (scanline) tabanlı rectilinear/grid infill
+ *
+ * Infill alanı çizgi yönü yatay olacak şekilde döndürülür; çizgiler
+ * global bir ızgaraya (y = k * aralık) hizalanır, böylece layer'lar
+ * arasında üst üste oturur. Her tarama çizgisinde:
+ *
+ *   aktif kenarlar (SoA) → x kesişimleri tek SIMD geçişte
+ *   → sırala → (x0, x1), (x2, x3) ... içerideki aralıklar
+ *
+ * Kenarlar en alt y'ye göre sıralı bir kenar tablosundan aktif listeye
+ * girer, üst uçları geçilince çıkar. Girdi çakışmasız olmalıdır
+ * (PerimeterGenerator'ın infillArea'sı bu koşulu sağlar).
+ */
+class InfillGenerator
+{
+public:
+    explicit InfillGenerator(const InfillSettings& settings,
+                             parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    /**
+     * @brief Tüm layer'ların infill alanlarını doldur (layer'lar paralel)
+     */
+    InfillResult generate(const PerimeterResult& perimeters);
+
+    /**
+     * @brief Tek alan (thread-safe)
+     * @param layerIndex    Rectilinear'da yön değişimi için
+     * @param scanlineCount İsteğe bağlı: taranan çizgi sayısı
+     */
+    std::vector<InfillLine> fill(const polygon::Polygons& area, size_t layerIndex,
+                                 size_t* scanlineCount = nullptr) const;
+
+private:
+    InfillSettings settings_;
+    parallel::ThreadPool& pool_;
+
+    void fillDirection(const polygon::Polygons& area, double angleDeg, double spacing,
+                       std::vector<InfillLine>& lines, size_t& scanlines) const;
+};
+
+} // namespace toolpath
+} // namespace core
@@ -0,0 +1,113 @@
+#include "PerimeterGenerator.h"
+#include "core/slicing/ContourBuilder.h"
+#include "core/polygon/PolygonOffset.h"
+#include "core/polygon/PolygonUnion.h"
+#include <chrono>
+
+namespace core {
+namespace toolpath {
+
+namespace {
+
+// Layer'lar arası iş dengesiz: küçük parçalar dinamik dağıtılır
+constexpr size_t MIN_LAYERS_PER_CHUNK = 2;
+
+} // namespace
+
+size_t LayerPerimeters::loopCount() const
+{
+    size_t count = 0;
+    for (const auto& wall : walls)
+    {
+        count += wall.size();
+    }
+    return count;
+}
+
+PerimeterGenerator::PerimeterGenerator(const PerimeterSettings& settings,
+                                       parallel::ThreadPool& pool)
+    : settings_(settings)
+    , pool_(pool)
+{
+}
+
+PerimeterResult PerimeterGenerator::generate(const slicing::SlicingResult& slices)
+{
+    PerimeterResult result;
+
+    if (settings_.wallCount < 1)
+    {
+        result.errorMessage = "Wall count must be at least 1";
+        return result;
+    }
+
+    if (polygon::toFixed(settings_.extrusionWidth) < 2)
+    {
+        result.errorMessage = "Extrusion width is too small";
+        return result;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    result.layers.resize(slices.layers.size());
+    pool_.parallelFor(0, slices.layers.size(), MIN_LAYERS_PER_CHUNK,
+                      [&](size_t begin, size_t end) {
+                          for (size_t i = begin; i < end; ++i)
+                          {
+                              result.layers[i] = generateLayer(slices.layers[i]);
+                          }
+                      });
+
+    const auto endTime = std::chrono::steady_clock::now();
+    result.elapsedMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    for (size_t i = 0; i < slices.layers.size(); ++i)
+    {
+        result.inputSegments += slices.layers[i].segmentCount();
+        result.loops += result.layers[i].loopCount();
+        for (const auto& wall : result.layers[i].walls)
+        {
+            result.outputSegments += polygon::pointCount(wall);
+        }
+    }
+
+    return result;
+}
+
+LayerPerimeters PerimeterGenerator::generateLayer(const slicing::Layer& layer) const
+{
+    LayerPerimeters perimeters;
+    perimeters.z = layer.zHeight();
+    perimeters.thickness = layer.thickness();
+
+    // Üst üste binen kabuklar (ham slice) offset'ten önce birleştirilmeli
+    slicing::ContourBuilder builder;
+    polygon::PolygonUnion polygonUnion;
+    const polygon::Polygons contours = polygonUnion.unite(builder.build(layer.segments()));
+
+    const int64_t width = polygon::toFixed(settings_.extrusionWidth);
+    polygon::PolygonOffset offsetter(settings_.miterLimit);
+
+    // Dış duvarın merkez hattı konturdan yarım genişlik içeride
+    polygon::Polygons current = offsetter.offset(contours, -width / 2);
+
+    for (int wall = 0; wall < settings_.wallCount && !current.empty(); ++wall)
+    {
+        perimeters.walls.push_back(current);
+
+        if (wall + 1 < settings_.wallCount)
+        {
+            current = offsetter.offset(current, -width);
+        }
+    }
+
+    if (perimeters.walls.size() == static_cast<size_t>(settings_.wallCount))
+    {
+        perimeters.infillArea = offsetter.offset(perimeters.walls.back(), -width / 2);
+    }
+
+    return perimeters;
+}
+
+} // namespace toolpath
+} // namespace core
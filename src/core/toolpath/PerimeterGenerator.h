@@ -0,0 +1,83 @@
+#pragma once
+
+#include "core/slicing/Slicer.h"
+#include "core/polygon/IntPoint.h"
+#include "core/parallel/ThreadPool.h"
+#include <string>
+#include <vector>
+
+namespace core {
+namespace toolpath {
+
+struct PerimeterSettings
+{
+    int wallCount = 2;
+    float extrusionWidth = 0.4f;    // mm, duvarlar arası mesafe
+    double miterLimit = 2.0;        // Keskin köşelerde miter/bevel sınırı
+};
+
+/**
+ * @brief Tek layer'ın duvar halkaları (fixed-point, µm)
+ */
+struct LayerPerimeters
+{
+    float z = 0.0f;
+    float thickness = 0.0f;
+
+    std::vector<polygon::Polygons> walls;   // walls[0] dış duvar, sonra içe doğru
+    polygon::Polygons infillArea;           // En içteki duvarın iç sınırı
+
+    size_t loopCount() const;
+};
+
+struct PerimeterResult
+{
+    std::vector<LayerPerimeters> layers;    // Slicing layer'ları ile aynı sıra
+
+    size_t inputSegments = 0;               // Okunan slice segmenti
+    size_t outputSegments = 0;              // Üretilen duvar kenarı
+    size_t loops = 0;
+    double elapsedMs = 0.0;
+
+    std::string errorMessage;
+
+    bool success() const { return errorMessage.empty(); }
+
+    double segmentsPerSecond() const
+    {
+        return elapsedMs > 0.0 ? inputSegments / (elapsedMs / 1000.0) : 0.0;
+    }
+};
+
+/**
+ * @brief Layer konturlarından içe doğru N duvar (perimeter) üretir
+ *
+ * Her layer için:
+ *   kontur → dış duvar merkez hattı (w/2 içeride)
+ *          → sonraki duvarlar (her biri öncekinden w içeride)
+ *          → infill alanı (son duvardan w/2 içeride)
+ *
+ * Offset'ler tam sayı (µm) yapılır; ince bölgeler duvar sayısından önce
+ * kapanırsa o bölgenin iç duvarları kendiliğinden düşer. Layer'lar
+ * birbirinden bağımsızdır ve thread pool üzerinde paralel işlenir.
+ */
+class PerimeterGenerator
+{
+public:
+    explicit PerimeterGenerator(const PerimeterSettings& settings,
+                                parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    PerimeterResult generate(const slicing::SlicingResult& slices);
+
+    /**
+     * @brief Tek layer (thread-safe, generator state'i değişmez)
+     */
+    LayerPerimeters generateLayer(const slicing::Layer& layer) const;
+
+private:
+    PerimeterSettings settings_;
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace toolpath
+} // namespace core
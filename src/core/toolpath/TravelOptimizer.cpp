@@ -0,0 +1,529 @@
+#include "TravelOptimizer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace core {
+namespace toolpath {
+
+namespace {
+
+constexpr size_t MIN_LAYERS_PER_CHUNK = 2;
+
+// Izgara hücresi başına ortalama giriş noktası
+constexpr size_t POINTS_PER_CELL = 2;
+
+// Bundan küçük 2-opt kazançları (µm) döngüye girmemek için yok sayılır
+constexpr double MIN_TWO_OPT_GAIN = 1.0;
+
+using Clock = std::chrono::steady_clock;
+
+double distance(const polygon::IntPoint& a, const polygon::IntPoint& b)
+{
+    const double dx = static_cast<double>(b.x - a.x);
+    const double dy = static_cast<double>(b.y - a.y);
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+/**
+ * @brief Bir yola giriş noktası (halka köşesi ya da çizgi ucu)
+ */
+struct EntryPoint
+{
+    polygon::IntPoint p;
+    uint32_t path;
+    uint32_t vertex;    // Halka: köşe index'i, çizgi: 0 = start, 1 = end
+};
+
+/**
+ * @brief Turdaki bir yol: nereden girilip nereden çıkılıyor
+ */
+struct TourNode
+{
+    uint32_t path;
+    uint32_t vertex;
+    polygon::IntPoint entry;
+    polygon::IntPoint exit;
+};
+
+/**
+ * @brief Ziyaret edilmemiş en yakın giriş noktası için düzgün ızgara
+ *
+ * Noktalar hücre sırasına göre tek dizide (CSR) tutulur. Sorgu, nokta
+ * hücresinden başlayıp halka halka genişler; bulunan en yakın nokta
+ * sonraki halkadan daha yakınsa durur. Ziyaret edilmiş yolların
+ * noktaları tarandıkça hücre sonuna atılıp silinir, her nokta en fazla
+ * bir kez silinir.
+ */
+class PointGrid
+{
+public:
+    explicit PointGrid(const std::vector<EntryPoint>& points)
+    {
+        int64_t maxX = std::numeric_limits<int64_t>::min();
+        int64_t maxY = std::numeric_limits<int64_t>::min();
+        minX_ = std::numeric_limits<int64_t>::max();
+        minY_ = std::numeric_limits<int64_t>::max();
+
+        for (const EntryPoint& e : points)
+        {
+            minX_ = std::min(minX_, e.p.x);
+            minY_ = std::min(minY_, e.p.y);
+            maxX = std::max(maxX, e.p.x);
+            maxY = std::max(maxY, e.p.y);
+        }
+
+        const double width = static_cast<double>(maxX - minX_) + 1.0;
+        const double height = static_cast<double>(maxY - minY_) + 1.0;
+        const double targetCells = std::max<double>(1.0, points.size() / POINTS_PER_CELL);
+
+        // İnce uzun (ör. tek sıra) nokta kümelerinde de hücre sayısı sınırlı kalır
+        const double cell = std::max({std::sqrt(width * height / targetCells),
+                                      std::max(width, height) / targetCells,
+                                      1.0});
+        cellSize_ = static_cast<int64_t>(std::ceil(cell));
+
+        nx_ = static_cast<int>((maxX - minX_) / cellSize_) + 1;
+        ny_ = static_cast<int>((maxY - minY_) / cellSize_) + 1;
+
+        const size_t cells = static_cast<size_t>(nx_) * ny_;
+        cellStart_.assign(cells + 1, 0);
+        for (const EntryPoint& e : points)
+        {
+            cellStart_[cellOf(e.p) + 1]++;
+        }
+        for (size_t c = 0; c < cells; ++c)
+        {
+            cellStart_[c + 1] += cellStart_[c];
+        }
+
+        cellLive_.resize(cells);
+        for (size_t c = 0; c < cells; ++c)
+        {
+            cellLive_[c] = cellStart_[c + 1] - cellStart_[c];
+        }
+
+        points_.resize(points.size());
+        std::vector<uint32_t> fill(cellStart_.begin(), cellStart_.end() - 1);
+        for (const EntryPoint& e : points)
+        {
+            points_[fill[cellOf(e.p)]++] = e;
+        }
+    }
+
+    /**
+     * @return Ziyaret edilmemiş nokta kalmadıysa false
+     */
+    bool nearest(const polygon::IntPoint& q, const std::vector<char>& visited, EntryPoint& best)
+    {
+        const int cx = std::clamp(static_cast<int>((q.x - minX_) / cellSize_), 0, nx_ - 1);
+        const int cy = std::clamp(static_cast<int>((q.y - minY_) / cellSize_), 0, ny_ - 1);
+
+        // Izgara dışındaki sorgu için sınır halkası da kaydırılır
+        const int maxRing = std::max({cx, nx_ - 1 - cx, cy, ny_ - 1 - cy});
+
+        int64_t bestD2 = std::numeric_limits<int64_t>::max();
+        bool found = false;
+
+        for (int r = 0; r <= maxRing; ++r)
+        {
+            for (int dy = -r; dy <= r; ++dy)
+            {
+                const int y = cy + dy;
+                if (y < 0 || y >= ny_)
+                {
+                    continue;
+                }
+
+                // Halkanın üst/alt satırı tam, diğerleri sadece iki kenar
+                const int step = (dy == -r || dy == r) ? 1 : std::max(1, 2 * r);
+                for (int dx = -r; dx <= r; dx += step)
+                {
+                    const int x = cx + dx;
+                    if (x >= 0 && x < nx_)
+                    {
+                        found |= scanCell(static_cast<size_t>(y) * nx_ + x, q, visited, best, bestD2);
+                    }
+                }
+            }
+
+            // Sonraki halkadaki her nokta en az r hücre uzakta
+            const int64_t ringDistance = static_cast<int64_t>(r) * cellSize_;
+            if (found && bestD2 <= ringDistance * ringDistance)
+            {
+                break;
+            }
+        }
+
+        return found;
+    }
+
+private:
+    std::vector<EntryPoint> points_;
+    std::vector<uint32_t> cellStart_;
+    std::vector<uint32_t> cellLive_;    // Hücrenin başındaki canlı nokta sayısı
+    int64_t minX_ = 0;
+    int64_t minY_ = 0;
+    int64_t cellSize_ = 1;
+    int nx_ = 1;
+    int ny_ = 1;
+
+    size_t cellOf(const polygon::IntPoint& p) const
+    {
+        const int x = static_cast<int>((p.x - minX_) / cellSize_);
+        const int y = static_cast<int>((p.y - minY_) / cellSize_);
+        return static_cast<size_t>(y) * nx_ + x;
+    }
+
+    bool scanCell(size_t cell, const polygon::IntPoint& q, const std::vector<char>& visited,
+                  EntryPoint& best, int64_t& bestD2)
+    {
+        bool found = false;
+        uint32_t i = cellStart_[cell];
+        uint32_t end = i + cellLive_[cell];
+
+        while (i < end)
+        {
+            const EntryPoint& e = points_[i];
+            if (visited[e.path])
+            {
+                std::swap(points_[i], points_[--end]);
+                continue;
+            }
+
+            const int64_t dx = e.p.x - q.x;
+            const int64_t dy = e.p.y - q.y;
+            const int64_t d2 = dx * dx + dy * dy;
+            if (d2 < bestD2)
+            {
+                bestD2 = d2;
+                best = e;
+            }
+            found = true;
+            ++i;
+        }
+
+        cellLive_[cell] = end - cellStart_[cell];
+        return found;
+    }
+};
+
+/**
+ * @brief Giriş noktalarından nearest-neighbour turu
+ * @param makeNode Seçilen giriş noktasını TourNode'a çevirir
+ */
+template <typename MakeNode>
+std::vector<TourNode> nearestNeighbourTour(const std::vector<EntryPoint>& entries,
+                                           size_t pathCount,
+                                           polygon::IntPoint& position,
+                                           MakeNode makeNode)
+{
+    std::vector<TourNode> tour;
+    tour.reserve(pathCount);
+
+    PointGrid grid(entries);
+    std::vector<char> visited(pathCount, 0);
+
+    EntryPoint next{};
+    while (tour.size() < pathCount && grid.nearest(position, visited, next))
+    {
+        visited[next.path] = 1;
+        tour.push_back(makeNode(next));
+        position = tour.back().exit;
+    }
+
+    return tour;
+}
+
+/**
+ * @brief Süre sınırlı 2-opt: turun bir bölümünü ters çevir
+ *
+ * Açık yollar (çizgiler) ters çevrilen bölümde ters yönde basılır;
+ * halkaların girişi ile çıkışı aynı noktadır, sadece sıraları değişir.
+ */
+size_t twoOpt(std::vector<TourNode>& tour, const polygon::IntPoint& start, bool closedPaths,
+              Clock::time_point deadline)
+{
+    const size_t n = tour.size();
+    size_t moves = 0;
+    bool improved = n > 2;
+
+    while (improved)
+    {
+        improved = false;
+
+        for (size_t i = 0; i + 1 < n; ++i)
+        {
+            if (Clock::now() > deadline)
+            {
+                return moves;
+            }
+
+            for (size_t j = i + 1; j < n; ++j)
+            {
+                const polygon::IntPoint& prev = i == 0 ? start : tour[i - 1].exit;
+                const bool hasNext = j + 1 < n;
+
+                double before = distance(prev, tour[i].entry);
+                double after = distance(prev, tour[j].exit);
+                if (hasNext)
+                {
+                    before += distance(tour[j].exit, tour[j + 1].entry);
+                    after += distance(tour[i].entry, tour[j + 1].entry);
+                }
+
+                if (after + MIN_TWO_OPT_GAIN < before)
+                {
+                    std::reverse(tour.begin() + i, tour.begin() + j + 1);
+                    if (!closedPaths)
+                    {
+                        for (size_t k = i; k <= j; ++k)
+                        {
+                            std::swap(tour[k].entry, tour[k].exit);
+                            tour[k].vertex ^= 1u;
+                        }
+                    }
+                    ++moves;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    return moves;
+}
+
+/**
+ * @brief Halkaları sırala, her birini seçilen köşeden başlat
+ */
+size_t orderLoops(polygon::Polygons& rings, polygon::IntPoint& position,
+                  const TravelSettings& settings, Clock::time_point deadline)
+{
+    std::vector<EntryPoint> entries;
+    entries.reserve(polygon::pointCount(rings));
+    for (size_t r = 0; r < rings.size(); ++r)
+    {
+        for (size_t v = 0; v < rings[r].size(); ++v)
+        {
+            entries.push_back({rings[r][v], static_cast<uint32_t>(r), static_cast<uint32_t>(v)});
+        }
+    }
+
+    if (entries.empty())
+    {
+        return 0;
+    }
+
+    const polygon::IntPoint start = position;
+    std::vector<TourNode> tour = nearestNeighbourTour(
+        entries, rings.size(), position,
+        [](const EntryPoint& e) { return TourNode{e.path, e.vertex, e.p, e.p}; });
+
+    size_t moves = 0;
+    if (settings.twoOpt)
+    {
+        moves = twoOpt(tour, start, true, deadline);
+        position = tour.back().exit;
+    }
+
+    polygon::Polygons ordered;
+    ordered.reserve(rings.size());
+    for (const TourNode& node : tour)
+    {
+        polygon::Polygon& ring = rings[node.path];
+        std::rotate(ring.begin(), ring.begin() + node.vertex, ring.end());
+        ordered.push_back(std::move(ring));
+    }
+
+    // Köşesiz (boş) halkalar tura girmez
+    rings = std::move(ordered);
+    return moves;
+}
+
+/**
+ * @brief Çizgileri sırala, gerekirse ters çevir
+ */
+size_t orderLines(std::vector<InfillLine>& lines, polygon::IntPoint& position,
+                  const TravelSettings& settings, Clock::time_point deadline)
+{
+    if (lines.empty())
+    {
+        return 0;
+    }
+
+    std::vector<EntryPoint> entries;
+    entries.reserve(lines.size() * 2);
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        entries.push_back({lines[i].start, static_cast<uint32_t>(i), 0});
+        entries.push_back({lines[i].end, static_cast<uint32_t>(i), 1});
+    }
+
+    const polygon::IntPoint start = position;
+    std::vector<TourNode> tour = nearestNeighbourTour(
+        entries, lines.size(), position,
+        [&lines](const EntryPoint& e) {
+            const InfillLine& line = lines[e.path];
+            return e.vertex == 0 ? TourNode{e.path, 0, line.start, line.end}
+                                 : TourNode{e.path, 1, line.end, line.start};
+        });
+
+    size_t moves = 0;
+    if (settings.twoOpt)
+    {
+        moves = twoOpt(tour, start, false, deadline);
+        position = tour.back().exit;
+    }
+
+    std::vector<InfillLine> ordered;
+    ordered.reserve(lines.size());
+    for (const TourNode& node : tour)
+    {
+        ordered.push_back({node.entry, node.exit});
+    }
+
+    lines = std::move(ordered);
+    return moves;
+}
+
+/**
+ * @brief GCodeWriter sırasıyla toplam boşta gidiş (µm)
+ */
+double measureTravel(const LayerPerimeters& perimeters, const LayerInfill& infill,
+                     polygon::IntPoint position)
+{
+    double travel = 0.0;
+
+    for (size_t w = perimeters.walls.size(); w-- > 0;)
+    {
+        for (const polygon::Polygon& ring : perimeters.walls[w])
+        {
+            if (!ring.empty())
+            {
+                travel += distance(position, ring.front());
+                position = ring.front();
+            }
+        }
+    }
+
+    for (const InfillLine& line : infill.lines)
+    {
+        travel += distance(position, line.start);
+        position = line.end;
+    }
+
+    return travel;
+}
+
+/**
+ * @brief Layer'ın sol alt köşesi (turun başlangıcı)
+ */
+polygon::IntPoint layerCorner(const LayerPerimeters& perimeters, const LayerInfill& infill)
+{
+    polygon::IntPoint corner{std::numeric_limits<int64_t>::max(),
+                             std::numeric_limits<int64_t>::max()};
+
+    auto extend = [&corner](const polygon::IntPoint& p) {
+        corner.x = std::min(corner.x, p.x);
+        corner.y = std::min(corner.y, p.y);
+    };
+
+    if (!perimeters.walls.empty())
+    {
+        // Dış duvar diğer her şeyi çevreler
+        for (const polygon::Polygon& ring : perimeters.walls.front())
+        {
+            std::for_each(ring.begin(), ring.end(), extend);
+        }
+    }
+    else
+    {
+        for (const InfillLine& line : infill.lines)
+        {
+            extend(line.start);
+            extend(line.end);
+        }
+    }
+
+    return corner;
+}
+
+} // namespace
+
+TravelOptimizer::TravelOptimizer(const TravelSettings& settings, parallel::ThreadPool& pool)
+    : settings_(settings)
+    , pool_(pool)
+{
+}
+
+TravelResult TravelOptimizer::optimize(PerimeterResult& perimeters, InfillResult& infill)
+{
+    TravelResult result;
+
+    if (!infill.layers.empty() && infill.layers.size() != perimeters.layers.size())
+    {
+        result.errorMessage = "Infill and perimeter layer counts differ";
+        return result;
+    }
+
+    const auto startTime = Clock::now();
+
+    std::vector<LayerTravelStats> stats(perimeters.layers.size());
+    pool_.parallelFor(0, perimeters.layers.size(), MIN_LAYERS_PER_CHUNK,
+                      [&](size_t begin, size_t end) {
+                          LayerInfill noInfill;
+                          for (size_t i = begin; i < end; ++i)
+                          {
+                              LayerInfill& layerInfill = infill.layers.empty() ? noInfill
+                                                                               : infill.layers[i];
+                              stats[i] = optimizeLayer(perimeters.layers[i], layerInfill);
+                          }
+                      });
+
+    result.elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - startTime).count();
+
+    result.layers = stats.size();
+    for (const LayerTravelStats& layer : stats)
+    {
+        result.paths += layer.paths;
+        result.travelBeforeMm += layer.travelBeforeMm;
+        result.travelAfterMm += layer.travelAfterMm;
+        result.twoOptMoves += layer.twoOptMoves;
+    }
+
+    return result;
+}
+
+LayerTravelStats TravelOptimizer::optimizeLayer(LayerPerimeters& perimeters, LayerInfill& infill) const
+{
+    LayerTravelStats stats;
+    stats.paths = perimeters.loopCount() + infill.lines.size();
+
+    if (stats.paths == 0)
+    {
+        return stats;
+    }
+
+    const polygon::IntPoint start = layerCorner(perimeters, infill);
+    stats.travelBeforeMm = measureTravel(perimeters, infill, start) / polygon::UNITS_PER_MM;
+
+    const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                             std::chrono::duration<double, std::milli>(
+                                                 settings_.twoOptBudgetMs));
+
+    // Grup sırası sabit, nozül konumu gruplar arasında taşınır
+    polygon::IntPoint position = start;
+    for (size_t w = perimeters.walls.size(); w-- > 0;)
+    {
+        stats.twoOptMoves += orderLoops(perimeters.walls[w], position, settings_, deadline);
+    }
+    stats.twoOptMoves += orderLines(infill.lines, position, settings_, deadline);
+
+    stats.travelAfterMm = measureTravel(perimeters, infill, start) / polygon::UNITS_PER_MM;
+    return stats;
+}
+
+} // namespace toolpath
+} // namespace core
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "PerimeterGenerator.h"
+#include "InfillGenerator.h"
+#include "core/polygon/IntPoint.h"
+#include "core/parallel/ThreadPool.h"
+#include <string>
+
+namespace core {
+namespace toolpath {
+
+struct TravelSettings
+{
+    bool twoOpt = false;                // Nearest-neighbour turunu 2-opt ile iyileştir
+    double twoOptBudgetMs = 20.0;       // Layer başına 2-opt süre sınırı
+};
+
+/**
+ * @brief Tek layer'ın boşta gidiş (travel) özeti
+ */
+struct LayerTravelStats
+{
+    size_t paths = 0;                   // Sıralanan halka + çizgi
+    double travelBeforeMm = 0.0;
+    double travelAfterMm = 0.0;
+    size_t twoOptMoves = 0;             // Uygulanan 2-opt ters çevirme
+};
+
+struct TravelResult
+{
+    size_t layers = 0;
+    size_t paths = 0;
+    double travelBeforeMm = 0.0;
+    double travelAfterMm = 0.0;
+    size_t twoOptMoves = 0;
+    double elapsedMs = 0.0;
+
+    std::string errorMessage;
+
+    bool success() const { return errorMessage.empty(); }
+
+    /**
+     * @brief Boşta gidişteki azalma (0..1)
+     */
+    double reduction() const
+    {
+        return travelBeforeMm > 0.0 ? 1.0 - travelAfterMm / travelBeforeMm : 0.0;
+    }
+};
+
+/**
+ * @brief Layer içi yol sırası: kısa boşta gidiş turu
+ *
+ * Baskı sırası gruplar halinde sabittir (GCodeWriter ile aynı):
+ * en içteki duvar → ... → dış duvar → infill. Her grubun içinde:
+ *
+ * - Halkalar (ada ve delikler) nearest-neighbour ile sıralanır, her
+ *   halka nozüle en yakın köşesinden başlatılır (dikiş noktası).
+ * - Infill çizgileri sıralanır, gerekirse ters yönde basılır.
+ *
+ * En yakın aday, tüm giriş noktalarını (halka köşeleri, çizgi uçları)
+ * tutan düzgün bir ızgarada halka halka genişleyen aramayla bulunur;
+ * ziyaret edilen yolların noktaları tarandıkça ızgaradan silinir.
+ * Sorgular yerel kaldığından binlerce adalı layer'da da maliyet nokta
+ * sayısıyla yaklaşık doğrusal büyür (her çiftin denendiği O(n²) yerine).
+ *
+ * 2-opt açıksa tur, süre sınırı içinde segment ters çevirmeleriyle
+ * iyileştirilir (dikiş noktaları değişmez).
+ *
+ * Layer'lar bağımsız sıralanır ve thread pool'da paralel işlenir; her
+ * layer kendi sınırlarının sol alt köşesinden başlar.
+ */
+class TravelOptimizer
+{
+public:
+    explicit TravelOptimizer(const TravelSettings& settings,
+                             parallel::ThreadPool& pool = parallel::ThreadPool::shared());
+
+    /**
+     * @brief Tüm layer'ları yerinde sırala (layer'lar paralel)
+     *
+     * infill boş olabilir; değilse perimeters ile aynı sayıda layer içermelidir.
+     */
+    TravelResult optimize(PerimeterResult& perimeters, InfillResult& infill);
+
+    /**
+     * @brief Tek layer (thread-safe)
+     */
+    LayerTravelStats optimizeLayer(LayerPerimeters& perimeters, LayerInfill& infill) const;
+
+private:
+    TravelSettings settings_;
+    parallel::ThreadPool& pool_;
+};
+
+} // namespace toolpath
+} // namespace core
@@ -0,0 +1,161 @@
+#include "BufferedFileWriter.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace io {
+namespace gcode {
+
+BufferedFileWriter::BufferedFileWriter(const std::string& filepath, size_t bufferSize)
+    : filepath_(filepath)
+    , capacity_(std::max<size_t>(bufferSize, 4096))
+{
+    file_ = std::fopen(filepath.c_str(), "wb");
+    if (!file_)
+    {
+        throw std::runtime_error("Cannot open file for writing: " + filepath);
+    }
+
+    // Tamponlamayı kendimiz yapıyoruz
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+
+    front_.resize(capacity_);
+    back_.resize(capacity_);
+
+    worker_ = std::thread(&BufferedFileWriter::writerLoop, this);
+}
+
+BufferedFileWriter::~BufferedFileWriter()
+{
+    if (!closed_)
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+}
+
+void BufferedFileWriter::write(const char* data, size_t size)
+{
+    while (size > 0)
+    {
+        if (used_ == capacity_)
+        {
+            swapBuffers();
+        }
+
+        const size_t chunk = std::min(size, capacity_ - used_);
+        std::memcpy(front_.data() + used_, data, chunk);
+        used_ += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+}
+
+void BufferedFileWriter::swapBuffers()
+{
+    if (used_ == 0)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // Önceki tampon hâlâ yazılıyorsa disk bizden yavaş: bekle
+    if (pending_)
+    {
+        const auto waitStart = std::chrono::steady_clock::now();
+        wakeup_.wait(lock, [this]() { return !pending_; });
+        stats_.producerWaitMs += std::chrono::duration<double, std::milli>(
+                                     std::chrono::steady_clock::now() - waitStart).count();
+    }
+
+    front_.swap(back_);
+    backUsed_ = used_;
+    pending_ = true;
+
+    produced_ += used_;
+    used_ = 0;
+
+    lock.unlock();
+    wakeup_.notify_all();
+}
+
+void BufferedFileWriter::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+        wakeup_.wait(lock, [this]() { return pending_ || stop_; });
+
+        if (!pending_)
+        {
+            return;     // stop_ ve bekleyen veri yok
+        }
+
+        // back_ ve backUsed_ pending_ true iken sadece bu thread'e ait
+        const size_t size = backUsed_;
+        lock.unlock();
+
+        size_t written = 0;
+        if (error_.empty())
+        {
+            written = std::fwrite(back_.data(), 1, size, file_);
+        }
+
+        lock.lock();
+        if (written != size && error_.empty())
+        {
+            error_ = "Write failed: " + filepath_;
+        }
+        stats_.bytes += written;
+        stats_.flushes++;
+        pending_ = false;
+        wakeup_.notify_all();
+    }
+}
+
+void BufferedFileWriter::close()
+{
+    if (closed_)
+    {
+        return;
+    }
+    closed_ = true;
+
+    swapBuffers();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wakeup_.notify_all();
+    worker_.join();
+
+    const bool closeFailed = std::fclose(file_) != 0;
+    file_ = nullptr;
+
+    if (!error_.empty())
+    {
+        throw std::runtime_error(error_);
+    }
+    if (closeFailed)
+    {
+        throw std::runtime_error("Cannot close file: " + filepath_);
+    }
+}
+
+BufferedFileWriter::Stats BufferedFileWriter::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace gcode
+} // namespace io
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace io {
+namespace gcode {
+
+/**
+ * @brief Çift tamponlu, arka plan thread'inde diske yazan dosya yazıcı
+ *
+ * Üretici (formatlayan thread) ön tampona yazar. Tampon dolunca arka
+ * tamponla yer değiştirir ve I/O thread'i onu diske yazarken üretici
+ * diğer tamponu doldurmaya devam eder. Böylece formatlama ile disk
+ * yazımı üst üste biner; üretici yalnızca disk kendisinden yavaşsa bekler.
+ *
+ * Dosya tamponsuz (setvbuf _IONBF) açılır: veri stdio'da ikinci kez
+ * kopyalanmaz, her flush tek büyük fwrite'tır.
+ *
+ * Tek üretici içindir. Yazma hatası I/O thread'inde kaydedilir ve
+ * close()'da std::runtime_error olarak fırlatılır.
+ */
+class BufferedFileWriter
+{
+public:
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 4u << 20;     // 4 MB
+
+    /**
+     * @throws std::runtime_error Dosya açılamazsa
+     */
+    explicit BufferedFileWriter(const std::string& filepath,
+                                size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * @brief close() çağrılmadıysa kapatır (hata yutulur)
+     */
+    ~BufferedFileWriter();
+
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+    /**
+     * @brief En az size byte'lık yazma alanı ayır
+     *
+     * Dönen pointer'a en fazla size byte yazılır, ardından commit()
+     * ile yazılan sonun pointer'ı verilir. size tampon boyunu aşamaz.
+     */
+    char* reserve(size_t size)
+    {
+        if (used_ + size > capacity_)
+        {
+            swapBuffers();
+        }
+        return front_.data() + used_;
+    }
+
+    void commit(const char* end)
+    {
+        used_ = static_cast<size_t>(end - front_.data());
+    }
+
+    /**
+     * @brief Ham veri ekle (tampondan büyük olabilir)
+     */
+    void write(const char* data, size_t size);
+
+    void write(const std::string& text) { write(text.data(), text.size()); }
+
+    /**
+     * @brief Kalan veriyi yaz, thread'i durdur, dosyayı kapat
+     * @throws std::runtime_error Yazma ya da kapatma başarısızsa
+     */
+    void close();
+
+    /**
+     * @brief Üretilen toplam byte (henüz diske inmemiş olanlar dahil)
+     */
+    uint64_t bytesWritten() const { return produced_ + used_; }
+
+    struct Stats
+    {
+        uint64_t bytes = 0;             // Diske yazılan
+        size_t flushes = 0;             // Arka plan fwrite sayısı
+        double producerWaitMs = 0.0;    // Üreticinin diski beklediği süre
+    };
+
+    /**
+     * @brief close()'dan sonra kesinleşir
+     */
+    Stats stats() const;
+
+private:
+    std::FILE* file_ = nullptr;
+    std::string filepath_;
+
+    // Üretici tarafı (kilitsiz)
+    std::vector<char> front_;
+    size_t capacity_ = 0;
+    size_t used_ = 0;
+    uint64_t produced_ = 0;
+
+    // I/O thread'i ile paylaşılan
+    mutable std::mutex mutex_;
+    std::condition_variable wakeup_;
+    std::vector<char> back_;
+    size_t backUsed_ = 0;
+    bool pending_ = false;          // back_ yazılmayı bekliyor ya da yazılıyor
+    bool stop_ = false;
+    std::string error_;
+    Stats stats_;
+
+    std::thread worker_;
+    bool closed_ = false;
+
+    void swapBuffers();
+    void writerLoop();
+};
+
+} // namespace gcode
+} // namespace io
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace io {
+namespace gcode {
+
+/**
+ * @brief Satır başına iostream/printf maliyeti olmadan sayı yazımı
+ *
+ * G-code satırlarının neredeyse tamamı koordinat ve E değeridir.
+ * Sayılar ölçeklenmiş tam sayıya çevrilip rakam rakam yazılır;
+ * locale, format string ayrıştırma ve ara string yoktur.
+ * Ondalık kısmın sondaki sıfırları yazılmaz ("12.5", "12.500" değil).
+ *
+ * Tüm fonksiyonlar yazılan son karakterin bir sonrasını döndürür.
+ * Çağıran yeterli yer ayırmalıdır (sayı başına en fazla 24 byte).
+ */
+
+constexpr int MAX_DECIMALS = 6;
+
+namespace detail {
+
+constexpr int64_t POW10[MAX_DECIMALS + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+inline char* writeDigits(char* out, uint64_t value)
+{
+    char tmp[20];
+    int n = 0;
+    do
+    {
+        tmp[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (n > 0)
+    {
+        *out++ = tmp[--n];
+    }
+    return out;
+}
+
+} // namespace detail
+
+/**
+ * @brief Tam sayı yaz
+ */
+inline char* formatInt(char* out, int64_t value)
+{
+    if (value < 0)
+    {
+        *out++ = '-';
+        return detail::writeDigits(out, static_cast<uint64_t>(-(value + 1)) + 1);
+    }
+    return detail::writeDigits(out, static_cast<uint64_t>(value));
+}
+
+/**
+ * @brief value / 10^decimals değerini ondalıklı yaz
+ *
+ * Fixed-point koordinatlar (µm, decimals = 3) yuvarlama olmadan,
+ * birebir bu yolla yazılır.
+ */
+inline char* formatScaled(char* out, int64_t scaled, int decimals)
+{
+    if (scaled < 0)
+    {
+        *out++ = '-';
+        scaled = -scaled;
+    }
+
+    const int64_t unit = detail::POW10[decimals];
+    out = detail::writeDigits(out, static_cast<uint64_t>(scaled / unit));
+
+    int64_t fraction = scaled % unit;
+    if (fraction == 0)
+    {
+        return out;
+    }
+
+    int digits = decimals;
+    while (fraction % 10 == 0)
+    {
+        fraction /= 10;
+        --digits;
+    }
+
+    *out++ = '.';
+    for (int d = digits - 1; d >= 0; --d)
+    {
+        out[d] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    return out + digits;
+}
+
+/**
+ * @brief Kayan noktalı sayıyı en fazla decimals basamakla yaz
+ *
+ * |value| * 10^decimals int64'e sığmalıdır (G-code değerleri için her zaman).
+ */
+inline char* formatFixed(char* out, double value, int decimals)
+{
+    const int64_t scaled = std::llround(value * static_cast<double>(detail::POW10[decimals]));
+    return formatScaled(out, scaled, decimals);
+}
+
+/**
+ * @brief Sabit metni kopyala (sonlandırıcı hariç)
+ */
+template <size_t N>
+inline char* appendLiteral(char* out, const char (&text)[N])
+{
+    for (size_t i = 0; i + 1 < N; ++i)
+    {
+        *out++ = text[i];
+    }
+    return out;
+}
+
+} // namespace gcode
+} // namespace io
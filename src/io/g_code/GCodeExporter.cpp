@@ -0,0 +1,144 @@
+#include "GCodeExporter.h"
+#include <algorithm>
+#include <future>
+#include <vector>
+
+namespace io {
+namespace gcode {
+
+namespace {
+
+// Thread başına layer: grup küçükse ilk byte erken iner, büyükse
+// layer'lar arası iş yükü dengesizliği thread'leri bekletmez
+constexpr size_t LAYERS_PER_THREAD = 4;
+constexpr size_t MIN_BATCH_LAYERS = 8;
+
+struct Batch
+{
+    std::vector<core::toolpath::LayerPerimeters> perimeters;
+    std::vector<core::toolpath::LayerInfill> infill;
+};
+
+} // namespace
+
+GCodeExporter::GCodeExporter(const GCodeSettings& settings,
+                             const core::toolpath::PerimeterSettings& perimeterSettings,
+                             const core::toolpath::InfillSettings& infillSettings,
+                             const core::toolpath::TravelSettings& travelSettings,
+                             core::parallel::ThreadPool& pool)
+    : settings_(settings)
+    , perimeters_(perimeterSettings, pool)
+    , infill_(infillSettings, pool)
+    , travel_(travelSettings, pool)
+    , pool_(pool)
+{
+}
+
+GCodeStats GCodeExporter::exportLayers(core::slicing::LayerProvider& provider,
+                                       const std::string& filepath,
+                                       const ProgressCallback& progress)
+{
+    return run(provider.layerCount(),
+               [&provider](size_t i) { return provider.layer(i); },
+               filepath, progress);
+}
+
+GCodeStats GCodeExporter::exportLayers(const core::slicing::SlicingResult& slices,
+                                       const std::string& filepath,
+                                       const ProgressCallback& progress)
+{
+    // Sahipsiz (aliasing) pointer: sonuç bu çağrı boyunca yaşar, kopya yok
+    return run(slices.layers.size(),
+               [&slices](size_t i) {
+                   return std::shared_ptr<const core::slicing::Layer>(
+                       std::shared_ptr<const core::slicing::Layer>(), &slices.layers[i]);
+               },
+               filepath, progress);
+}
+
+GCodeStats GCodeExporter::run(size_t layerCount, const LayerSource& source,
+                              const std::string& filepath, const ProgressCallback& progress)
+{
+    GCodeWriter writer(filepath, settings_);
+    writer.begin(layerCount);
+
+    const size_t batchSize = std::max(MIN_BATCH_LAYERS,
+                                      LAYERS_PER_THREAD * (pool_.size() + 1));
+
+    // Grubun layer'larını kes ve yollarını üret (paralel)
+    auto build = [this, &source, layerCount, batchSize](size_t first) {
+        const size_t last = std::min(layerCount, first + batchSize);
+
+        Batch batch;
+        batch.perimeters.resize(last - first);
+        batch.infill.resize(last - first);
+
+        pool_.parallelFor(first, last, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                const std::shared_ptr<const core::slicing::Layer> layer = source(i);
+                if (!layer || layer->isEmpty())
+                {
+                    continue;
+                }
+
+                core::toolpath::LayerPerimeters& perimeters = batch.perimeters[i - first];
+                perimeters = perimeters_.generateLayer(*layer);
+
+                core::toolpath::LayerInfill& infill = batch.infill[i - first];
+                infill.z = perimeters.z;
+                infill.thickness = perimeters.thickness;
+                infill.lines = infill_.fill(perimeters.infillArea, i);
+
+                travel_.optimizeLayer(perimeters, infill);
+            }
+        });
+
+        return batch;
+    };
+
+    std::future<Batch> next;
+    if (layerCount > 0)
+    {
+        next = pool_.submit([build]() { return build(0); });
+    }
+
+    try
+    {
+        for (size_t first = 0; first < layerCount; first += batchSize)
+        {
+            Batch batch = next.get();
+
+            // Bu grup yazılırken sonraki grup havuzda hazırlanır
+            if (first + batchSize < layerCount)
+            {
+                const size_t nextFirst = first + batchSize;
+                next = pool_.submit([build, nextFirst]() { return build(nextFirst); });
+            }
+
+            for (size_t i = 0; i < batch.perimeters.size(); ++i)
+            {
+                writer.writeLayer(batch.perimeters[i], batch.infill[i]);
+            }
+
+            if (progress)
+            {
+                progress(std::min(layerCount, first + batchSize), layerCount);
+            }
+        }
+    }
+    catch (...)
+    {
+        // Havuzdaki grup bu çağrının yerel değişkenlerine bakıyor
+        if (next.valid())
+        {
+            next.wait();
+        }
+        throw;
+    }
+
+    return writer.finish();
+}
+
+} // namespace gcode
+} // namespace io
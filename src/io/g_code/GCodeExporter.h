@@ -0,0 +1,76 @@
+#pragma once
+
+#include "GCodeWriter.h"
+#include "core/slicing/Slicer.h"
+#include "core/slicing/LayerProvider.h"
+#include "core/toolpath/PerimeterGenerator.h"
+#include "core/toolpath/InfillGenerator.h"
+#include "core/toolpath/TravelOptimizer.h"
+#include "core/parallel/ThreadPool.h"
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace io {
+namespace gcode {
+
+/**
+ * @brief Slice → duvar → infill → G-code boru hattı (streaming)
+ *
+ * Layer'lar sabit boyutlu gruplar halinde işlenir:
+ *
+ *   grup k+1: kesme + duvar + infill + yol sırası (thread pool'da, paralel)
+ *   grup k  : G-code formatlama (çağıran thread)
+ *   grup k-1: diske yazma (BufferedFileWriter thread'i)
+ *
+ * Böylece dosyanın ilk byte'ları ilk grup biter bitmez diske iner;
+ * tüm slicing sonucu ya da tüm G-code bellekte tutulmaz.
+ *
+ * LayerProvider ile kullanıldığında layer'lar talep edildikçe kesilir
+ * (cache'te olanlar tekrar kesilmez), tam slicing'in bitmesi beklenmez.
+ */
+class GCodeExporter
+{
+public:
+    /**
+     * @brief (yazılan layer, toplam layer), formatlayan thread'den çağrılır
+     */
+    using ProgressCallback = std::function<void(size_t, size_t)>;
+
+    GCodeExporter(const GCodeSettings& settings,
+                  const core::toolpath::PerimeterSettings& perimeterSettings,
+                  const core::toolpath::InfillSettings& infillSettings,
+                  const core::toolpath::TravelSettings& travelSettings = {},
+                  core::parallel::ThreadPool& pool = core::parallel::ThreadPool::shared());
+
+    /**
+     * @brief Sağlayıcıdaki layer'ları kesildikçe G-code'a yaz
+     * @throws std::runtime_error Dosya açılamaz ya da yazılamazsa
+     */
+    GCodeStats exportLayers(core::slicing::LayerProvider& provider,
+                            const std::string& filepath,
+                            const ProgressCallback& progress = nullptr);
+
+    /**
+     * @brief Hazır slicing sonucunu G-code'a yaz
+     * @throws std::runtime_error Dosya açılamaz ya da yazılamazsa
+     */
+    GCodeStats exportLayers(const core::slicing::SlicingResult& slices,
+                            const std::string& filepath,
+                            const ProgressCallback& progress = nullptr);
+
+private:
+    using LayerSource = std::function<std::shared_ptr<const core::slicing::Layer>(size_t)>;
+
+    GCodeSettings settings_;
+    core::toolpath::PerimeterGenerator perimeters_;
+    core::toolpath::InfillGenerator infill_;
+    core::toolpath::TravelOptimizer travel_;
+    core::parallel::ThreadPool& pool_;
+
+    GCodeStats run(size_t layerCount, const LayerSource& source,
+                   const std::string& filepath, const ProgressCallback& progress);
+};
+
+} // namespace gcode
+} // namespace io
@@ -0,0 +1,249 @@
+#include "GCodeWriter.h"
+#include "FastFormat.h"
+#include <cmath>
+
+namespace io {
+namespace gcode {
+
+namespace {
+
+constexpr double PI = 3.14159265358979;
+constexpr int COORD_DECIMALS = 3;       // µm çözünürlük, IntPoint ile birebir
+constexpr int E_DECIMALS = 5;
+
+int toFeedrate(float mmPerSecond)
+{
+    return static_cast<int>(std::lround(mmPerSecond * 60.0f));
+}
+
+double distanceMm(const core::polygon::IntPoint& a, const core::polygon::IntPoint& b)
+{
+    const double dx = static_cast<double>(b.x - a.x);
+    const double dy = static_cast<double>(b.y - a.y);
+    return std::sqrt(dx * dx + dy * dy) / core::polygon::UNITS_PER_MM;
+}
+
+} // namespace
+
+GCodeWriter::GCodeWriter(const std::string& filepath, const GCodeSettings& settings)
+    : out_(filepath)
+    , settings_(settings)
+    , start_(std::chrono::steady_clock::now())
+{
+    const double radius = settings_.filamentDiameter * 0.5;
+    filamentArea_ = PI * radius * radius;
+
+    travelFeed_ = toFeedrate(settings_.travelSpeed);
+    retractFeed_ = toFeedrate(settings_.retractSpeed);
+
+    const int64_t minTravel = core::polygon::toFixed(settings_.minTravelForRetract);
+    retractTravel2_ = minTravel * minTravel;
+
+    offsetX_ = core::polygon::toFixed(settings_.bedOffsetX);
+    offsetY_ = core::polygon::toFixed(settings_.bedOffsetY);
+}
+
+void GCodeWriter::begin(size_t layerCount)
+{
+    char* p = out_.reserve(MAX_LINE * 4);
+    p = appendLiteral(p, ";FLAVOR:Marlin\n;Generated by Qt3DSlicer\n;LAYER_COUNT:");
+    p = formatInt(p, static_cast<int64_t>(layerCount));
+    p = appendLiteral(p, "\nM140 S");
+    p = formatInt(p, settings_.bedTemperature);
+    p = appendLiteral(p, "\nM104 S");
+    p = formatInt(p, settings_.nozzleTemperature);
+    p = appendLiteral(p, "\nM190 S");
+    p = formatInt(p, settings_.bedTemperature);
+    p = appendLiteral(p, "\nM109 S");
+    p = formatInt(p, settings_.nozzleTemperature);
+    p = appendLiteral(p, "\nG21\nG90\nM82\nG28\nG92 E0\n");
+    out_.commit(p);
+}
+
+void GCodeWriter::writeLayer(const core::toolpath::LayerPerimeters& perimeters,
+                             const core::toolpath::LayerInfill& infill)
+{
+    if (perimeters.walls.empty() && infill.lines.empty())
+    {
+        return;
+    }
+
+    const bool firstLayer = stats_.layers == 0;
+    const double height = perimeters.thickness;
+
+    extrusionPerMm_ = settings_.extrusionWidth * height * settings_.extrusionMultiplier
+                      / filamentArea_;
+    printFeed_ = toFeedrate(firstLayer ? settings_.firstLayerSpeed : settings_.printSpeed);
+
+    // Layer başında E sıfırlanır
+    stats_.filamentMm += e_;
+    e_ = 0.0;
+
+    char* p = out_.reserve(MAX_LINE);
+    p = appendLiteral(p, ";LAYER:");
+    p = formatInt(p, static_cast<int64_t>(stats_.layers));
+    p = appendLiteral(p, "\nG92 E0\nG0");
+    p = appendFeed(p, travelFeed_);
+    p = appendLiteral(p, " Z");
+    p = formatFixed(p, perimeters.z + height, COORD_DECIMALS);
+    *p++ = '\n';
+    out_.commit(p);
+    stats_.moves++;
+
+    // İç duvarlar önce: dış duvar oturmuş bir yüzeye basılır
+    for (size_t w = perimeters.walls.size(); w-- > 0;)
+    {
+        if (w == 0)
+        {
+            writeLine(";TYPE:WALL-OUTER\n");
+        }
+        else if (w + 1 == perimeters.walls.size())
+        {
+            writeLine(";TYPE:WALL-INNER\n");
+        }
+
+        for (const core::polygon::Polygon& ring : perimeters.walls[w])
+        {
+            writeLoop(ring);
+        }
+    }
+
+    if (!infill.lines.empty())
+    {
+        writeLine(";TYPE:FILL\n");
+
+        for (const core::toolpath::InfillLine& line : infill.lines)
+        {
+            travelTo(line.start);
+            extrudeTo(line.end);
+        }
+    }
+
+    stats_.layers++;
+}
+
+GCodeStats GCodeWriter::finish()
+{
+    stats_.filamentMm += e_;
+    e_ = 0.0;
+
+    char* p = out_.reserve(MAX_LINE * 2);
+    p = appendLiteral(p, ";END\nM104 S0\nM140 S0\nG91\nG1 Z5 F600\nG90\nG28 X0 Y0\nM84\n;Filament used: ");
+    p = formatFixed(p, stats_.filamentMm / 1000.0, E_DECIMALS);
+    p = appendLiteral(p, "m\n");
+    out_.commit(p);
+
+    out_.close();
+
+    const BufferedFileWriter::Stats ioStats = out_.stats();
+    stats_.bytes = ioStats.bytes;
+    stats_.ioWaitMs = ioStats.producerWaitMs;
+    stats_.elapsedMs = std::chrono::duration<double, std::milli>(
+                           std::chrono::steady_clock::now() - start_).count();
+    return stats_;
+}
+
+void GCodeWriter::writeLine(const char* text, size_t length)
+{
+    out_.write(text, length);
+}
+
+char* GCodeWriter::appendFeed(char* p, int feed)
+{
+    if (feed != feed_)
+    {
+        p = appendLiteral(p, " F");
+        p = formatInt(p, feed);
+        feed_ = feed;
+    }
+    return p;
+}
+
+void GCodeWriter::travelTo(const core::polygon::IntPoint& target)
+{
+    if (hasPosition_ && target.x == position_.x && target.y == position_.y)
+    {
+        return;
+    }
+
+    const int64_t dx = target.x - position_.x;
+    const int64_t dy = target.y - position_.y;
+    // İlk gidişte henüz ekstrüzyon yok: geri çekilecek basınç da yok
+    const bool retract = settings_.retractLength > 0.0f && hasPosition_ &&
+                         dx * dx + dy * dy > retractTravel2_;
+
+    if (retract)
+    {
+        writeRetract(true);
+    }
+
+    char* p = out_.reserve(MAX_LINE);
+    p = appendLiteral(p, "G0");
+    p = appendFeed(p, travelFeed_);
+    p = appendLiteral(p, " X");
+    p = formatScaled(p, target.x + offsetX_, COORD_DECIMALS);
+    p = appendLiteral(p, " Y");
+    p = formatScaled(p, target.y + offsetY_, COORD_DECIMALS);
+    *p++ = '\n';
+    out_.commit(p);
+    stats_.moves++;
+
+    if (retract)
+    {
+        writeRetract(false);
+    }
+
+    position_ = target;
+    hasPosition_ = true;
+}
+
+void GCodeWriter::extrudeTo(const core::polygon::IntPoint& target)
+{
+    e_ += distanceMm(position_, target) * extrusionPerMm_;
+
+    char* p = out_.reserve(MAX_LINE);
+    p = appendLiteral(p, "G1");
+    p = appendFeed(p, printFeed_);
+    p = appendLiteral(p, " X");
+    p = formatScaled(p, target.x + offsetX_, COORD_DECIMALS);
+    p = appendLiteral(p, " Y");
+    p = formatScaled(p, target.y + offsetY_, COORD_DECIMALS);
+    p = appendLiteral(p, " E");
+    p = formatFixed(p, e_, E_DECIMALS);
+    *p++ = '\n';
+    out_.commit(p);
+    stats_.moves++;
+
+    position_ = target;
+}
+
+void GCodeWriter::writeLoop(const core::polygon::Polygon& ring)
+{
+    if (ring.size() < 3)
+    {
+        return;
+    }
+
+    travelTo(ring.front());
+    for (size_t i = 1; i < ring.size(); ++i)
+    {
+        extrudeTo(ring[i]);
+    }
+    extrudeTo(ring.front());
+}
+
+void GCodeWriter::writeRetract(bool retract)
+{
+    const double e = retract ? e_ - settings_.retractLength : e_;
+
+    char* p = out_.reserve(MAX_LINE);
+    p = appendLiteral(p, "G1");
+    p = appendFeed(p, retractFeed_);
+    p = appendLiteral(p, " E");
+    p = formatFixed(p, e, E_DECIMALS);
+    *p++ = '\n';
+    out_.commit(p);
+}
+
+} // namespace gcode
+} // namespace io
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "BufferedFileWriter.h"
+#include "core/toolpath/PerimeterGenerator.h"
+#include "core/toolpath/InfillGenerator.h"
+#include "core/geometry/aabb.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace io {
+namespace gcode {
+
+/**
+ * @brief Yazıcı ve malzeme ayarları (Marlin uyumlu G-code)
+ */
+struct GCodeSettings
+{
+    float filamentDiameter = 1.75f;     // mm
+    float extrusionMultiplier = 1.0f;
+    float extrusionWidth = 0.4f;        // mm, duvar ve infill çizgisi
+
+    float printSpeed = 50.0f;           // mm/s
+    float firstLayerSpeed = 20.0f;      // mm/s
+    float travelSpeed = 150.0f;         // mm/s
+
+    float retractLength = 1.0f;         // mm filament (0 = kapalı)
+    float retractSpeed = 40.0f;         // mm/s
+    float minTravelForRetract = 1.5f;   // mm, daha kısa boşta gidişte geri çekme yok
+
+    int nozzleTemperature = 210;        // °C
+    int bedTemperature = 60;            // °C
+
+    // Dünya (tabla merkezli) X/Y'ye eklenen kaydırma, mm. Marlin'de G28
+    // sonrası (0,0) tablanın ön-sol köşesidir; varsayılan, panelin
+    // varsayılan 200×200 tablasının min köşesini (0,0)'a taşır
+    float bedOffsetX = 100.0f;
+    float bedOffsetY = 100.0f;
+
+    /**
+     * @brief Tablanın min köşesini yazıcı orijinine (0,0) eşle
+     */
+    void alignToPlate(const core::geometry::AABB& plateBounds)
+    {
+        bedOffsetX = -plateBounds.min.x;
+        bedOffsetY = -plateBounds.min.y;
+    }
+};
+
+struct GCodeStats
+{
+    size_t layers = 0;
+    size_t moves = 0;                   // G0/G1 satırı
+    uint64_t bytes = 0;
+    double filamentMm = 0.0;            // Toplam ekstrüzyon
+    double elapsedMs = 0.0;
+    double ioWaitMs = 0.0;              // Formatlayıcının diski beklediği süre
+
+    double megabytesPerSecond() const
+    {
+        return elapsedMs > 0.0 ? bytes / (1024.0 * 1024.0) / (elapsedMs / 1000.0) : 0.0;
+    }
+};
+
+/**
+ * @brief Duvar ve infill yollarını akış halinde G-code'a çevirir
+ *
+ * Layer'lar geldikçe (alttan üste, sırayla) writeLayer() ile yazılır;
+ * tüm baskının bellekte tutulması gerekmez. Satırlar FastFormat ile
+ * doğrudan yazma tamponuna formatlanır, disk yazımı BufferedFileWriter'ın
+ * arka plan thread'inde olur.
+ *
+ * E mutlak (M82) tutulur ve her layer başında G92 E0 ile sıfırlanır;
+ * uzun baskılarda E değeri büyüyüp hassasiyet kaybetmez.
+ */
+class GCodeWriter
+{
+public:
+    /**
+     * @throws std::runtime_error Dosya açılamazsa
+     */
+    GCodeWriter(const std::string& filepath, const GCodeSettings& settings);
+
+    /**
+     * @brief Başlangıç G-code'u (ısıtma, home, mod ayarları)
+     * @param layerCount Başlıktaki ;LAYER_COUNT için
+     */
+    void begin(size_t layerCount);
+
+    /**
+     * @brief Bir layer'ın yollarını yaz
+     *
+     * Sıra: iç duvarlar → dış duvar → infill. Boş layer atlanır.
+     */
+    void writeLayer(const core::toolpath::LayerPerimeters& perimeters,
+                    const core::toolpath::LayerInfill& infill);
+
+    /**
+     * @brief Bitiş G-code'u, tamponları boşalt, dosyayı kapat
+     * @throws std::runtime_error Yazma başarısızsa
+     */
+    GCodeStats finish();
+
+    const GCodeStats& stats() const { return stats_; }
+
+private:
+    // Tek satırın üst sınırı (komut + 4 sayı)
+    static constexpr size_t MAX_LINE = 128;
+
+    BufferedFileWriter out_;
+    GCodeSettings settings_;
+    GCodeStats stats_;
+    std::chrono::steady_clock::time_point start_;
+
+    double filamentArea_ = 0.0;         // mm²
+    double extrusionPerMm_ = 0.0;       // Aktif layer: yol mm'si başına filament mm
+    int printFeed_ = 0;                 // Aktif layer, mm/dk
+    int travelFeed_ = 0;
+    int retractFeed_ = 0;
+    int64_t retractTravel2_ = 0;        // minTravelForRetract², µm²
+    int64_t offsetX_ = 0;               // bedOffsetX, µm
+    int64_t offsetY_ = 0;
+
+    // Nozül durumu
+    core::polygon::IntPoint position_;
+    bool hasPosition_ = false;
+    double e_ = 0.0;                    // Layer içi mutlak E
+    int feed_ = -1;                     // Son yazılan F (tekrar yazılmaz)
+
+    void writeLine(const char* text, size_t length);
+
+    template <size_t N>
+    void writeLine(const char (&text)[N]) { writeLine(text, N - 1); }
+
+    char* appendFeed(char* p, int feed);
+
+    void travelTo(const core::polygon::IntPoint& target);
+    void extrudeTo(const core::polygon::IntPoint& target);
+    void writeLoop(const core::polygon::Polygon& ring);
+    void writeRetract(bool retract);
+};
+
+} // namespace gcode
+} // namespace io
@@ -49,7 +49,7 @@ void CachedLoadingStrategy::load(
     m_wrappedStrategy->load(
         filepath,
         onProgress,
-        [filepath, onComplete](core::mesh::Mesh mesh, bool success, std::string error) {
+        [filepath, onComplete](core::mesh::SharedMesh mesh, bool success, std::string error) {
             if (!success)
             {
                 if (onComplete)
@@ -58,7 +58,7 @@ void CachedLoadingStrategy::load(
             }
 
             // Save to cache for next time
-            cache::MeshCache::saveCache(filepath, mesh);
+            cache::MeshCache::saveCache(filepath, *mesh);
 
             // Return the loaded mesh
             if (onComplete)
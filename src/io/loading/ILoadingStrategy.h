@@ -2,14 +2,15 @@
 
 #include <string>
 #include <functional>
-#include "core/mesh/mesh.h"
+#include "core/mesh/SharedMesh.h"
 
 namespace io {
 namespace loading {
 
 // Callback türleri
 using ProgressCallback = std::function<void(int percentage)>;
-using CompletionCallback = std::function<void(core::mesh::Mesh mesh, bool success, std::string error)>;
+// Mesh paylaşımlıdır (copy-on-write): UI, renderer ve arka plan işleri tek kopyayı kullanır
+using CompletionCallback = std::function<void(core::mesh::SharedMesh mesh, bool success, std::string error)>;
 
 /**
  * @brief Loading strategy interface
@@ -3,6 +3,8 @@
 #include <QVector3D>
 //#include "core/buildplate/RectangularPlate.h"
 #include "core/buildplate/CircularPlate.h"
+#include "core/geometry/kernels.h"
+#include "core/mesh/NormalProcessor.h"
 #include <cmath>
 #include <chrono>
 #include <QPainter>
@@ -40,6 +42,15 @@ void MeshRenderer::setMesh(const core::mesh::Mesh& mesh)
     makeCurrent();
     buildVertexBuffer(mesh);
     doneCurrent();
+
+    bvh_.build(mesh.triangles.data(), mesh.triangles.size());
+    if (!bvh_.empty())
+    {
+        const auto& stats = bvh_.stats();
+        qDebug() << "🌳 BVH:" << stats.nodes << "nodes," << stats.leaves << "leaves, depth"
+                 << stats.maxDepth << "in" << stats.buildMs << "ms";
+    }
+
     update();
 }
 
@@ -142,12 +153,16 @@ void MeshRenderer::paintGL()
     model.rotate(modelRotation_.x(), 1, 0, 0);  // X rotation
 
     // ============================================
-    // 3. LAYERS RENDERING (TRANSFORM UYGULANIR)
+    // 3. LAYERS RENDERING (DÜNYA KOORDİNATI)
     // ============================================
     if (renderMode_ == RenderMode::Layers && layerVertexCount_ > 0)
     {
+        // Layer'lar PlacedMesh ile zaten transform uygulanmış geometriden gelir
+        QMatrix4x4 layerModel;
+        layerModel.setToIdentity();
+
         layerShaderProgram_->bind();
-        layerShaderProgram_->setUniformValue("model", model);  // ← TRANSFORM UYGULANIR
+        layerShaderProgram_->setUniformValue("model", layerModel);
         layerShaderProgram_->setUniformValue("view", view);
         layerShaderProgram_->setUniformValue("projection", projection);
 
@@ -225,36 +240,45 @@ void MeshRenderer::wheelEvent(QWheelEvent* event)
 
 void MeshRenderer::buildVertexBuffer(const core::mesh::Mesh& mesh)
 {
-    vertices_.clear();
+    // Smooth shading: köşe başına normal, 30°'den keskin kenarlar sert kalır.
+    // Kapalıyken saklı facet normali (export edilen) olduğu gibi çizilir
+    std::vector<core::geometry::Vec3> cornerNormals;
+    if (smoothShading_)
+    {
+        core::mesh::NormalProcessor().computeVertexNormals(mesh, cornerNormals, 30.0f);
+    }
+    const bool smooth = cornerNormals.size() == mesh.triangles.size() * 3;
 
     // Each triangle: 3 vertices, each vertex: position (3) + normal (3)
-    vertices_.reserve(mesh.triangles.size() * 3 * 6);
-
-    for (const auto& tri : mesh.triangles)
-    {
-        // Vertex 1
-        vertices_.push_back(tri.vertex1.x);
-        vertices_.push_back(tri.vertex1.y);
-        vertices_.push_back(tri.vertex1.z);
-        vertices_.push_back(tri.normal.x);
-        vertices_.push_back(tri.normal.y);
-        vertices_.push_back(tri.normal.z);
-
-        // Vertex 2
-        vertices_.push_back(tri.vertex2.x);
-        vertices_.push_back(tri.vertex2.y);
-        vertices_.push_back(tri.vertex2.z);
-        vertices_.push_back(tri.normal.x);
-        vertices_.push_back(tri.normal.y);
-        vertices_.push_back(tri.normal.z);
-
-        // Vertex 3
-        vertices_.push_back(tri.vertex3.x);
-        vertices_.push_back(tri.vertex3.y);
-        vertices_.push_back(tri.vertex3.z);
-        vertices_.push_back(tri.normal.x);
-        vertices_.push_back(tri.normal.y);
-        vertices_.push_back(tri.normal.z);
+    // Sadece yükleme için; GPU'ya kopyalandıktan sonra bırakılır (mesh'in ikinci kopyası tutulmaz)
+    std::vector<float> vertices;
+    vertices.reserve(mesh.triangles.size() * 3 * 6);
+
+    for (size_t i = 0; i < mesh.triangles.size(); ++i)
+    {
+        const auto& tri = mesh.triangles[i];
+        const core::geometry::Vec3* corners[3] = {&tri.vertex1, &tri.vertex2, &tri.vertex3};
+
+        // Saklı normal (örn. Flip Normals sonrası) sarımla çelişirse onu izle
+        float sign = 1.0f;
+        if (smooth)
+        {
+            const float side = cornerNormals[3 * i].x * tri.normal.x +
+                               cornerNormals[3 * i].y * tri.normal.y +
+                               cornerNormals[3 * i].z * tri.normal.z;
+            sign = side < 0.0f ? -1.0f : 1.0f;
+        }
+
+        for (int k = 0; k < 3; ++k)
+        {
+            const core::geometry::Vec3& source = smooth ? cornerNormals[3 * i + k] : tri.normal;
+            vertices.push_back(corners[k]->x);
+            vertices.push_back(corners[k]->y);
+            vertices.push_back(corners[k]->z);
+            vertices.push_back(sign * source.x);
+            vertices.push_back(sign * source.y);
+            vertices.push_back(sign * source.z);
+        }
     }
 
     vertexCount_ = static_cast<int>(mesh.triangles.size() * 3);
@@ -262,7 +286,7 @@ void MeshRenderer::buildVertexBuffer(const core::mesh::Mesh& mesh)
     // Upload to GPU
     vao_.bind();
     vbo_.bind();
-    vbo_.allocate(vertices_.data(), vertices_.size() * sizeof(float));
+    vbo_.allocate(vertices.data(), vertices.size() * sizeof(float));
 
     // Position attribute
     shaderProgram_->enableAttributeArray(0);
@@ -396,7 +420,7 @@ void MeshRenderer::buildLayerBuffer()
             // Start point
             layerVertices_.push_back(segment.start.x);
             layerVertices_.push_back(segment.start.y);
-            layerVertices_.push_back(segment.start.z);
+            layerVertices_.push_back(layer.zHeight());
             layerVertices_.push_back(r);
             layerVertices_.push_back(g);
             layerVertices_.push_back(b);
@@ -404,7 +428,7 @@ void MeshRenderer::buildLayerBuffer()
             // End point
             layerVertices_.push_back(segment.end.x);
             layerVertices_.push_back(segment.end.y);
-            layerVertices_.push_back(segment.end.z);
+            layerVertices_.push_back(layer.zHeight());
             layerVertices_.push_back(r);
             layerVertices_.push_back(g);
             layerVertices_.push_back(b);
@@ -667,21 +691,12 @@ void MeshRenderer::centerModel(const core::mesh::Mesh& mesh)
     if (mesh.triangles.empty())
         return;
 
-    float minX = FLT_MAX, maxX = -FLT_MAX;
-    float minY = FLT_MAX, maxY = -FLT_MAX;
+    // Calculate bounds (shared SIMD kernel)
+    const core::geometry::AABB bounds =
+        core::geometry::kernels::computeBounds(mesh.triangles.data(), mesh.triangles.size());
 
-    // Calculate bounds
-    for (const auto& tri : mesh.triangles)
-    {
-        // vertex1, vertex2, vertex3 kullan ← DOĞRU HAL!
-        minX = std::min({minX, tri.vertex1.x, tri.vertex2.x, tri.vertex3.x});
-        maxX = std::max({maxX, tri.vertex1.x, tri.vertex2.x, tri.vertex3.x});
-        minY = std::min({minY, tri.vertex1.y, tri.vertex2.y, tri.vertex3.y});
-        maxY = std::max({maxY, tri.vertex1.y, tri.vertex2.y, tri.vertex3.y});
-    }
-
-    float centerX = (minX + maxX) / 2.0f;
-    float centerY = (minY + maxY) / 2.0f;
+    float centerX = (bounds.min.x + bounds.max.x) / 2.0f;
+    float centerY = (bounds.min.y + bounds.max.y) / 2.0f;
 
     modelTranslation_.setX(-centerX);
     modelTranslation_.setY(-centerY);
@@ -742,11 +757,12 @@ void MeshRenderer::mousePressEvent(QMouseEvent* event)
             }
         }
 
-        // Mesh seçimi
-        if (vertexCount_ > 0)
+        // Mesh seçimi: sadece yüzeye isabet eden tıklama
+        QVector3D hitPoint;
+        if (pickMesh(event->pos(), hitPoint))
         {
             setMeshSelected(true);
-            qDebug() << "✅ Mesh selected!";
+            qDebug() << "✅ Mesh selected at:" << hitPoint;
             update();
             return;
         }
@@ -764,6 +780,66 @@ void MeshRenderer::mousePressEvent(QMouseEvent* event)
         isRotatingCamera_ = true;
     }
 }
+
+bool MeshRenderer::pickMesh(const QPoint& pos, QVector3D& hitPoint) const
+{
+    if (bvh_.empty() || width() <= 0 || height() <= 0)
+    {
+        return false;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // paintGL ile aynı model matrisi
+    QMatrix4x4 model;
+    model.translate(modelTranslation_);
+    model.rotate(modelRotation_.z(), 0, 0, 1);
+    model.rotate(modelRotation_.y(), 0, 1, 0);
+    model.rotate(modelRotation_.x(), 1, 0, 0);
+
+    QMatrix4x4 view = camera_.viewMatrix();
+    QMatrix4x4 projection = camera_.projectionMatrix(
+        static_cast<float>(width()) / static_cast<float>(height())
+        );
+
+    bool invertible = false;
+    const QMatrix4x4 inverse = (projection * view * model).inverted(&invertible);
+    if (!invertible)
+    {
+        return false;
+    }
+
+    // Piksel → NDC; near ve far düzlemi model uzayına geri
+    const float ndcX = 2.0f * static_cast<float>(pos.x()) / static_cast<float>(width()) - 1.0f;
+    const float ndcY = 1.0f - 2.0f * static_cast<float>(pos.y()) / static_cast<float>(height());
+    const QVector3D nearPoint = inverse.map(QVector3D(ndcX, ndcY, -1.0f));
+    const QVector3D farPoint = inverse.map(QVector3D(ndcX, ndcY, 1.0f));
+
+    core::geometry::Ray ray;
+    ray.origin = core::geometry::Vec3(nearPoint.x(), nearPoint.y(), nearPoint.z());
+    ray.direction = core::geometry::Vec3(farPoint.x() - nearPoint.x(),
+                                         farPoint.y() - nearPoint.y(),
+                                         farPoint.z() - nearPoint.z());
+
+    core::geometry::RayHit hit;
+    const bool found = bvh_.intersect(ray, hit, 1.0f);
+
+    const auto endTime = std::chrono::steady_clock::now();
+    const double micros = std::chrono::duration<double, std::micro>(endTime - startTime).count();
+
+    if (!found)
+    {
+        qDebug() << "🎯 Pick: miss (" << micros << "µs)";
+        return false;
+    }
+
+    // Dünya koordinatında isabet noktası
+    const core::geometry::Vec3 local = hit.point(ray);
+    hitPoint = model.map(QVector3D(local.x, local.y, local.z));
+    qDebug() << "🎯 Pick: triangle" << hit.triangle << "(" << micros << "µs)";
+    return true;
+}
+
 void MeshRenderer::mouseMoveEvent(QMouseEvent* event)
 {
     QPoint delta = event->pos() - lastMousePos_;
@@ -15,6 +15,7 @@
 
 #include "core/mesh/mesh.h"
 #include "core/slicing/Layer.h"  // ← YENİ!
+#include "core/geometry/BVH.h"
 #include "Camera.h"
 
 namespace rendering {
@@ -37,6 +38,12 @@ public:
     };
 
     void setRenderMode(RenderMode mode);
+    RenderMode renderMode() const { return renderMode_; }
+
+    // Köşe başına (30° kırışıklıklı) normal; kapalıyken saklı facet normali.
+    // Bir sonraki setMesh'te uygulanır
+    void setSmoothShading(bool smooth) { smoothShading_ = smooth; }
+    bool smoothShading() const { return smoothShading_; }
 
     // Layer rendering ← YENİ!
     void setLayers(const std::vector<core::slicing::Layer>& layers);
@@ -83,9 +90,11 @@ private:
     QOpenGLBuffer vbo_;
     QOpenGLShaderProgram* shaderProgram_ = nullptr;
 
-    std::vector<float> vertices_;
     int vertexCount_ = 0;
 
+    // Picking: ekrandaki mesh'in triangle'ları üzerinde BVH
+    core::geometry::BVH bvh_;
+
     // Layer OpenGL resources ← YENİ!
     QOpenGLVertexArrayObject layerVao_;
     QOpenGLBuffer layerVbo_;
@@ -102,6 +111,7 @@ private:
 
     // Render state
     RenderMode renderMode_ = RenderMode::Solid;
+    bool smoothShading_ = false;
 
     // Mouse interaction
     QPoint lastMousePos_;
@@ -110,6 +120,7 @@ private:
     // Helper functions
     void buildVertexBuffer(const core::mesh::Mesh& mesh);
     void buildLayerBuffer();  // ← YENİ!
+    bool pickMesh(const QPoint& pos, QVector3D& hitPoint) const;
     void createShaders();
     void createLayerShaders();  // ← YENİ!
     void createPlateShaders();
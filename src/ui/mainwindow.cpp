@@ -7,7 +7,16 @@
 #include "core/mesh/MeshAnalyzer.h"
 #include "core/mesh/NormalProcessor.h"
 #include "core/mesh/MeshRepairer.h"
+#include "core/mesh/MeshSplitter.h"
+#include "core/mesh/IndexedMesh.h"
+#include "core/mesh/MeshDecimator.h"
+#include "core/mesh/MeshReorder.h"
+#include "core/mesh/MeshTransform.h"
+#include "core/buildplate/PlateArranger.h"
+#include "core/buildplate/PlateContainment.h"
 #include "core/slicing/Slicer.h"
+#include "core/geometry/kernels.h"
+#include "io/g_code/GCodeExporter.h"
 #include "ui/widgets/BuildPlatePanel.h"
 
 #include <QVBoxLayout>
@@ -18,14 +27,17 @@
 #include <QStatusBar>
 #include <QFileInfo>
 #include <QLabel>
+#include <QCheckBox>
 #include "QSlider"
 #include <QDebug>
 #include <chrono>
+#include <algorithm>
 #include <QByteArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QFile>
+#include <QStringList>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -87,9 +99,14 @@ MainWindow::MainWindow(QWidget *parent)
     btnCachedSync->setMinimumHeight(35);
     btnCachedAsync->setMinimumHeight(35);
 
+    checkSpatialReorder_ = new QCheckBox("Spatial Reorder", this);
+    checkSpatialReorder_->setChecked(true);
+    checkSpatialReorder_->setToolTip("After loading, sort triangles along a Morton curve so nearby faces sit together in memory");
+
     buttonLayout->addWidget(btnCachedSync);
     buttonLayout->addWidget(btnCachedAsync);
     buttonLayout->addWidget(btnResetCamera);
+    buttonLayout->addWidget(checkSpatialReorder_);
     buttonLayout->addStretch();
 
     rightLayout->addLayout(buttonLayout);
@@ -99,18 +116,23 @@ MainWindow::MainWindow(QWidget *parent)
     buttonLayout2->setSpacing(5);
 
     btnRecalcNormals_ = new QPushButton("Recalculate Normals", this);
-    btnSmoothNormals_ = new QPushButton("Smooth Normals", this);
+    btnSmoothNormals_ = new QPushButton("Smooth Shading", this);
+    btnSmoothNormals_->setCheckable(true);
+    btnSmoothNormals_->setToolTip("Per-vertex normals in the viewport (30° creases); stored facet normals are not changed");
     btnFlipNormals_ = new QPushButton("Flip Normals", this);
+    btnOrientWinding_ = new QPushButton("Fix Orientation", this);
     btnRepairMesh_ = new QPushButton("🔧 Repair Mesh", this);
 
     btnRecalcNormals_->setMinimumHeight(35);
     btnSmoothNormals_->setMinimumHeight(35);
     btnFlipNormals_->setMinimumHeight(35);
+    btnOrientWinding_->setMinimumHeight(35);
     btnRepairMesh_->setMinimumHeight(35);
 
     buttonLayout2->addWidget(btnRecalcNormals_);
     buttonLayout2->addWidget(btnSmoothNormals_);
     buttonLayout2->addWidget(btnFlipNormals_);
+    buttonLayout2->addWidget(btnOrientWinding_);
     buttonLayout2->addWidget(btnRepairMesh_);
     buttonLayout2->addStretch();
 
@@ -134,9 +156,44 @@ MainWindow::MainWindow(QWidget *parent)
     btnExportLayers_->setStyleSheet("QPushButton { font-weight: bold; background-color: #FF9800; color: white; }");
     btnExportLayers_->setEnabled(false);
 
+    btnExportGCode_ = new QPushButton("🧾 Export G-code", this);
+    btnExportGCode_->setMinimumHeight(35);
+    btnExportGCode_->setStyleSheet("QPushButton { font-weight: bold; background-color: #795548; color: white; }");
+    btnExportGCode_->setToolTip("Streams G-code while layers are still being sliced");
+    btnExportGCode_->setEnabled(false);
+
+    spinLayerHeight_ = new QDoubleSpinBox(this);
+    spinLayerHeight_->setRange(core::slicing::MIN_LAYER_HEIGHT, 1.0);
+    spinLayerHeight_->setDecimals(2);
+    spinLayerHeight_->setSingleStep(0.01);
+    spinLayerHeight_->setValue(0.03);
+    spinLayerHeight_->setSuffix(" mm");
+    spinLayerHeight_->setToolTip("Layer height (re-slices incrementally after the first slice)");
+
+    checkAdaptiveLayers_ = new QCheckBox("Adaptive Layers", this);
+    checkAdaptiveLayers_->setToolTip("Layer height follows surface slope: thick on walls, thin on shallow domes");
+
+    checkUnionShells_ = new QCheckBox("Union Shells", this);
+    checkUnionShells_->setToolTip("Merge overlapping bodies into one clean outline per layer");
+
+    spinSimplifyTolerance_ = new QDoubleSpinBox(this);
+    spinSimplifyTolerance_->setRange(0.0, 0.1);
+    spinSimplifyTolerance_->setDecimals(3);
+    spinSimplifyTolerance_->setSingleStep(0.005);
+    spinSimplifyTolerance_->setValue(0.0);
+    spinSimplifyTolerance_->setPrefix("Simplify ");
+    spinSimplifyTolerance_->setSuffix(" mm");
+    spinSimplifyTolerance_->setSpecialValueText("Simplify off");
+    spinSimplifyTolerance_->setToolTip("Max contour deviation when dropping tiny segments (scan data)");
+
     buttonLayout3->addWidget(btnSliceMesh_);
+    buttonLayout3->addWidget(spinLayerHeight_);
+    buttonLayout3->addWidget(checkAdaptiveLayers_);
+    buttonLayout3->addWidget(checkUnionShells_);
+    buttonLayout3->addWidget(spinSimplifyTolerance_);
     buttonLayout3->addWidget(btnShowLayers_);
     buttonLayout3->addWidget(btnExportLayers_);
+    buttonLayout3->addWidget(btnExportGCode_);
     buttonLayout3->addStretch();
 
     rightLayout->addLayout(buttonLayout3);
@@ -222,9 +279,11 @@ MainWindow::MainWindow(QWidget *parent)
     QHBoxLayout* transformButtons = new QHBoxLayout();
     btnCenterModel_ = new QPushButton("📍 Center", this);
     btnResetTransform_ = new QPushButton("🔄 Reset", this);
+    btnArrangeParts_ = new QPushButton("🧩 Arrange", this);
 
     transformButtons->addWidget(btnCenterModel_);
     transformButtons->addWidget(btnResetTransform_);
+    transformButtons->addWidget(btnArrangeParts_);
     transformButtons->addStretch();
 
     transformBox->addLayout(transformButtons);
@@ -282,12 +341,20 @@ MainWindow::MainWindow(QWidget *parent)
     connect(btnRecalcNormals_, &QPushButton::clicked, this, &MainWindow::onRecalculateNormals);
     connect(btnSmoothNormals_, &QPushButton::clicked, this, &MainWindow::onSmoothNormals);
     connect(btnFlipNormals_, &QPushButton::clicked, this, &MainWindow::onFlipNormals);
+    connect(btnOrientWinding_, &QPushButton::clicked, this, &MainWindow::onOrientWinding);
 
     connect(btnRepairMesh_, &QPushButton::clicked, this, &MainWindow::onRepairMesh);
 
     connect(btnSliceMesh_, &QPushButton::clicked, this, &MainWindow::onSliceMesh);
+    connect(spinLayerHeight_, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
+            this, &MainWindow::onSlicingSettingsChanged);
+    connect(checkAdaptiveLayers_, &QCheckBox::toggled, this, &MainWindow::onSlicingSettingsChanged);
+    connect(checkUnionShells_, &QCheckBox::toggled, this, &MainWindow::onSlicingSettingsChanged);
+    connect(spinSimplifyTolerance_, QOverload<double>::of(&QDoubleSpinBox::valueChanged),
+            this, &MainWindow::onSlicingSettingsChanged);
     connect(btnShowLayers_, &QPushButton::clicked, this, &MainWindow::onShowLayers);
     connect(btnExportLayers_, &QPushButton::clicked, this, &MainWindow::onExportLayers);
+    connect(btnExportGCode_, &QPushButton::clicked, this, &MainWindow::onExportGCode);
     connect(sliderLayer_, &QSlider::valueChanged, this, &MainWindow::onLayerChanged);
 
     // Transform signals - 6-DOF!
@@ -307,6 +374,7 @@ MainWindow::MainWindow(QWidget *parent)
 
     connect(btnCenterModel_, &QPushButton::clicked, this, &MainWindow::onCenterModel);
     connect(btnResetTransform_, &QPushButton::clicked, this, &MainWindow::onResetTransform);
+    connect(btnArrangeParts_, &QPushButton::clicked, this, &MainWindow::onArrangeParts);
 
     // Gizmo signal
     connect(meshRenderer_, &rendering::MeshRenderer::modelTransformed,
@@ -327,6 +395,8 @@ MainWindow::MainWindow(QWidget *parent)
 
 MainWindow::~MainWindow()
 {
+    // Arka plan slicing thread'i UI yok edilmeden durmalı
+    resetSlicing();
 }
 
 // ... (onLoadModel, onWireframe, onSolid, etc. - HİÇ DEĞİŞMEDİ)
@@ -335,36 +405,42 @@ void MainWindow::onMoveXChanged(double value)
 {
     QVector3D pos = meshRenderer_->getModelTranslation();
     meshRenderer_->setModelTranslation(value, pos.y(), pos.z());  // ← z eklendi!
+    checkBuildVolume();
 }
 
 void MainWindow::onMoveYChanged(double value)
 {
     QVector3D pos = meshRenderer_->getModelTranslation();
     meshRenderer_->setModelTranslation(pos.x(), value, pos.z());  // ← z eklendi!
+    checkBuildVolume();
 }
 
 void MainWindow::onMoveZChanged(double value)  // ← YENİ!
 {
     QVector3D pos = meshRenderer_->getModelTranslation();
     meshRenderer_->setModelTranslation(pos.x(), pos.y(), value);
+    checkBuildVolume();
 }
 
 void MainWindow::onRotateXChanged(double value)  // ← YENİ!
 {
     QVector3D rot = meshRenderer_->getModelRotation();
     meshRenderer_->setModelRotation(value, rot.y(), rot.z());
+    checkBuildVolume();
 }
 
 void MainWindow::onRotateYChanged(double value)  // ← YENİ!
 {
     QVector3D rot = meshRenderer_->getModelRotation();
     meshRenderer_->setModelRotation(rot.x(), value, rot.z());
+    checkBuildVolume();
 }
 
 void MainWindow::onRotateZChanged(double value)
 {
     QVector3D rot = meshRenderer_->getModelRotation();  // ← DEĞİŞTİ!
     meshRenderer_->setModelRotation(rot.x(), rot.y(), value);  // ← DEĞİŞTİ!
+    checkBuildVolume();
 }
 
 void MainWindow::onResetTransform()
@@ -391,6 +467,81 @@ void MainWindow::onResetTransform()
     spinRotateX_->blockSignals(false);   // ← YENİ!
     spinRotateY_->blockSignals(false);   // ← YENİ!
     spinRotateZ_->blockSignals(false);
+
+    checkBuildVolume(true);
+}
+
+void MainWindow::onArrangeParts()
+{
+    if (currentMesh_->triangleCount() == 0)
+    {
+        QMessageBox::warning(this, "No Mesh", "Please load a model first.");
+        return;
+    }
+
+    if (!currentPlate_)
+    {
+        QMessageBox::warning(this, "No Build Plate", "Please create a build plate first.");
+        return;
+    }
+
+    statusBar()->showMessage("Arranging parts...");
+
+    core::mesh::MeshSplitter splitter;
+    core::mesh::MeshSplitResult split = splitter.split(*currentMesh_);
+
+    core::buildplate::PlateArranger arranger;
+    std::vector<core::polygon::Polygon> footprints(split.parts.size());
+    for (size_t i = 0; i < split.parts.size(); ++i)
+    {
+        footprints[i] = arranger.footprint(split.parts[i].mesh);
+    }
+
+    auto result = arranger.arrange(footprints, *currentPlate_);
+    if (!result.success())
+    {
+        QMessageBox::warning(this, "Arrange Failed", QString::fromStdString(result.errorMessage));
+        statusBar()->showMessage("Arrange failed");
+        return;
+    }
+
+    // Yerleşim mesh'e işlenir; yerleşemeyen parçalar yerinde kalır
+    for (size_t i = 0; i < split.parts.size(); ++i)
+    {
+        if (result.placements[i].placed)
+        {
+            core::mesh::MeshTransform::apply(split.parts[i].mesh, result.placements[i].transform.toAffine());
+        }
+    }
+
+    core::mesh::Mesh arranged = core::mesh::MeshSplitter::merge(split.parts);
+    arranged.name = currentMesh_->name;
+
+    resetSlicing();
+    currentMesh_ = std::move(arranged);
+    triangleOrder_.clear();
+    onResetTransform();
+
+    rebuildViewportMesh();
+
+    updateMeshInfo();
+
+    qDebug() << "🧩 Arranged:" << result.placedCount << "/" << split.partCount() << "parts,"
+             << "utilization" << result.utilization << "in" << result.elapsedMs << "ms";
+
+    QString msg = QString("Placed %1 / %2 parts (plate utilization %3%) in %4 ms")
+                      .arg(result.placedCount)
+                      .arg(split.partCount())
+                      .arg(result.utilization * 100.0, 0, 'f', 1)
+                      .arg(split.elapsedMs + result.elapsedMs, 0, 'f', 1);
+    if (!result.allPlaced())
+    {
+        msg += QString("\n%1 parts did not fit and were left in place")
+                   .arg(split.partCount() - result.placedCount);
+    }
+
+    statusBar()->showMessage(QString("Arranged %1 / %2 parts").arg(result.placedCount).arg(split.partCount()));
+    QMessageBox::information(this, "Parts Arranged", msg);
 }
 
 void MainWindow::onModelTransformedByGizmo(QVector3D translation, QVector3D rotation)  // ← PARAMETRE DEĞİŞTİ!
@@ -430,6 +581,8 @@ void MainWindow::onModelTransformedByGizmo(QVector3D translation, QVector3D rota
         spinRotateZ_->setValue(rotation.z());
         spinRotateZ_->blockSignals(false);
     }
+
+    checkBuildVolume();   // Sürükleme sırasında canlı
 }
 
 void MainWindow::onLoadModel()
@@ -451,7 +604,9 @@ void MainWindow::onLoadModel()
     auto startTime = std::chrono::high_resolution_clock::now();
 
     try {
+        resetSlicing();   // Arka plan slicing mesh'i okuyor olabilir
         currentMesh_ = io::models::ModelFactory::loadModel(fileName.toStdString());
+        applySpatialReorder();
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -460,14 +615,52 @@ void MainWindow::onLoadModel()
 
         qDebug() << "⏱️  Load time:" << durationMs << "ms";
 
-        meshRenderer_->setMesh(currentMesh_);
+        rebuildViewportMesh();
+
         updateMeshInfo();
 
         core::mesh::MeshValidator validator;
-        auto validResult = validator.validate(currentMesh_);
+        auto validResult = validator.validate(*currentMesh_);
+
+        // Rapor dosyadaki triangle sırasıyla (spatial reorder sonrası eşlenir)
+        std::vector<uint32_t> fileIndices;
+        fileIndices.reserve(validResult.selfIntersectingTriangles.size());
+        for (uint32_t index : validResult.selfIntersectingTriangles)
+        {
+            fileIndices.push_back(fileTriangleIndex(index));
+        }
+        std::sort(fileIndices.begin(), fileIndices.end());
+
+        QStringList intersectingTriangles;
+        for (uint32_t index : fileIndices)
+        {
+            intersectingTriangles << QString::number(index);
+        }
+
+        if (validResult.selfIntersections > 0)
+        {
+            qDebug() << "⚠️ Self-intersections:" << validResult.selfIntersections << "pairs,"
+                     << validResult.selfIntersectingTriangles.size() << "triangles"
+                     << "(file indices:" << intersectingTriangles.mid(0, 20).join(", ") << ")";
+        }
+
+        // Çok parçalı dosya mı? (sadece etiketleme, parçalar kopyalanmaz)
+        size_t partCount = 0;
+        core::mesh::MeshSplitter().labelComponents(*currentMesh_, partCount);
+        qDebug() << "🧩 Parts:" << partCount;
+
+        auto analysisStart = std::chrono::high_resolution_clock::now();
 
         core::mesh::MeshAnalyzer analyzer;
-        auto stats = analyzer.analyze(currentMesh_);
+        auto stats = analyzer.analyze(*meshView());
+
+        auto analysisUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::high_resolution_clock::now() - analysisStart
+                              ).count();
+
+        qDebug() << "⏱️  Analysis time:" << analysisUs << "µs ("
+                 << core::geometry::kernels::isaName(core::geometry::kernels::activeIsa())
+                 << "kernels)";
 
         QString statusMsg = QString("Loaded: %1 - %2 triangles, Volume: %3 mm³")
                                 .arg(QFileInfo(fileName).fileName())
@@ -479,7 +672,8 @@ void MainWindow::onLoadModel()
         message += "=== MODEL STATISTICS ===\n\n";
         message += QString("File: %1\n\n").arg(QFileInfo(fileName).fileName());
         message += QString("Triangles: %1\n").arg(stats.triangleCount);
-        message += QString("Vertices: ~%1\n\n").arg(stats.vertexCount);
+        message += QString("Vertices: ~%1\n").arg(stats.vertexCount);
+        message += QString("Parts: %1\n\n").arg(partCount);
         message += "=== BOUNDING BOX ===\n";
         message += QString("Min: (%1, %2, %3)\n")
                        .arg(stats.bounds.min.x, 0, 'f', 2)
@@ -508,7 +702,14 @@ void MainWindow::onLoadModel()
         message += QString("Status: %1\n").arg(validResult.isValid ? "VALID" : "HAS ERRORS");
         message += QString("Degenerate triangles: %1\n").arg(validResult.degenerateTriangles);
         message += QString("Invalid vertices: %1\n").arg(validResult.invalidVertices);
-        message += QString("Duplicate vertices: %1").arg(validResult.duplicateVertices);
+        message += QString("Duplicate vertices: %1\n").arg(validResult.duplicateVertices);
+        message += QString("Self-intersecting pairs: %1").arg(validResult.selfIntersections);
+        if (!intersectingTriangles.isEmpty())
+        {
+            message += QString("\nIntersecting triangles (file order): %1%2")
+                           .arg(intersectingTriangles.mid(0, 20).join(", "))
+                           .arg(intersectingTriangles.size() > 20 ? ", ..." : "");
+        }
 
         QMessageBox::information(this, "Model Analysis", message);
 
@@ -521,6 +722,39 @@ void MainWindow::onLoadModel()
     }
 }
 
+uint32_t MainWindow::fileTriangleIndex(uint32_t meshIndex) const
+{
+    return meshIndex < triangleOrder_.size() ? triangleOrder_[meshIndex] : meshIndex;
+}
+
+void MainWindow::applySpatialReorder()
+{
+    triangleOrder_.clear();
+
+    if (checkSpatialReorder_->isChecked())
+    {
+        triangleOrder_ = spatialReorder(currentMesh_);
+    }
+}
+
+std::vector<uint32_t> MainWindow::spatialReorder(core::mesh::SharedMesh& mesh)
+{
+    if (mesh->triangleCount() < 2)
+    {
+        return {};
+    }
+
+    // Dosya sırası uzaysal değil: Z index bucket'ları, vertex kaynaklama ve
+    // vertex buffer komşu triangle'ları bitişik okusun
+    core::mesh::MeshReorderer reorderer;
+    auto result = reorderer.reorder(mesh.mutate(), core::mesh::SpaceFillingCurve::Morton);
+
+    qDebug() << "🧭 Spatial reorder:" << result.permutation.size() << "triangles in"
+             << result.elapsedMs << "ms (Morton)";
+
+    return std::move(result.permutation);
+}
+
 void MainWindow::onLoadModelAsync()
 {
     QMessageBox::information(this, "Info", "Async loading not fully implemented yet. Use cached async!");
@@ -540,24 +774,26 @@ void MainWindow::onSolid()
 
 void MainWindow::onResetView()
 {
-    if (currentMesh_.triangleCount() > 0) {
-        meshRenderer_->setMesh(currentMesh_);
+    if (currentMesh_->triangleCount() > 0) {
+        meshRenderer_->setMesh(viewportMesh());
         statusBar()->showMessage("View reset");
     }
 }
 
 void MainWindow::onRecalculateNormals()
 {
-    if (currentMesh_.triangleCount() == 0)
+    if (currentMesh_->triangleCount() == 0)
     {
         QMessageBox::warning(this, "No Mesh", "Please load a model first.");
         return;
     }
 
     core::mesh::NormalProcessor processor;
-    auto result = processor.recalculateNormals(currentMesh_);
+    resetSlicing();
+    auto result = processor.recalculateNormals(currentMesh_.mutate());
+
+    rebuildViewportMesh();
 
-    meshRenderer_->setMesh(currentMesh_);
     updateMeshInfo();
 
     QString msg = QString("Recalculated %1 normals").arg(result.normalsRecalculated);
@@ -567,46 +803,76 @@ void MainWindow::onRecalculateNormals()
 
 void MainWindow::onSmoothNormals()
 {
-    if (currentMesh_.triangleCount() == 0)
+    // Sadece görüntü: facet normalleri (cache/export) değişmez
+    const bool smooth = btnSmoothNormals_->isChecked();
+    meshRenderer_->setSmoothShading(smooth);
+
+    if (currentMesh_->triangleCount() > 0)
+    {
+        meshRenderer_->setMesh(viewportMesh());
+    }
+
+    statusBar()->showMessage(smooth ? "Smooth shading on (angle threshold: 30°)"
+                                    : "Smooth shading off (facet normals)");
+}
+
+void MainWindow::onFlipNormals()
+{
+    if (currentMesh_->triangleCount() == 0)
     {
         QMessageBox::warning(this, "No Mesh", "Please load a model first.");
         return;
     }
 
     core::mesh::NormalProcessor processor;
-    auto result = processor.smoothNormals(currentMesh_, 30.0f);
+    resetSlicing();
+    auto result = processor.flipNormals(currentMesh_.mutate());
+
+    rebuildViewportMesh();
 
-    meshRenderer_->setMesh(currentMesh_);
     updateMeshInfo();
 
-    QString msg = QString("Smoothed %1 normals (angle threshold: 30°)")
-                      .arg(result.normalsSmoothed);
+    QString msg = QString("Flipped %1 normals").arg(result.normalsFlipped);
     statusBar()->showMessage(msg);
-    QMessageBox::information(this, "Normals Smoothed", msg);
+    QMessageBox::information(this, "Normals Flipped", msg);
 }
 
-void MainWindow::onFlipNormals()
+void MainWindow::onOrientWinding()
 {
-    if (currentMesh_.triangleCount() == 0)
+    if (currentMesh_->triangleCount() == 0)
     {
         QMessageBox::warning(this, "No Mesh", "Please load a model first.");
         return;
     }
 
     core::mesh::NormalProcessor processor;
-    auto result = processor.flipNormals(currentMesh_);
+    resetSlicing();
+    auto result = processor.orientWinding(currentMesh_.mutate());
+
+    rebuildViewportMesh();
 
-    meshRenderer_->setMesh(currentMesh_);
     updateMeshInfo();
 
-    QString msg = QString("Flipped %1 normals").arg(result.normalsFlipped);
-    statusBar()->showMessage(msg);
-    QMessageBox::information(this, "Normals Flipped", msg);
+    QString msg = QString("Reoriented %1 triangles in %2 components (%3 turned outward)")
+                      .arg(result.trianglesReoriented)
+                      .arg(result.components)
+                      .arg(result.componentsInverted);
+    if (result.orientationConflicts > 0)
+    {
+        msg += QString("\n%1 edges could not be oriented (non-orientable surface)")
+                   .arg(result.orientationConflicts);
+    }
+
+    qDebug() << "🧭 Orientation:" << result.trianglesReoriented << "triangles flipped,"
+             << result.components << "components," << result.orientationConflicts << "conflicts";
+
+    statusBar()->showMessage(QString("Reoriented %1 triangles").arg(result.trianglesReoriented));
+    QMessageBox::information(this, "Orientation Fixed", msg);
 }
 
 void MainWindow::onRepairMesh()
 {
-    if (currentMesh_.triangleCount() == 0)
+    if (currentMesh_->triangleCount() == 0)
     {
         QMessageBox::warning(this, "No Mesh", "Please load a model first.");
         return;
@@ -617,7 +883,8 @@ void MainWindow::onRepairMesh()
                                   "This will repair the mesh by:\n"
                                   "- Removing invalid triangles (NaN/Inf)\n"
                                   "- Removing degenerate triangles (area ≈ 0)\n"
-                                  "- Merging duplicate vertices\n\n"
+                                  "- Merging duplicate vertices\n"
+                                  "- Filling holes (open boundary loops)\n\n"
                                   "Continue?",
                                   QMessageBox::Yes | QMessageBox::No);
 
@@ -629,9 +896,12 @@ void MainWindow::onRepairMesh()
     statusBar()->showMessage("Repairing mesh...");
 
     core::mesh::MeshRepairer repairer;
-    auto result = repairer.repair(currentMesh_);
+    resetSlicing();
+    auto result = repairer.repair(currentMesh_.mutate());
+    triangleOrder_.clear();   // Triangle'lar silindi/eklendi, eşleme artık geçersiz
+
+    rebuildViewportMesh();
 
-    meshRenderer_->setMesh(currentMesh_);
     meshRenderer_->update();
     updateMeshInfo();
 
@@ -642,7 +912,11 @@ void MainWindow::onRepairMesh()
     message += QString("Triangles removed: %1\n\n").arg(result.trianglesRemoved);
     message += QString("Vertices merged: %1\n").arg(result.verticesMerged);
     message += QString("Degenerate triangles removed: %1\n").arg(result.degenerateTrianglesRemoved);
-    message += QString("Invalid triangles removed: %1\n\n").arg(result.invalidTrianglesRemoved);
+    message += QString("Invalid triangles removed: %1\n").arg(result.invalidTrianglesRemoved);
+    message += QString("Holes filled: %1 / %2 (%3 triangles added)\n\n")
+                   .arg(result.holesFilled)
+                   .arg(result.holesFound)
+                   .arg(result.trianglesAdded);
     message += "Actions taken:\n";
     for (const auto& action : result.actions)
     {
@@ -657,25 +931,79 @@ void MainWindow::onRepairMesh()
 
     qDebug() << "Repair complete:"
              << result.trianglesRemoved << "triangles removed,"
-             << result.verticesMerged << "vertices merged";
+             << result.verticesMerged << "vertices merged,"
+             << result.holesFilled << "holes filled";
+}
+
+namespace {
+
+// Bu sayının üstündeki mesh'ler viewport'a sadeleştirilmiş vekil olarak yüklenir
+constexpr size_t PREVIEW_TRIANGLE_LIMIT = 2000000;
+constexpr size_t PREVIEW_TRIANGLE_TARGET = 1000000;
+
+} // namespace
+
+void MainWindow::rebuildViewportMesh()
+{
+    previewMesh_.clear();
+    meshView_.reset();   // Mesh değişti, SoA görünümü bir sonraki kullanımda kurulur
+    containmentPoints_.clear();
+
+    if (currentMesh_->triangleCount() > PREVIEW_TRIANGLE_LIMIT)
+    {
+        core::mesh::DecimationSettings settings;
+        settings.targetTriangles = PREVIEW_TRIANGLE_TARGET;
+
+        core::mesh::MeshDecimator decimator(settings);
+        auto result = decimator.decimate(*currentMesh_);
+
+        if (result.success())
+        {
+            qDebug() << "🔻 Viewport proxy:" << result.inputTriangles << "→" << result.outputTriangles
+                     << "triangles (" << result.reduction() << "x) in" << result.elapsedMs << "ms,"
+                     << result.partitions << "partitions";
+            previewMesh_ = std::move(result.mesh);
+        }
+        else
+        {
+            qDebug() << "⚠️ Proxy decimation failed:" << QString::fromStdString(result.errorMessage);
+        }
+    }
+
+    meshRenderer_->setMesh(viewportMesh());
+    checkBuildVolume(true);
+}
+
+const core::mesh::Mesh& MainWindow::viewportMesh() const
+{
+    return previewMesh_.isEmpty() ? *currentMesh_ : previewMesh_;
 }
 
 void MainWindow::updateMeshInfo()
 {
-    int triangles = currentMesh_.triangleCount();
+    int triangles = currentMesh_->triangleCount();
     int vertices = triangles * 3;
 
-    labelTriangleCount_->setText(QString("Triangles: %1").arg(triangles));
+    if (previewMesh_.isEmpty())
+    {
+        labelTriangleCount_->setText(QString("Triangles: %1").arg(triangles));
+    }
+    else
+    {
+        labelTriangleCount_->setText(QString("Triangles: %1 (preview %2)")
+                                         .arg(triangles)
+                                         .arg(previewMesh_.triangleCount()));
+    }
     labelVertexCount_->setText(QString("Vertices: ~%1").arg(vertices));
 }
 
 void MainWindow::onSliceMesh()
 {
     qDebug() << "\n========================================";
-    qDebug() << "🔪 SLICING STARTED";
+    qDebug() << "🔪 SLICING STARTED (lazy)";
     qDebug() << "========================================";
 
-    if (currentMesh_.triangles.empty())
+    if (currentMesh_->triangles.empty())
     {
         qDebug() << "❌ ERROR: No mesh loaded!";
         qDebug() << "========================================\n";
@@ -683,67 +1011,318 @@ void MainWindow::onSliceMesh()
     }
 
     qDebug() << "📦 Mesh Info:";
-    qDebug() << "   Triangles:" << currentMesh_.triangles.size();
+    qDebug() << "   Triangles:" << currentMesh_->triangles.size();
+
+    const core::slicing::SlicingSettings settings = currentSlicingSettings();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    prepareSlicingSession();
+
+    // Eski sağlayıcının arka plan işi durur, sonucu da artık geçersiz
+    layerProvider_.reset();
+    slicingResult_ = core::slicing::SlicingResult();
+    btnShowLayers_->setEnabled(false);
+    btnExportLayers_->setEnabled(false);
+    btnExportGCode_->setEnabled(false);
+
+    const int generation = ++sliceGeneration_;
+
+    // Tam slicing arka planda; bitince sonuç UI thread'ine taşınır
+    core::slicing::SlicingResult status;
+    layerProvider_ = slicingSession_->createLayerProvider(
+        settings, status, {},
+        [this, generation, startTime](core::slicing::SlicingResult result) {
+            auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                  std::chrono::high_resolution_clock::now() - startTime
+                                  ).count();
+
+            QMetaObject::invokeMethod(this, [this, generation, durationMs, result = std::move(result)]() mutable {
+                onBackgroundSliceFinished(generation, std::move(result), durationMs);
+            }, Qt::QueuedConnection);
+        });
+
+    if (!layerProvider_)
+    {
+        slicingResult_ = std::move(status);
+        applySlicingResult(0, true);
+        return;
+    }
+
+    auto readyMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::high_resolution_clock::now() - startTime
+                       ).count();
 
+    qDebug() << "   Planes:" << layerProvider_->layerCount();
+    qDebug() << "   Ready to scrub in:" << readyMs << "ms (full slicing in background)";
+
+    // Slider hemen kullanılabilir, layer'lar talep edildikçe kesilir
+    sliderLayer_->setEnabled(true);
+    sliderLayer_->blockSignals(true);
+    sliderLayer_->setMaximum(static_cast<int>(layerProvider_->layerCount()) - 1);
+    sliderLayer_->setValue(0);
+    sliderLayer_->blockSignals(false);
+
+    labelLayerCount_->setText(QString("Layers: %1").arg(layerProvider_->layerCount()));
+
+    meshRenderer_->setRenderMode(rendering::MeshRenderer::RenderMode::Layers);
+    onLayerChanged(0);
+
+    // G-code, tam slicing'i beklemeden sağlayıcıdan akıtılabilir
+    btnExportGCode_->setEnabled(true);
+
+    statusBar()->showMessage(QString("⏳ Slicing %1 layers in background... scrub the slider to preview")
+                                 .arg(layerProvider_->layerCount()));
+}
+
+void MainWindow::onBackgroundSliceFinished(int generation, core::slicing::SlicingResult result, qint64 durationMs)
+{
+    // Bu arada yeni slice başladıysa eski sonuç atılır
+    if (generation != sliceGeneration_ || !layerProvider_)
+    {
+        return;
+    }
+
+    const auto stats = layerProvider_->stats();
+    qDebug() << "\n🔪 Background slicing finished";
+    qDebug() << "   Layer cache hits:" << stats.hits
+             << "| misses:" << stats.misses
+             << "| prefetched:" << stats.prefetched;
+
+    slicingResult_ = std::move(result);
+    applySlicingResult(durationMs, true);
+}
+
+void MainWindow::onSlicingSettingsChanged()
+{
+    // İlk slice'tan sonra ayar değişikliği oturum cache'i ile anında uygulanır
+    if (!slicingSession_ || (!layerProvider_ && slicingResult_.layers.empty()))
+    {
+        return;
+    }
+
+    resliceFromSession();
+}
+
+core::slicing::SlicingSettings MainWindow::currentSlicingSettings() const
+{
     core::slicing::SlicingSettings settings;
-    settings.layerHeight = 0.03f;
+    settings.layerHeight = static_cast<float>(spinLayerHeight_->value());
     settings.useSpatialIndex = true;
 
+    // Adaptive: sabit layerHeight ile aynı yüzey kalitesi, duvarlarda 4x kalın
+    settings.adaptiveLayers = checkAdaptiveLayers_->isChecked();
+    settings.minLayerHeight = settings.layerHeight;
+    settings.maxLayerHeight = settings.layerHeight * 4.0f;
+
+    settings.unionOverlappingShells = checkUnionShells_->isChecked();
+    settings.simplifyTolerance = static_cast<float>(spinSimplifyTolerance_->value());
+
     qDebug() << "\n⚙️  Slicing Settings:";
     qDebug() << "   Layer Height:" << settings.layerHeight << "mm";
+    qDebug() << "   Adaptive:" << (settings.adaptiveLayers ? "✅ ON" : "❌ OFF");
+    qDebug() << "   Union Shells:" << (settings.unionOverlappingShells ? "✅ ON" : "❌ OFF");
+    qDebug() << "   Simplify:" << settings.simplifyTolerance << "mm";
     qDebug() << "   Spatial Index:" << (settings.useSpatialIndex ? "✅ ON" : "❌ OFF");
 
-    qDebug() << "\n⏱️  Starting slicing...";
+    return settings;
+}
+
+const std::shared_ptr<const core::mesh::MeshSoA>& MainWindow::meshView()
+{
+    // Yükleme analizi ve slicing oturumu aynı görünümü paylaşır
+    if (!meshView_)
+    {
+        meshView_ = std::make_shared<const core::mesh::MeshSoA>(*currentMesh_);
+    }
+    return meshView_;
+}
+
+void MainWindow::prepareSlicingSession()
+{
+    // Oturum index'i ve kesitleri saklar; ekrandaki yerleşim ile slice edilen
+    // geometri aynı olmalı
+    if (!slicingSession_)
+    {
+        slicingSession_ = std::make_unique<core::slicing::SlicingSession>(currentMesh_.share(), meshView());
+    }
+
+    slicingSession_->setTransform(currentModelTransform());
+}
+
+core::mesh::ModelTransform MainWindow::currentModelTransform() const
+{
+    const QVector3D pos = meshRenderer_->getModelTranslation();
+    const QVector3D rot = meshRenderer_->getModelRotation();
+
+    core::mesh::ModelTransform transform;
+    transform.translation = core::geometry::Vec3(pos.x(), pos.y(), pos.z());
+    transform.rotation = core::geometry::Vec3(rot.x(), rot.y(), rot.z());
+    return transform;
+}
+
+const std::vector<core::geometry::Vec3>& MainWindow::containmentPoints()
+{
+    // Her triangle köşesi yerine kaynaklı (unique) vertex'ler: aynı sonuç,
+    // ~6 kat az dönüşüm. Mesh değişene kadar saklanır
+    if (containmentPoints_.empty() && !currentMesh_->triangles.empty())
+    {
+        containmentPoints_ = core::mesh::IndexedMesh::fromMesh(*currentMesh_).vertices;
+    }
+    return containmentPoints_;
+}
+
+void MainWindow::checkBuildVolume(bool fullScan)
+{
+    if (!currentPlate_ || currentMesh_->triangles.empty())
+    {
+        return;
+    }
+
+    // Gerçek mesh kontrol edilir (viewport vekili sadeleştirilmiş olabilir).
+    // Sürükleme/spin adımları saklı vertex kümesini, mesh/tabla/reset tüm mesh'i tarar
+    core::buildplate::PlateContainment containment;
+    const auto result = fullScan
+        ? containment.check(*currentMesh_, currentModelTransform(), *currentPlate_)
+        : containment.check(containmentPoints(), currentModelTransform(), *currentPlate_);
+
+    if (result.fits())
+    {
+        if (!modelFitsVolume_)
+        {
+            qDebug() << "✅ Model inside build volume (" << result.elapsedMs << "ms)";
+            statusBar()->showMessage("Model fits the build volume");
+        }
+        modelFitsVolume_ = true;
+        return;
+    }
+
+    QStringList sides;
+    auto addSide = [&sides](const char* name, float amount) {
+        if (amount > 0.0f)
+        {
+            sides << QString("%1 %2 mm").arg(name).arg(amount, 0, 'f', 1);
+        }
+    };
+    addSide("-X", result.overhangMin.x);
+    addSide("+X", result.overhangMax.x);
+    addSide("-Y", result.overhangMin.y);
+    addSide("+Y", result.overhangMax.y);
+    addSide("R", result.radialOverhang);
+    addSide("-Z", result.overhangMin.z);
+    addSide("+Z", result.overhangMax.z);
+
+    if (modelFitsVolume_)
+    {
+        const auto& p = result.firstViolationPoint;
+        qDebug() << "⚠️ Model outside build volume:" << result.violationCount << "/" << result.pointCount
+                 << "points, first at" << (fullScan ? "triangle" : "vertex")
+                 << (fullScan ? result.firstViolation / 3 : result.firstViolation)
+                 << "(" << p.x << p.y << p.z << ")," << result.elapsedMs << "ms";
+    }
+    modelFitsVolume_ = false;
+
+    statusBar()->showMessage(QString("⚠️ Outside build volume: %1").arg(sides.join(", ")));
+}
+
+void MainWindow::resliceFromSession()
+{
+    qDebug() << "\n🔪 RE-SLICING (incremental)";
+
+    const core::slicing::SlicingSettings settings = currentSlicingSettings();
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    core::slicing::Slicer slicer;
-    slicingResult_ = slicer.slice(currentMesh_, settings);
+    // Slider artık tam sonucu gösterir
+    layerProvider_.reset();
+    ++sliceGeneration_;
+
+    prepareSlicingSession();
+    slicingResult_ = slicingSession_->slice(settings);
 
     auto endTime = std::chrono::high_resolution_clock::now();
     auto durationMs = std::chrono::duration_cast<std::chrono::milliseconds>(
                           endTime - startTime
                           ).count();
 
+    const auto& placedStats = slicingSession_->placedMesh().stats();
+    const auto& sessionStats = slicingSession_->lastStats();
+    qDebug() << "   Rotation bakes:" << placedStats.rotationBakes
+             << "| Index builds:" << placedStats.indexBuilds
+             << "| Index reuses:" << placedStats.indexReuses;
+    qDebug() << "   Planes reused:" << sessionStats.planesReused
+             << "| sliced:" << sessionStats.planesSliced
+             << "| cached:" << sessionStats.cachedPlanes;
+
+    applySlicingResult(durationMs, false);
+}
+
+void MainWindow::applySlicingResult(qint64 durationMs, bool showReport)
+{
     qDebug() << "\n📊 RESULTS:";
 
     if (slicingResult_.success())
     {
+        // Sıfıra bölmeyi önle (cache'ten gelen sonuçlar 0 ms sürebilir)
+        const double seconds = std::max<qint64>(durationMs, 1) / 1000.0;
+
         qDebug() << "   Status: ✅ SUCCESS";
         qDebug() << "   Layers:" << slicingResult_.layers.size();
         qDebug() << "   Segments:" << slicingResult_.totalSegments;
+        if (slicingResult_.rawSegments != slicingResult_.totalSegments)
+        {
+            qDebug() << "   Raw segments:" << slicingResult_.rawSegments
+                     << "(" << slicingResult_.segmentReduction() << "x reduction )";
+        }
         qDebug() << "   Height:" << slicingResult_.totalHeight << "mm";
         qDebug() << "\n⏱️  PERFORMANCE:";
         qDebug() << "   Time:" << durationMs << "ms";
-        qDebug() << "   Speed:" << (slicingResult_.layers.size() * 1000.0 / durationMs) << "layers/sec";
+        qDebug() << "   Speed:" << (slicingResult_.layers.size() / seconds) << "layers/sec";
 
-        double totalOps = static_cast<double>(currentMesh_.triangles.size()) * slicingResult_.layers.size();
-        double opsPerSec = totalOps / (durationMs / 1000.0);
+        double totalOps = static_cast<double>(currentMesh_->triangles.size()) * slicingResult_.layers.size();
+        double opsPerSec = totalOps / seconds;
         qDebug() << "   Throughput:" << static_cast<long long>(opsPerSec) << "triangle-checks/sec";
 
         btnShowLayers_->setEnabled(true);
         btnExportLayers_->setEnabled(true);
-        sliderLayer_->setEnabled(true);
-        sliderLayer_->setMaximum(slicingResult_.layers.size() - 1);
-        sliderLayer_->setValue(0);
+        btnExportGCode_->setEnabled(true);
 
-        labelLayerCount_->setText(QString("Layers: %1").arg(slicingResult_.layers.size()));
+        // Lazy sağlayıcı varken slider düzlem index'i ile çalışmaya devam eder
+        if (!layerProvider_)
+        {
+            sliderLayer_->setEnabled(true);
+            sliderLayer_->blockSignals(true);
+            sliderLayer_->setMaximum(slicingResult_.layers.size() - 1);
+            sliderLayer_->setValue(0);
+            sliderLayer_->blockSignals(false);
+
+            labelLayerCount_->setText(QString("Layers: %1").arg(slicingResult_.layers.size()));
+
+            // Katmanlar gösteriliyorsa yeni sonucu hemen çiz
+            if (meshRenderer_->renderMode() == rendering::MeshRenderer::RenderMode::Layers)
+            {
+                meshRenderer_->setLayers(slicingResult_.layers);
+                meshRenderer_->setCurrentLayer(-1);
+            }
+        }
 
         statusBar()->showMessage(QString("✅ Slicing complete: %1 layers, %2 segments in %3 ms")
                                      .arg(slicingResult_.layers.size())
                                      .arg(slicingResult_.totalSegments)
                                      .arg(durationMs));
 
-        QMessageBox::information(this, "Slicing Complete",
-                                 QString("✅ Slicing successful!\n\n"
-                                         "Layers: %1\n"
-                                         "Segments: %2\n"
-                                         "Time: %3 ms\n"
-                                         "Speed: %4 layers/sec\n\n"
-                                         "Click 'Show Layers' to visualize.")
-                                     .arg(slicingResult_.layers.size())
-                                     .arg(slicingResult_.totalSegments)
-                                     .arg(durationMs)
-                                     .arg(slicingResult_.layers.size() * 1000.0 / durationMs, 0, 'f', 1));
+        if (showReport)
+        {
+            QMessageBox::information(this, "Slicing Complete",
+                                     QString("✅ Slicing successful!\n\n"
+                                             "Layers: %1\n"
+                                             "Segments: %2\n"
+                                             "Time: %3 ms\n"
+                                             "Speed: %4 layers/sec\n\n"
+                                             "Click 'Show Layers' to visualize.")
+                                         .arg(slicingResult_.layers.size())
+                                         .arg(slicingResult_.totalSegments)
+                                         .arg(durationMs)
+                                         .arg(slicingResult_.layers.size() / seconds, 0, 'f', 1));
+        }
     }
     else
     {
@@ -751,18 +1330,35 @@ void MainWindow::onSliceMesh()
         qDebug() << "   Error:" << QString::fromStdString(slicingResult_.errorMessage);
 
         statusBar()->showMessage("❌ Slicing failed!");
-        QMessageBox::critical(this, "Slicing Failed",
-                              QString("Slicing failed:\n\n%1")
-                                  .arg(QString::fromStdString(slicingResult_.errorMessage)));
+        if (showReport)
+        {
+            QMessageBox::critical(this, "Slicing Failed",
+                                  QString("Slicing failed:\n\n%1")
+                                      .arg(QString::fromStdString(slicingResult_.errorMessage)));
+        }
     }
 
     qDebug() << "========================================\n";
 }
 
+void MainWindow::resetSlicing()
+{
+    // Sağlayıcı önce: arka plan thread'i oturumun index'ini ve mesh'i okuyor
+    layerProvider_.reset();
+    slicingSession_.reset();
+    ++sliceGeneration_;
+}
+
 void MainWindow::onShowLayers()
 {
     if (slicingResult_.layers.empty())
     {
+        if (layerProvider_ && !layerProvider_->isComplete())
+        {
+            statusBar()->showMessage("⏳ Slicing still running in background...");
+            return;
+        }
+
         QMessageBox::warning(this, "No Layers", "Please slice the mesh first.");
         return;
     }
@@ -777,6 +1373,29 @@ void MainWindow::onShowLayers()
 
 void MainWindow::onLayerChanged(int value)
 {
+    // Lazy mod: layer o an kesilir ya da LRU'dan gelir, komşular arka planda hazırlanır
+    if (layerProvider_)
+    {
+        auto layer = layerProvider_->layer(static_cast<size_t>(std::max(value, 0)));
+        if (!layer)
+        {
+            return;
+        }
+
+        meshRenderer_->setLayers({*layer});
+        meshRenderer_->setCurrentLayer(0);
+
+        labelCurrentLayer_->setText(QString("%1 / %2")
+                                        .arg(value)
+                                        .arg(layerProvider_->layerCount()));
+
+        statusBar()->showMessage(QString("Layer %1: Z=%2mm, %3 segments")
+                                     .arg(value)
+                                     .arg(layer->zHeight(), 0, 'f', 2)
+                                     .arg(layer->segmentCount()));
+        return;
+    }
+
     if (slicingResult_.layers.empty())
     {
         return;
@@ -823,7 +1442,7 @@ void MainWindow::onLoadModelCachedSync()
             qDebug() << "Progress:" << progress << "%";
         },
 
-        [this, startTime, fileName](core::mesh::Mesh mesh, bool success, std::string error) {
+        [this, startTime, fileName](core::mesh::SharedMesh mesh, bool success, std::string error) {
             auto endTime = std::chrono::high_resolution_clock::now();
             auto loadMs = std::chrono::duration_cast<std::chrono::milliseconds>(
                               endTime - startTime
@@ -838,12 +1457,14 @@ void MainWindow::onLoadModelCachedSync()
 
             qDebug() << "✅ Load time:" << loadMs << "ms";
 
+            resetSlicing();
             currentMesh_ = std::move(mesh);
-            meshRenderer_->setMesh(currentMesh_);
+            applySpatialReorder();
+            rebuildViewportMesh();
             updateMeshInfo();
 
             core::mesh::MeshAnalyzer analyzer;
-            auto stats = analyzer.analyze(currentMesh_);
+            auto stats = analyzer.analyze(*meshView());
 
             QString statusMsg = QString("Loaded: %1 - %2 triangles in %3ms (cached)")
                                     .arg(QFileInfo(fileName).fileName())
@@ -874,6 +1495,9 @@ void MainWindow::onLoadModelCachedAsync()
 
     auto startTime = std::chrono::high_resolution_clock::now();
 
+    // Worker thread checkbox'a dokunmaz: seçim yükleme başında alınır
+    const bool reorder = checkSpatialReorder_->isChecked();
+
     m_cachedAsyncStrategy->load(
         fileName.toStdString(),
 
@@ -881,7 +1505,7 @@ void MainWindow::onLoadModelCachedAsync()
             qDebug() << "📊 Progress:" << progress << "%";
         },
 
-        [this, startTime, fileName](core::mesh::Mesh mesh, bool success, std::string error) {
+        [this, startTime, fileName, reorder](core::mesh::SharedMesh mesh, bool success, std::string error) {
             auto loadMs = std::chrono::duration_cast<std::chrono::milliseconds>(
                               std::chrono::high_resolution_clock::now() - startTime
                               ).count();
@@ -897,19 +1521,29 @@ void MainWindow::onLoadModelCachedAsync()
 
             qDebug() << "✅ CACHED ASYNC Load completed in" << loadMs << "ms";
 
-            QMetaObject::invokeMethod(this, [this, mesh = std::move(mesh), loadMs, fileName]() mutable {
+            // Yeniden sıralama loader thread'inde: UI thread beklemez
+            std::vector<uint32_t> order;
+            if (reorder)
+            {
+                order = spatialReorder(mesh);
+            }
+
+            QMetaObject::invokeMethod(this, [this, mesh = std::move(mesh), order = std::move(order),
+                                             loadMs, fileName]() mutable {
+                resetSlicing();
                 currentMesh_ = std::move(mesh);
-                meshRenderer_->setMesh(currentMesh_);
+                triangleOrder_ = std::move(order);
+                rebuildViewportMesh();
                 updateMeshInfo();
 
                 core::mesh::MeshAnalyzer analyzer;
-                auto stats = analyzer.analyze(currentMesh_);
+                auto stats = analyzer.analyze(*meshView());
 
                 statusBar()->showMessage(QString("✅ Loaded %1 triangles in %2ms (cached async)")
                                              .arg(stats.triangleCount)
                                              .arg(loadMs));
 
-                qDebug() << "✅ Total complete:" << currentMesh_.triangleCount() << "triangles";
+                qDebug() << "✅ Total complete:" << currentMesh_->triangleCount() << "triangles";
             }, Qt::QueuedConnection);
         }
         );
@@ -926,6 +1560,8 @@ void MainWindow::onPlateCreated(std::shared_ptr<core::buildplate::BuildPlate> pl
     qDebug() << "   Height:" << plate->height() << "mm";
 
     meshRenderer_->setBuildPlate(plate);
+    modelFitsVolume_ = true;
+    checkBuildVolume(true);
 
     statusBar()->showMessage(QString("Build plate created: %1×%2×%3mm")
                                  .arg(plate->width(), 0, 'f', 0)
@@ -1003,6 +1639,78 @@ void MainWindow::onExportLayers()
     }
 }
 
+void MainWindow::onExportGCode()
+{
+    if (!layerProvider_ && slicingResult_.layers.empty())
+    {
+        QMessageBox::warning(this, "No Layers", "Please slice the mesh first.");
+        return;
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(
+        this,
+        "Export G-code",
+        "model.gcode",
+        "G-code Files (*.gcode);;"
+        "All Files (*)"
+        );
+
+    if (fileName.isEmpty()) return;
+
+    io::gcode::GCodeSettings gcodeSettings;
+    core::toolpath::PerimeterSettings perimeterSettings;
+    core::toolpath::InfillSettings infillSettings;
+    gcodeSettings.extrusionWidth = perimeterSettings.extrusionWidth;
+    if (currentPlate_)
+    {
+        gcodeSettings.alignToPlate(currentPlate_->bounds());   // Marlin orijini tablanın ön-sol köşesi
+    }
+    infillSettings.lineWidth = perimeterSettings.extrusionWidth;
+
+    io::gcode::GCodeExporter exporter(gcodeSettings, perimeterSettings, infillSettings);
+
+    statusBar()->showMessage("Exporting G-code...");
+
+    auto progress = [this](size_t done, size_t total) {
+        statusBar()->showMessage(QString("Exporting G-code... %1 / %2 layers").arg(done).arg(total));
+    };
+
+    io::gcode::GCodeStats stats;
+    try
+    {
+        // Sağlayıcı varsa slicing'in bitmesi beklenmez, layer'lar kesildikçe yazılır
+        const std::string path = fileName.toStdString();
+        stats = layerProvider_ ? exporter.exportLayers(*layerProvider_, path, progress)
+                               : exporter.exportLayers(slicingResult_, path, progress);
+    }
+    catch (const std::exception& e)
+    {
+        qDebug() << "❌ G-code export failed:" << e.what();
+        QMessageBox::critical(this, "Export Failed", QString::fromStdString(e.what()));
+        return;
+    }
+
+    qDebug() << "\n🧾 G-code exported";
+    qDebug() << "   Layers:" << stats.layers << "| Moves:" << stats.moves;
+    qDebug() << "   Size:" << stats.bytes / 1024.0 / 1024.0 << "MB in" << stats.elapsedMs << "ms"
+             << "(" << stats.megabytesPerSecond() << "MB/s )";
+    qDebug() << "   Disk wait:" << stats.ioWaitMs << "ms";
+
+    const QString sizeStr = QString::number(stats.bytes / 1024.0 / 1024.0, 'f', 2) + " MB";
+
+    statusBar()->showMessage(QString("✅ G-code exported in %1ms (%2)")
+                                 .arg(static_cast<qint64>(stats.elapsedMs))
+                                 .arg(sizeStr));
+
+    QMessageBox::information(this, "Export Complete",
+                             QString("Exported %1 layers\nMoves: %2\nSize: %3\nFilament: %4 m\nTime: %5 ms")
+                                 .arg(stats.layers)
+                                 .arg(stats.moves)
+                                 .arg(sizeStr)
+                                 .arg(stats.filamentMm / 1000.0, 0, 'f', 2)
+                                 .arg(static_cast<qint64>(stats.elapsedMs)));
+}
+
 bool MainWindow::exportLayersJSON(const QString& fileName)
 {
     QJsonObject root;
@@ -1010,7 +1718,8 @@ bool MainWindow::exportLayersJSON(const QString& fileName)
     root["total_layers"] = static_cast<int>(slicingResult_.layers.size());
     root["total_segments"] = slicingResult_.totalSegments;
     root["total_height"] = slicingResult_.totalHeight;
-    root["layer_height"] = 0.03f;
+    root["layer_height"] = slicingResult_.layerHeight;
+    root["adaptive_layers"] = slicingResult_.adaptiveLayers;
 
     QJsonObject layersObject;
 
@@ -1068,7 +1777,7 @@ bool MainWindow::exportLayersBinary(const QString& fileName)
 
     out.writeRawData("SLYR", 4);
     out << (quint32)1;
-    out << (float)0.03f;
+    out << (float)slicingResult_.layerHeight;
     out << (quint32)slicingResult_.layers.size();
     out << (quint32)slicingResult_.totalSegments;
     out << (float)slicingResult_.totalHeight;
@@ -1104,7 +1813,7 @@ bool MainWindow::exportLayersBinaryCompressed(const QString& fileName)
 
     out.writeRawData("SLYR", 4);
     out << (quint32)1;
-    out << (float)0.03f;
+    out << (float)slicingResult_.layerHeight;
     out << (quint32)slicingResult_.layers.size();
     out << (quint32)slicingResult_.totalSegments;
     out << (float)slicingResult_.totalHeight;
@@ -1144,13 +1853,13 @@ bool MainWindow::exportLayersBinaryCompressed(const QString& fileName)
 
 void MainWindow::onCenterModel()
 {
-    if (currentMesh_.triangles.empty())
+    if (currentMesh_->triangles.empty())
     {
         qDebug() << "⚠️ No mesh to center!";
         return;
     }
 
-    meshRenderer_->centerModel(currentMesh_);
+    meshRenderer_->centerModel(*currentMesh_);
 
     QVector3D pos = meshRenderer_->getModelTranslation();
 
@@ -1165,4 +1874,6 @@ void MainWindow::onCenterModel()
     spinMoveX_->blockSignals(false);
     spinMoveY_->blockSignals(false);
     spinMoveZ_->blockSignals(false);
+
+    checkBuildVolume(true);
 }
@@ -2,12 +2,18 @@
 
 #include <QMainWindow>
 #include <memory>
+#include <vector>
 #include "core/mesh/mesh.h"
+#include "core/mesh/SharedMesh.h"
+#include "core/mesh/MeshSoA.h"
+#include "core/mesh/MeshTransform.h"
 #include "core/slicing/Slicer.h"
+#include "core/slicing/SlicingSession.h"
 #include "io/loading/ILoadingStrategy.h"
 #include "io/loading/AsyncLoadingStrategy.h"
 #include "core/buildplate/BuildPlate.h"
 #include <QDoubleSpinBox>
+#include <QCheckBox>
 #include <QVector3D>
 
 // Forward declarations
@@ -34,17 +40,20 @@ private slots:
     void onSolid();
     void onResetView();
     void onExportLayers();
+    void onExportGCode();
 
     // Normal Processing
     void onRecalculateNormals();
     void onSmoothNormals();
     void onFlipNormals();
+    void onOrientWinding();
 
     // Mesh Repair
     void onRepairMesh();
 
     // Slicing
     void onSliceMesh();
+    void onSlicingSettingsChanged();
     void onShowLayers();
     void onLayerChanged(int);
 
@@ -61,6 +70,7 @@ private slots:
     void onRotateZChanged(double value);
     void onResetTransform();
     void onCenterModel();
+    void onArrangeParts();
 
     void onModelTransformedByGizmo(QVector3D translation, QVector3D rotationZ);
 
@@ -73,18 +83,25 @@ private:
     QPushButton* btnWireframe_;
     QPushButton* btnSolid_;
     QPushButton* btnReset_;
+    QCheckBox* checkSpatialReorder_;
     QPushButton* btnExportLayers_;
+    QPushButton* btnExportGCode_;
 
     // Normal buttons
     QPushButton* btnRecalcNormals_;
     QPushButton* btnSmoothNormals_;
     QPushButton* btnFlipNormals_;
+    QPushButton* btnOrientWinding_;
 
     // Repair button
     QPushButton* btnRepairMesh_;
 
     // Slice buttons
     QPushButton* btnSliceMesh_;
+    QDoubleSpinBox* spinLayerHeight_;
+    QCheckBox* checkAdaptiveLayers_;
+    QCheckBox* checkUnionShells_;
+    QDoubleSpinBox* spinSimplifyTolerance_;
     QPushButton* btnShowLayers_;
 
     // Layer slider
@@ -97,8 +114,16 @@ private:
     QLabel* labelLayerCount_;
 
     // Current data
-    core::mesh::Mesh currentMesh_;
+    core::mesh::SharedMesh currentMesh_;                              // Copy-on-write; slicing oturumu ile paylaşılır
+    core::mesh::Mesh previewMesh_;                                    // Büyük mesh'lerin viewport vekili (boşsa currentMesh_)
+    std::shared_ptr<const core::mesh::MeshSoA> meshView_;             // currentMesh_'in SoA görünümü (lazy, mesh değişince sıfırlanır)
+    std::vector<core::geometry::Vec3> containmentPoints_;             // currentMesh_'in kaynaklı vertex'leri (lazy, gizmo/spin hacim kontrolü)
     core::slicing::SlicingResult slicingResult_;
+    std::unique_ptr<core::slicing::SlicingSession> slicingSession_;   // currentMesh_ değişince reset
+    std::unique_ptr<core::slicing::LayerProvider> layerProvider_;     // Lazy layer'lar (slider)
+    int sliceGeneration_ = 0;                                         // Eski arka plan sonuçlarını ayırt eder
+    bool modelFitsVolume_ = true;                                     // Son hacim kontrolünün sonucu
+    std::vector<uint32_t> triangleOrder_;                             // Mesh sırası → dosya sırası (boş = dosya sırası)
 
     // Loading strategies
     std::unique_ptr<io::loading::ILoadingStrategy> m_loadingStrategy;
@@ -116,10 +141,26 @@ private:
     QDoubleSpinBox* spinRotateZ_;
     QPushButton* btnCenterModel_;
     QPushButton* btnResetTransform_;
+    QPushButton* btnArrangeParts_;
 
 
     // Helper
     void updateMeshInfo();
+    void rebuildViewportMesh();         // currentMesh_ değişince: gerekirse vekil üret, renderer'a yükle
+    void applySpatialReorder();         // Yükleme sonrası: triangle'ları uzaysal sıraya diz (opsiyonel)
+    static std::vector<uint32_t> spatialReorder(core::mesh::SharedMesh& mesh);   // Thread-safe; sıra → dosya index'i
+    uint32_t fileTriangleIndex(uint32_t meshIndex) const;   // Dışarıya verilen triangle index'i (dosya sırası)
+    const core::mesh::Mesh& viewportMesh() const;
+    const std::shared_ptr<const core::mesh::MeshSoA>& meshView();
+    core::mesh::ModelTransform currentModelTransform() const;
+    const std::vector<core::geometry::Vec3>& containmentPoints();
+    void checkBuildVolume(bool fullScan = false);   // Yerleşim değişince; mesh/tabla/reset'te fullScan (tüm triangle'lar)
+    core::slicing::SlicingSettings currentSlicingSettings() const;
+    void prepareSlicingSession();
+    void resliceFromSession();          // Etkileşimli yeniden slice (dialog yok)
+    void applySlicingResult(qint64 durationMs, bool showReport);
+    void onBackgroundSliceFinished(int generation, core::slicing::SlicingResult result, qint64 durationMs);
+    void resetSlicing();                // currentMesh_ değişmeden önce çağrılmalı
     void onPlateCreated(std::shared_ptr<core::buildplate::BuildPlate> plate);
 
     bool exportLayersJSON(const QString& fileName);